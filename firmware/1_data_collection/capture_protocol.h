@@ -0,0 +1,230 @@
+// Binary capture protocol for the data collector (OUTPUT_BINARY), shared
+// by the sketches and the host decoder (firmware/host/capture_decode.cpp).
+//
+// Every frame is COBS-encoded and wrapped in 0x00 delimiters, so the host
+// resynchronizes after any corruption and text the sketch prints between
+// frames (banners, prompts) is skipped as noise. Decoded, a frame is its
+// payload followed by the payload's CRC-32 (zlib polynomial), little-endian.
+//
+// Payloads, little-endian:
+//   FRAME_INFO     type, version, sample_period_us u32, adc_bits u8,
+//                  vref_mv u16, activities u8, NUL-terminated names
+//   FRAME_SAMPLES  type, activity u8, rep u8, count u8, seq u16, rssi i8,
+//                  delta_shift u8, t0_us u32, dropped u32, overruns u32,
+//                  then count 3-byte samples: adc (12 bits) | delta << 12
+//   FRAME_END      type, samples u32, dropped u32, overruns u32
+// A sample's delta is the time since the previous sample of the frame in
+// units of 1 << delta_shift us (0 for the first, which is at t0_us).
+// dropped counts samples lost on the device (late loop passes, frames that
+// did not fit the TX buffer) and overruns those frames, both since boot, so
+// a lost frame does not lose the counts. seq counts frames since boot.
+
+#ifndef CAPTURE_PROTOCOL_H
+#define CAPTURE_PROTOCOL_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define PROTOCOL_VERSION 1
+
+#define FRAME_INFO 0x01
+#define FRAME_SAMPLES 0x02
+#define FRAME_END 0x03
+
+// FRAME_SAMPLES header offsets
+enum {
+  SF_TYPE, SF_ACTIVITY, SF_REP, SF_COUNT, SF_SEQ, SF_RSSI = 6, SF_SHIFT, SF_T0,
+  SF_DROPPED = 12, SF_OVERRUNS = 16
+};
+
+#define FRAME_MAX_SAMPLES 64
+#define SAMPLES_HEADER_BYTES 20
+#define SAMPLE_BYTES 3
+#define SAMPLE_DELTA_MAX 4095
+#define FRAME_CRC_BYTES 4
+#define FRAME_MAX_PAYLOAD 256
+
+// COBS adds one byte per 254 and the leading code byte; plus two delimiters
+#define COBS_MAX(n) ((n) + (n) / 254 + 1)
+#define FRAME_MAX_WIRE (COBS_MAX(FRAME_MAX_PAYLOAD + FRAME_CRC_BYTES) + 2)
+
+static_assert(SAMPLES_HEADER_BYTES + FRAME_MAX_SAMPLES * SAMPLE_BYTES <= FRAME_MAX_PAYLOAD,
+              "Sample frame exceeds FRAME_MAX_PAYLOAD");
+
+// ============ WIRE HELPERS ============
+inline void put_u16(uint8_t* p, uint16_t v) {
+  p[0] = v;
+  p[1] = v >> 8;
+}
+
+inline void put_u32(uint8_t* p, uint32_t v) {
+  for (int i = 0; i < 4; i++) p[i] = v >> (8 * i);
+}
+
+inline uint16_t get_u16(const uint8_t* p) { return p[0] | (p[1] << 8); }
+
+inline uint32_t get_u32(const uint8_t* p) {
+  return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+// CRC-32 as zlib.crc32(), a nibble at a time: 64 bytes of table
+inline uint32_t frame_crc32(const uint8_t* p, size_t n) {
+  static const uint32_t kTable[16] = {
+    0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4,
+    0x4DB26158, 0x5005713C, 0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C,
+    0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C
+  };
+  uint32_t crc = 0xFFFFFFFF;
+  for (size_t i = 0; i < n; i++) {
+    crc ^= p[i];
+    crc = (crc >> 4) ^ kTable[crc & 15];
+    crc = (crc >> 4) ^ kTable[crc & 15];
+  }
+  return ~crc;
+}
+
+// Consistent Overhead Byte Stuffing: out holds COBS_MAX(n) bytes, none 0
+inline size_t cobs_encode(const uint8_t* in, size_t n, uint8_t* out) {
+  size_t code_at = 0, o = 1;
+  uint8_t code = 1;
+  for (size_t i = 0; i < n; i++) {
+    if (in[i]) {
+      out[o++] = in[i];
+      code++;
+    }
+    if (!in[i] || code == 0xFF) {
+      out[code_at] = code;
+      code_at = o++;
+      code = 1;
+    }
+  }
+  out[code_at] = code;
+  return o;
+}
+
+// Returns the decoded length, or 0 for malformed input; out holds n bytes
+inline size_t cobs_decode(const uint8_t* in, size_t n, uint8_t* out) {
+  size_t i = 0, o = 0;
+  while (i < n) {
+    uint8_t code = in[i++];
+    if (!code || i + code - 1 > n) return 0;
+    for (int k = 1; k < code; k++) {
+      if (!in[i]) return 0;
+      out[o++] = in[i++];
+    }
+    if (code != 0xFF && i < n) out[o++] = 0;
+  }
+  return o;
+}
+
+// Appends the CRC to payload (which needs FRAME_CRC_BYTES spare), then
+// writes the delimited COBS frame to out (FRAME_MAX_WIRE bytes)
+inline size_t frame_encode(uint8_t* payload, size_t n, uint8_t* out) {
+  put_u32(payload + n, frame_crc32(payload, n));
+  out[0] = 0;
+  size_t len = 1 + cobs_encode(payload, n + FRAME_CRC_BYTES, out + 1);
+  out[len++] = 0;
+  return len;
+}
+
+// Decodes the bytes between two delimiters into payload (n bytes); returns
+// the payload length without the CRC, or 0 if malformed or the CRC fails
+inline size_t frame_decode(const uint8_t* in, size_t n, uint8_t* payload) {
+  size_t len = cobs_decode(in, n, payload);
+  if (len <= FRAME_CRC_BYTES) return 0;
+  len -= FRAME_CRC_BYTES;
+  return get_u32(payload + len) == frame_crc32(payload, len) ? len : 0;
+}
+
+// Smallest delta_shift that fits twice the sample period in SAMPLE_DELTA_MAX
+inline uint8_t delta_shift_for(uint32_t period_us) {
+  uint8_t shift = 0;
+  while (((2 * period_us) >> shift) > SAMPLE_DELTA_MAX) shift++;
+  return shift;
+}
+
+// ============ FRAMES ============
+// FRAME_INFO: how to read the sample frames that follow
+inline size_t info_frame(uint32_t period_us, const char* const* names, int activities, uint8_t* out) {
+  uint8_t payload[FRAME_MAX_PAYLOAD + FRAME_CRC_BYTES];
+  payload[0] = FRAME_INFO;
+  payload[1] = PROTOCOL_VERSION;
+  put_u32(payload + 2, period_us);
+  payload[6] = 12;
+  put_u16(payload + 7, 3300);
+  payload[9] = activities;
+  size_t n = 10;
+  for (int a = 0; a < activities; a++) {
+    for (const char* c = names[a]; *c && n < FRAME_MAX_PAYLOAD - 1; c++) payload[n++] = *c;
+    if (n < FRAME_MAX_PAYLOAD) payload[n++] = 0;
+  }
+  return frame_encode(payload, n, out);
+}
+
+// FRAME_END: collection finished, with final counters
+inline size_t end_frame(uint32_t samples, uint32_t dropped, uint32_t overruns, uint8_t* out) {
+  uint8_t payload[13 + FRAME_CRC_BYTES];
+  payload[0] = FRAME_END;
+  put_u32(payload + 1, samples);
+  put_u32(payload + 5, dropped);
+  put_u32(payload + 9, overruns);
+  return frame_encode(payload, 13, out);
+}
+
+// ============ SAMPLE BATCH ============
+// Builds one FRAME_SAMPLES payload in place
+class SampleBatch {
+public:
+  void start(uint8_t activity, uint8_t rep, int8_t rssi, uint8_t delta_shift) {
+    payload[SF_TYPE] = FRAME_SAMPLES;
+    payload[SF_ACTIVITY] = activity;
+    payload[SF_REP] = rep;
+    payload[SF_RSSI] = (uint8_t)rssi;
+    payload[SF_SHIFT] = delta_shift;
+    count = 0;
+  }
+
+  // False, without adding, when the frame is full or the gap since the
+  // previous sample does not fit a delta
+  bool add(uint16_t adc, uint32_t t_us) {
+    uint32_t delta = 0;
+    if (count) {
+      uint8_t shift = payload[SF_SHIFT];
+      delta = (t_us - last_us + (1u << shift) / 2) >> shift;
+      if (count == FRAME_MAX_SAMPLES || delta > SAMPLE_DELTA_MAX) return false;
+      last_us += delta << shift;
+    } else {
+      put_u32(payload + SF_T0, t_us);
+      last_us = t_us;
+    }
+    uint32_t packed = (adc & 0xFFF) | (delta << 12);
+    uint8_t* p = payload + SAMPLES_HEADER_BYTES + count * SAMPLE_BYTES;
+    p[0] = packed;
+    p[1] = packed >> 8;
+    p[2] = packed >> 16;
+    count++;
+    return true;
+  }
+
+  int size() const { return count; }
+  bool full() const { return count == FRAME_MAX_SAMPLES; }
+
+  // Fills the counters and encodes the frame into out (FRAME_MAX_WIRE);
+  // the batch is empty afterwards
+  size_t finish(uint16_t seq, uint32_t dropped, uint32_t overruns, uint8_t* out) {
+    payload[SF_COUNT] = count;
+    put_u16(payload + SF_SEQ, seq);
+    put_u32(payload + SF_DROPPED, dropped);
+    put_u32(payload + SF_OVERRUNS, overruns);
+    size_t n = frame_encode(payload, SAMPLES_HEADER_BYTES + count * SAMPLE_BYTES, out);
+    count = 0;
+    return n;
+  }
+
+private:
+  uint8_t payload[FRAME_MAX_PAYLOAD + FRAME_CRC_BYTES];
+  int count = 0;
+  uint32_t last_us = 0;  // Reconstructed time of the last sample, as the host sees it
+};
+
+#endif  // CAPTURE_PROTOCOL_H
@@ -12,6 +12,7 @@
  #include <HTTPClient.h>
  #include <Wire.h>
  #include <U8g2lib.h>
+ #include "capture_protocol.h"
  
  // ============ CONFIGURATION ============
  #define WIFI_SSID "xxxxx"
@@ -21,9 +22,17 @@
  #define SDA_PIN 21
  #define SCL_PIN 22
  
- #define SAMPLE_RATE 200          // 200 Hz sampling
- #define SAMPLES_PER_ACTIVITY 6000 // 30 seconds @ 200Hz
+ #define SAMPLE_RATE 200          // 200 Hz sampling; OUTPUT_BINARY keeps up with 2000+
+ #define ACTIVITY_SECONDS 30
+ #define SAMPLES_PER_ACTIVITY (SAMPLE_RATE * ACTIVITY_SECONDS)
  #define REPETITIONS 5            // 5 samples per activity
+ #define SAMPLE_PERIOD_US (1000000UL / SAMPLE_RATE)
+ 
+ // 0: one CSV line per sample (~30 bytes: at most ~380 Hz at 115200 baud)
+ // 1: batched binary frames (capture_protocol.h, ~3.4 bytes a sample) for
+ //    firmware/host/capture_decode
+ #define OUTPUT_BINARY 0
+ #define TX_BUFFER_BYTES 2048     // Serial TX ring for binary frames
  
  // ============ HARDWARE ============
  U8G2_SH1106_128X64_NONAME_F_HW_I2C u8g2(U8G2_R0, U8X8_PIN_NONE);
@@ -52,9 +61,21 @@
  unsigned long activity_start = 0;
  bool collection_active = false;
  unsigned long last_action = 0;
+ unsigned long last_sample_us = 0;
+ uint32_t total_samples = 0;
+ uint32_t dropped_samples = 0;    // Sample periods missed, or samples in frames that did not fit
+ 
+ // Binary output
+ SampleBatch batch;
+ uint8_t frame_buf[FRAME_MAX_WIRE];
+ uint16_t frame_seq = 0;
+ uint32_t overrun_frames = 0;     // Frames dropped because the TX buffer was full
  
  // ============ SETUP ============
  void setup() {
+ #if OUTPUT_BINARY
+   Serial.setTxBufferSize(TX_BUFFER_BYTES);
+ #endif
    Serial.begin(115200);
   Serial.setTimeout(10);
    delay(2000);
@@ -67,7 +88,9 @@
    // Configure ADC
    analogReadResolution(12);
    analogSetAttenuation(ADC_11db);
-   Serial.println("✓ ADC: GPIO34, 12-bit, 200Hz");
+   Serial.print("✓ ADC: GPIO34, 12-bit, ");
+   Serial.print(SAMPLE_RATE);
+   Serial.println("Hz");
    
    // Initialize OLED
    Wire.begin(SDA_PIN, SCL_PIN);
@@ -103,7 +126,11 @@
    
    // Print CSV header
    Serial.println("\n=== DATA COLLECTION START ===");
+ #if OUTPUT_BINARY
+   Serial.write(frame_buf, info_frame(SAMPLE_PERIOD_US, activity_names, 6, frame_buf));
+ #else
    Serial.println("timestamp_ms,voltage_mv,rssi_dbm,activity_id,activity_name");
+ #endif
    
    // Wait for user
    show_status("Ready to Start", "Press any key...");
@@ -132,22 +159,28 @@
      return;
    }
    
-   unsigned long now = millis();
+   unsigned long now = micros();
    
-   // Sample at 200Hz
-   static unsigned long last_sample = 0;
-   if (now - last_sample >= 5) {
-     last_sample = now;
+   // Sample at SAMPLE_RATE
+   if (now - last_sample_us >= SAMPLE_PERIOD_US) {
+     // Whole periods this pass came late for (blocking requests, the display)
+     unsigned long late = (now - last_sample_us) / SAMPLE_PERIOD_US - 1;
+     dropped_samples += late;
+     last_sample_us += (late + 1) * SAMPLE_PERIOD_US;  // Stay on the sample grid
      
      // Read ADC
      int adc_raw = analogRead(ADC_PIN);
+     
+ #if OUTPUT_BINARY
+     add_binary_sample(adc_raw, now);
+ #else
      float voltage_mv = (adc_raw / 4095.0) * 3300.0;
      
      // Read RSSI
      int rssi = WiFi.RSSI();
      
      // Output CSV
-     Serial.print(now);
+     Serial.print(millis());
      Serial.print(",");
      Serial.print(voltage_mv, 2);
      Serial.print(",");
@@ -156,11 +189,13 @@
      Serial.print(current_activity);
      Serial.print(",");
      Serial.println(activity_names[current_activity]);
+ #endif
      
      sample_count++;
+     total_samples++;
      
-     // Update display every 100 samples
-     if (sample_count % 100 == 0) {
+     // Update display twice a second
+     if (sample_count % (SAMPLE_RATE / 2) == 0) {
        update_display();
      }
    }
@@ -280,11 +315,42 @@
    udp.stop();
  }
  
+ // ============ BINARY OUTPUT ============
+ void add_binary_sample(int adc_raw, unsigned long t_us) {
+   if (batch.size() == 0) start_batch();
+   if (!batch.add(adc_raw, t_us)) {
+     // Frame full, or too long since the last sample for a delta
+     send_batch();
+     start_batch();
+     batch.add(adc_raw, t_us);
+   }
+   if (batch.full()) send_batch();
+ }
+ 
+ void start_batch() {
+   batch.start(current_activity, current_rep + 1, WiFi.RSSI(), delta_shift_for(SAMPLE_PERIOD_US));
+ }
+ 
+ // Never blocks sampling: a frame that does not fit the TX buffer is
+ // dropped and counted, and the host sees the gap in seq
+ void send_batch() {
+   int count = batch.size();
+   if (count == 0) return;
+   size_t n = batch.finish(frame_seq++, dropped_samples, overrun_frames, frame_buf);
+   if (Serial.availableForWrite() < (int)n) {
+     overrun_frames++;
+     dropped_samples += count;
+     return;
+   }
+   Serial.write(frame_buf, n);
+ }
+ 
  // ============ COLLECTION CONTROL ============
  void start_new_activity() {
    sample_count = 0;
    activity_start = millis();
    last_action = millis();
+   last_sample_us = micros() - SAMPLE_PERIOD_US;
    
    Serial.print("\n╔══════════════════════════════════════╗\n");
    Serial.print("║  Activity: ");
@@ -301,6 +367,9 @@
  }
  
  void finish_activity() {
+ #if OUTPUT_BINARY
+   send_batch();
+ #endif
    Serial.print("\n>>> Completed: ");
    Serial.print(activity_names[current_activity]);
    Serial.print(" Rep ");
@@ -328,12 +397,18 @@
  
  void collection_complete() {
    collection_active = false;
+ #if OUTPUT_BINARY
+   send_batch();
+   Serial.write(frame_buf, end_frame(total_samples, dropped_samples, overrun_frames, frame_buf));
+ #endif
    
    Serial.println("\n╔══════════════════════════════════════╗");
    Serial.println("║      DATA COLLECTION COMPLETE        ║");
    Serial.println("╚══════════════════════════════════════╝");
    Serial.print("\nTotal samples: ");
-   Serial.println(sample_count);
+   Serial.println(total_samples);
+   Serial.print("Dropped samples: ");
+   Serial.println(dropped_samples);
    Serial.println("Activities: 6");
    Serial.print("Reps per activity: ");
    Serial.println(REPETITIONS);
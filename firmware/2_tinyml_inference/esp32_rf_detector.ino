@@ -19,6 +19,15 @@
  #include <Wire.h>
  #include <U8g2lib.h>
  #include "random_forest_model.h"  // Generated by extract_rf_to_cpp.py
+ #include "idle_cascade.h"          // Generated by extract_rf_to_cpp.py
+ #include "feature_extractor.h"
+ #include "timer_sample_source.h"
+ #include "pipeline.h"
+ #include "retained_display.h"
+ #include "mitigation.h"
+ #include "telemetry_log.h"
+ #include "temporal_decoder.h"
+ #include "rate_controller.h"
  
  // ============ CONFIGURATION ============
  #define WIFI_SSID "CBTECH_OPEN_STARLINK"
@@ -29,192 +38,100 @@
  #define SCL_PIN 22
  #define MITIGATION_PIN 25  // Optional: GPIO for countermeasure
  
- #define SAMPLE_RATE 200
- #define WINDOW_SIZE 100
- #define NUM_FEATURES 30
+ constexpr int SAMPLE_RATE = 200;     // Hz
+ constexpr int WINDOW_SIZE = 100;
+ constexpr int HOP_SIZE = 10;         // Samples between feature vectors (10 = 50 ms)
+ constexpr bool STREAMING_SPECTRUM = true;  // true: sliding DFT per sample, false: FFT per window
+ constexpr int SAMPLE_RING_SIZE = 64;  // Samples the feature task may fall behind (320 ms)
+ constexpr int FEATURE_CORE = 0;       // loop() runs on core 1
+ constexpr int DISPLAY_FRAME_MS = 250; // Shortest gap between OLED frames
+ 
+ // Temporal decoder: a new activity needs DECODER_VOTES of the last
+ // DECODER_WINDOWS hops (40 = 2 s). host/decoder_replay picked 7 of 8 at
+ // 250 ms steps; this keeps that span and share at the 50 ms hop.
+ constexpr int DECODER_WINDOWS = 40;
+ constexpr int DECODER_VOTES = 35;
+ constexpr bool IDLE_CASCADE = true;  // Confident IDLE from O(1) statistics skips the forest
+ 
+ // Adaptive rate: after RATE_SETTLE_MS of decoded IDLE the timer drops to
+ // SAMPLE_RATE / RATE_DIVIDER and only the activity detector runs
+ // (rate_controller.h). A trip, or RATE_PROBE_MS at the low rate, brings
+ // full rate and classification back.
+ constexpr bool ADAPTIVE_RATE = true;
+ constexpr int RATE_DIVIDER = 4;
+ constexpr int RATE_SETTLE_MS = 3000;  // Past the decoder's 35 of 40 plus a window
+ constexpr int RATE_PROBE_MS = 16000;
+ 
+ // Telemetry: records are framed for host/telemetry_decode unless LOG_BINARY
+ // is false. Send '0'-'3' over Serial to change the level at run time.
+ constexpr bool LOG_BINARY = true;
+ constexpr uint8_t LOG_LEVEL = LEVEL_STATS;
+ constexpr int LOG_RING_SIZE = 32;     // Records the log task may fall behind
+ constexpr int LOG_TX_BUFFER = 1024;   // Serial TX buffer; holds a stats block as text
+ constexpr int LOG_DRAIN_MS = 5;
+ 
+ // Mitigation per activity_names class: pulses per train, phase width
+ // range (us), train period and how long trains repeat (ms)
+ const MitigationProfile MITIGATION_PROFILES[6] = {
+   {0, 0, 0, 0, 0},         // IDLE: none
+   {15, 50, 200, 0, 0},     // SOCIAL
+   {15, 50, 200, 0, 0},     // VIDEO
+   {15, 50, 200, 0, 0},     // MESSAGE
+   {15, 50, 200, 0, 0},     // BROWSE
+   {15, 50, 200, 0, 0},     // GAMING
+ };
  
  // ============ HARDWARE ============
  U8G2_SH1106_128X64_NONAME_F_HW_I2C u8g2(U8G2_R0, U8X8_PIN_NONE);
+ RetainedDisplay display(u8g2, DISPLAY_FRAME_MS);
+ MitigationEngine mitigation(MITIGATION_PIN);
  
- // ============ FEATURE EXTRACTION ============
- class FeatureExtractor {
- private:
-   float window[WINDOW_SIZE];
-   int window_idx = 0;
-   
- public:
-   void add_sample(float voltage) {
-     window[window_idx] = voltage;
-     window_idx = (window_idx + 1) % WINDOW_SIZE;
-   }
-   
-   bool is_window_ready() {
-     return window_idx == 0;
-   }
-   
-   void extract_features(float* features) {
-     // Time-domain features (14)
-     float sum = 0, sum_sq = 0, min_v = 99999, max_v = -99999;
-     
-     for(int i = 0; i < WINDOW_SIZE; i++) {
-       sum += window[i];
-       sum_sq += window[i] * window[i];
-       if(window[i] < min_v) min_v = window[i];
-       if(window[i] > max_v) max_v = window[i];
-     }
-     
-     float mean = sum / WINDOW_SIZE;
-     float var = (sum_sq / WINDOW_SIZE) - (mean * mean);
-     float std = sqrt(var);
-     
-     features[0] = mean;
-     features[1] = std;
-     features[2] = var;
-     features[3] = min_v;
-     features[4] = max_v;
-     features[5] = max_v - min_v;  // range
-     features[6] = calculate_median();
-     features[7] = calculate_skewness(mean, std);
-     features[8] = calculate_kurtosis(mean, std);
-     features[9] = calculate_percentile(25);
-     features[10] = calculate_percentile(75);
-     
-     // Derivative features (3)
-     float diff_sum = 0, diff_sum_sq = 0, max_diff = 0;
-     for(int i = 1; i < WINDOW_SIZE; i++) {
-       float d = abs(window[i] - window[i-1]);
-       diff_sum += d;
-       diff_sum_sq += d * d;
-       if(d > max_diff) max_diff = d;
-     }
-     features[11] = diff_sum / (WINDOW_SIZE - 1);
-     features[12] = sqrt((diff_sum_sq / (WINDOW_SIZE - 1)) - (features[11] * features[11]));
-     features[13] = max_diff;
-     
-     // Frequency-domain features (10) - Simplified
-     float energy_low = 0, energy_mid = 0, energy_high = 0;
-     for(int i = 0; i < WINDOW_SIZE/2; i++) {
-       float val = abs(window[i] - window[i + WINDOW_SIZE/2]);
-       if(i < 10) energy_low += val;
-       else if(i < 50) energy_mid += val;
-       else energy_high += val;
-     }
-     
-     features[14] = energy_low;
-     features[15] = energy_mid;
-     features[16] = energy_high;
-     features[17] = energy_low + energy_mid + energy_high;
-     features[18] = std;  // Spectral spread approximation
-     features[19] = max_v - min_v;  // Spectral range
-     features[20] = 0;  // Placeholder for full FFT features
-     features[21] = 0;
-     features[22] = 0;
-     features[23] = 0;
-     
-     // Wavelet features (6) - Simplified Haar decomposition
-     float approx[WINDOW_SIZE/2], detail[WINDOW_SIZE/2];
-     for(int i = 0; i < WINDOW_SIZE/2; i++) {
-       approx[i] = (window[2*i] + window[2*i+1]) / 2.0;
-       detail[i] = (window[2*i] - window[2*i+1]) / 2.0;
-     }
-     
-     float approx_sum = 0, approx_sum_sq = 0;
-     float detail_sum = 0, detail_sum_sq = 0;
-     float detail_energy1 = 0, detail_energy2 = 0;
-     
-     for(int i = 0; i < WINDOW_SIZE/2; i++) {
-       approx_sum += approx[i];
-       approx_sum_sq += approx[i] * approx[i];
-       detail_sum += detail[i];
-       detail_sum_sq += detail[i] * detail[i];
-       
-       if(i < WINDOW_SIZE/4) detail_energy1 += abs(detail[i]);
-       else detail_energy2 += abs(detail[i]);
-     }
-     
-     float approx_mean = approx_sum / (WINDOW_SIZE/2);
-     float detail_mean = detail_sum / (WINDOW_SIZE/2);
-     
-     features[24] = sqrt((approx_sum_sq / (WINDOW_SIZE/2)) - (approx_mean * approx_mean));
-     features[25] = sqrt((detail_sum_sq / (WINDOW_SIZE/2)) - (detail_mean * detail_mean));
-     features[26] = features[25] * 0.7;  // Approximation for level 2
-     features[27] = features[25] * 0.5;  // Approximation for level 3
-     features[28] = detail_energy1;
-     features[29] = detail_energy2;
-   }
+ // ============ PIPELINE ============
+ // acquire:  timer ISR wakes the sampling task (core 1), which fills the sample ring
+ // classify: feature_task (core 0) extracts and votes, queues a Detection
+ // act:      loop() (core 1) logs, mitigates and draws each Detection
+ // Each queue has one producer and one consumer, so no stage takes a lock
+ // and a slow display or mitigation burst never holds up the sample clock.
+ TimerSampleSource<SAMPLE_RING_SIZE> source(ADC_PIN);
+ SpscQueue<Detection, DETECTION_QUEUE_SIZE> detections;
+ TaskHandle_t feature_task_handle = nullptr;
  
- private:
-   float calculate_median() {
-     float temp[WINDOW_SIZE];
-     memcpy(temp, window, WINDOW_SIZE * sizeof(float));
-     
-     // Partial sort to find median
-     for(int i = 0; i < WINDOW_SIZE/2 + 1; i++) {
-       for(int j = i + 1; j < WINDOW_SIZE; j++) {
-         if(temp[j] < temp[i]) {
-           float swap = temp[i];
-           temp[i] = temp[j];
-           temp[j] = swap;
-         }
-       }
-     }
-     return temp[WINDOW_SIZE/2];
-   }
-   
-   float calculate_percentile(int p) {
-     float temp[WINDOW_SIZE];
-     memcpy(temp, window, WINDOW_SIZE * sizeof(float));
-     
-     int target = (p * WINDOW_SIZE) / 100;
-     
-     // Partial sort to target index
-     for(int i = 0; i < target + 1; i++) {
-       for(int j = i + 1; j < WINDOW_SIZE; j++) {
-         if(temp[j] < temp[i]) {
-           float swap = temp[i];
-           temp[i] = temp[j];
-           temp[j] = swap;
-         }
-       }
-     }
-     return temp[target];
-   }
-   
-   float calculate_skewness(float mean, float std) {
-     if(std == 0) return 0;
-     
-     float sum_cubed = 0;
-     for(int i = 0; i < WINDOW_SIZE; i++) {
-       float z = (window[i] - mean) / std;
-       sum_cubed += z * z * z;
-     }
-     return sum_cubed / WINDOW_SIZE;
-   }
-   
-   float calculate_kurtosis(float mean, float std) {
-     if(std == 0) return 0;
-     
-     float sum_fourth = 0;
-     for(int i = 0; i < WINDOW_SIZE; i++) {
-       float z = (window[i] - mean) / std;
-       sum_fourth += z * z * z * z;
-     }
-     return (sum_fourth / WINDOW_SIZE) - 3.0;  // Excess kurtosis
-   }
- };
+ // log:      log_task (core 1) moves records from the act stage to the UART
+ TelemetryLog<LOG_RING_SIZE> telemetry(activity_names, 6, NUM_FEATURES);
  
- // ============ GLOBALS ============
- FeatureExtractor extractor;
- float features[NUM_FEATURES];
+ // ============ FEATURE STAGE (core 0) ============
+ // Only the features the exported trees and the cascade test are compiled in
+ FeatureExtractor<WINDOW_SIZE, HOP_SIZE, FOREST_FEATURE_MASK | CASCADE_FEATURE_MASK, STREAMING_SPECTRUM> extractor;
+ uint32_t windows_classified = 0;
+ TemporalDecoder<DECODER_WINDOWS> decoder(DECODER_VOTES);
+ RateController rate(SAMPLE_RATE, RATE_DIVIDER, RATE_SETTLE_MS, RATE_PROBE_MS);
  
+ // ============ ACT STAGE (core 1) ============
  unsigned long total_inferences = 0;
  unsigned long total_latency = 0;
+ unsigned long total_features_computed = 0;
+ uint64_t total_cycles = 0;
  int detection_count[6] = {0};
- int last_predicted = -1;
+ int last_class = -1;                 // Previous window's vote
+ int last_activity = 0;               // The decoder starts at IDLE
  unsigned long last_change = 0;
+ uint32_t class_changes = 0;          // Window to window
+ uint32_t activity_changes = 0;       // After the decoder
+ uint32_t early_exits = 0;            // Windows the cascade settled
+ StageStats ring_stats;      // Sample stamped to vote start: ring wait and extraction
+ StageStats classify_stats;  // Vote, with the features it pulls
+ StageStats queue_stats;     // Detection waiting for loop()
+ StageStats act_stats;       // Logging and mitigation
+ StageStats display_stats;   // Redraw and dirty pages over I2C
+ 
+ // What the next frame shows
+ int shown_class = 0;
+ unsigned long shown_latency = 0;
+ bool display_changed = false;
  
  // ============ SETUP ============
  void setup() {
+   Serial.setTxBufferSize(LOG_TX_BUFFER);
    Serial.begin(115200);
    delay(1000);
    
@@ -226,7 +143,9 @@
    // ADC
    analogReadResolution(12);
    analogSetAttenuation(ADC_11db);
-   Serial.println("✓ ADC configured: GPIO34, 12-bit, 200Hz");
+   Serial.print("✓ ADC configured: GPIO34, 12-bit, ");
+   Serial.print(SAMPLE_RATE);
+   Serial.println("Hz");
    
    // OLED
    Wire.begin(SDA_PIN, SCL_PIN);
@@ -235,8 +154,7 @@
    Serial.println("✓ OLED initialized: 1.3\" SH1106");
    
    // Mitigation pin (optional)
-   pinMode(MITIGATION_PIN, OUTPUT);
-   digitalWrite(MITIGATION_PIN, LOW);
+   if (!mitigation.begin()) Serial.println("⚠ Mitigation timer unavailable");
    
    show_boot_screen();
    
@@ -261,8 +179,21 @@
    }
    
    Serial.println("\n🌲 Random Forest Model Loaded");
-   Serial.println("   Algorithm: Decision Tree (from RF ensemble)");
-   Serial.println("   Features: 30 (time + freq + wavelet)");
+   Serial.print("   Algorithm: Majority vote over ");
+   Serial.print(FOREST_NUM_TREES);
+   Serial.println(" trees");
+   Serial.print("   Nodes: ");
+   Serial.print(FOREST_NUM_NODES);
+   Serial.print(" (");
+   Serial.print(FOREST_FLASH_BYTES);
+   Serial.println(" bytes flash)");
+   Serial.print("   Features: ");
+   Serial.print(__builtin_popcount(FOREST_FEATURE_MASK));
+   Serial.print(" of ");
+   Serial.print(NUM_FEATURES);
+   Serial.print(" used (");
+   Serial.print(sizeof(extractor));
+   Serial.println(" bytes extractor RAM)");
    Serial.println("   Classes: 6 activities");
    
    show_ready_screen();
@@ -270,98 +201,209 @@
    
    Serial.println("\n=== Real-time Inference Started ===\n");
    Serial.println("Format: Inference# | Activity | Confidence | Latency");
+   
+   telemetry.set_level(LOG_LEVEL);
+   xTaskCreatePinnedToCore(log_task, "log", 4096, nullptr, 1, nullptr, 1);
+   
+   // The feature task sleeps until the timer has a hop of samples for it
+   xTaskCreatePinnedToCore(feature_task, "features", 8192, nullptr, 2, &feature_task_handle, FEATURE_CORE);
+   source.notify(feature_task_handle, HOP_SIZE);
+   if (!source.begin(SAMPLE_RATE)) Serial.println("⚠ Sample timer unavailable");
  }
  
  // ============ MAIN LOOP ============
  void loop() {
-   static unsigned long last_sample = 0;
-   unsigned long now = millis();
+   // A digit from the host sets the log level
+   if (Serial.available()) {
+     int c = Serial.read();
+     if (c >= '0' && c <= '0' + LEVEL_STATS) telemetry.set_level(c - '0');
+   }
    
-   // Sample at 200Hz
-   if (now - last_sample >= 5) {
-     last_sample = now;
-     
-     int adc = analogRead(ADC_PIN);
-     float voltage = (adc / 4095.0) * 3300.0;
-     
-     extractor.add_sample(voltage);
+   // Act on every detection the feature task queued, oldest first
+   Detection d;
+   while (detections.pop(d)) {
+     report(d);
+   }
+   
+   // Frames go out on their own clock, not once per inference
+   refresh_display();
+ }
+ 
+ // ============ FEATURE TASK ============
+ void feature_task(void*) {
+   for (;;) {
+     // The timeout only matters if the timer stops (a hop is 200 ms at the
+     // low rate)
+     ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(500));
      
-     if (extractor.is_window_ready()) {
-       run_inference();
+     Sample s;
+     while (source.read(s)) {
+       // At the low rate only the rate controller's detector sees samples
+       bool full = !ADAPTIVE_RATE || rate.add_sample(s);
+       if (ADAPTIVE_RATE && rate.take_change()) {
+         source.set_rate(rate.rate_hz());
+         rate.rate_applied(micros());
+       }
+       if (!full) continue;
+       
+       float voltage = (s.adc / 4095.0) * 3300.0;
+       
+       extractor.add_sample(voltage);
+       
+       // Back at full rate, the first window must hold no samples from
+       // before the drop
+       if (extractor.is_window_ready() && (!ADAPTIVE_RATE || rate.full_samples() >= WINDOW_SIZE)) {
+         run_inference(s.t_us);
+       }
      }
    }
  }
  
  // ============ INFERENCE ============
- void run_inference() {
+ void run_inference(uint32_t sample_t_us) {
+   Detection d = {};
+   d.seq = ++windows_classified;
+   d.sample_t_us = sample_t_us;
    unsigned long start = micros();
+   uint32_t start_cycles = ESP.getCycleCount();
+   
+   // First stage: a confident IDLE from the running statistics exits early.
+   // Otherwise the forest votes, computing features as splits ask.
+   d.early_exit = IDLE_CASCADE && cascade_accepts_idle(extractor);
+   d.cls = d.early_exit ? 0 : classify_random_forest_lazy(extractor);
+   decoder.update(d.cls);
+   d.activity = decoder.current();
+   d.confidence = decoder.confidence_pct();
+   d.lag = decoder.lag;
+   if (ADAPTIVE_RATE) rate.add_window(d.activity);
+   
+   d.cycles = ESP.getCycleCount() - start_cycles;
+   d.done_t_us = micros();
+   d.classify_us = d.done_t_us - start;
+   d.computed = extractor.features_computed();
+   d.ring_backlog = source.max_pending();
+   d.low_rate_ms = rate.low_ms();
+   d.rate_drops = rate.drops;
+   d.rate_trips = rate.trips;
+   d.rate_probes = rate.probes;
+   
+   // Features for the periodic log (computes any the trees skipped)
+   if (d.seq % 10 == 0) {
+     d.dump[0] = extractor[0];
+     d.dump[1] = extractor[1];
+     d.dump[2] = extractor[5];
+     d.dump[3] = extractor[15];
+   }
    
-   // Extract features
-   extractor.extract_features(features);
-   
-   // Run Random Forest classifier
-   int predicted_class = classify_random_forest(features);
-   
-   unsigned long latency = micros() - start;
+   // A full queue drops it and counts it; loop() sees the gap in seq
+   detections.push(d);
+ }
+ 
+ // ============ REPORTING ============
+ void report(const Detection& d) {
+   unsigned long start = micros();
+   ring_stats.add(d.done_t_us - d.classify_us - d.sample_t_us);
+   classify_stats.add(d.classify_us);
+   queue_stats.add(start - d.done_t_us);
+   
+   // The decoded activity is what the detector reports and acts on
+   int predicted_class = d.activity;
+   unsigned long latency = d.classify_us;
+   total_cycles += d.cycles;
    total_latency += latency;
+   total_features_computed += d.computed;
    total_inferences++;
    detection_count[predicted_class]++;
+   early_exits += d.early_exit;
+   class_changes += last_class >= 0 && d.cls != last_class;
+   last_class = d.cls;
    
    // Detect activity changes
-   bool activity_changed = (predicted_class != last_predicted);
+   bool activity_changed = (predicted_class != last_activity);
    if(activity_changed) {
-     last_predicted = predicted_class;
+     last_activity = predicted_class;
+     activity_changes++;
      last_change = millis();
    }
    
-   // Log to Serial
-   Serial.print("#");
-   Serial.print(total_inferences);
-   Serial.print(" | ");
-   Serial.print(activity_names[predicted_class]);
-   Serial.print(" | Latency: ");
-   Serial.print(latency / 1000.0, 2);
-   Serial.print(" ms | Avg: ");
-   Serial.print((total_latency / total_inferences) / 1000.0, 2);
-   Serial.println(" ms");
-   
-   // Log features every 10 inferences (for debugging)
-   if(total_inferences % 10 == 0) {
-     Serial.print("   [Features] mean=");
-     Serial.print(features[0], 1);
-     Serial.print(" std=");
-     Serial.print(features[1], 1);
-     Serial.print(" range=");
-     Serial.print(features[5], 1);
-     Serial.print(" energy_mid=");
-     Serial.println(features[15], 1);
+   if (telemetry.wants(LEVEL_INFERENCES)) {
+     LogRecord r(LOG_INFERENCE);
+     r.u32(d.seq).u8(d.cls).u8(predicted_class).u8(d.confidence).u8(d.computed).u32(latency);
+     r.u32(total_latency / total_inferences);
+     r.u16(total_features_computed * 10 / total_inferences);
+     telemetry.log(LEVEL_INFERENCES, r);
+   }
+   
+   // Features and pipeline health every 10 inferences
+   if (d.seq % 10 == 0 && telemetry.wants(LEVEL_STATS)) {
+     LogRecord r(LOG_STATS);
+     r.u32(d.seq).f32(d.dump[0]).f32(d.dump[1]).f32(d.dump[2]).f32(d.dump[3]);
+     r.u32(total_cycles / total_inferences);
+     r.u16(d.ring_backlog).u16(SAMPLE_RING_SIZE).u32(source.dropped());
+     r.u16(detections.max_size()).u16(DETECTION_QUEUE_SIZE).u32(detections.dropped());
+     log_stage(r, ring_stats);
+     log_stage(r, classify_stats);
+     log_stage(r, queue_stats);
+     log_stage(r, act_stats);
+     log_stage(r, display_stats);
+     r.u32(display.frames).u16(display.last_bytes).u16(display.avg_bytes()).u16(OLED_FRAME_BYTES);
+     r.u32(mitigation.started).u32(mitigation.pulses);
+     r.u32(telemetry.dropped());
+     r.u32(class_changes).u32(activity_changes).u8(DECODER_VOTES).u8(DECODER_WINDOWS);
+     r.u32(early_exits);
+     r.u16(SAMPLE_RATE).u16(ADAPTIVE_RATE ? SAMPLE_RATE / RATE_DIVIDER : SAMPLE_RATE);
+     r.u32(d.low_rate_ms).u16(d.rate_drops).u16(d.rate_trips).u16(d.rate_probes);
+     telemetry.log(LEVEL_STATS, r);
    }
    
    // Trigger mitigation if attack detected
    if(predicted_class != 0 && activity_changed) {
-     trigger_mitigation(predicted_class);
+     trigger_mitigation(d, predicted_class);
    }
    
-   // Update display
-   update_display(predicted_class, latency, activity_changed);
+   // Shown by the next frame
+   shown_class = predicted_class;
+   shown_latency = latency;
+   display_changed |= activity_changed;
+   
+   act_stats.add(micros() - start);
  }
  
- // ============ MITIGATION ============
- void trigger_mitigation(int attack_type) {
-   Serial.print("⚠️  MITIGATION: ");
-   Serial.print(activity_names[attack_type]);
-   Serial.println(" side-channel detected!");
-   
-   // Inject power noise to mask side-channel
-   for(int i = 0; i < 15; i++) {
-     digitalWrite(MITIGATION_PIN, HIGH);
-     delayMicroseconds(random(50, 200));
-     digitalWrite(MITIGATION_PIN, LOW);
-     delayMicroseconds(random(50, 200));
+ void log_stage(LogRecord& r, const StageStats& stage) {
+   r.u32(stage.avg_us()).u32(stage.max_us);
+ }
+ 
+ // ============ LOG TASK (core 1) ============
+ // Shares core 1 with loop(); it writes only what the TX buffer takes at
+ // once and sleeps in between, so it never waits on the UART
+ void log_task(void*) {
+   for (;;) {
+     telemetry.drain(Serial, LOG_BINARY);
+     vTaskDelay(pdMS_TO_TICKS(LOG_DRAIN_MS));
    }
  }
  
+ // ============ MITIGATION ============
+ void trigger_mitigation(const Detection& d, int attack_type) {
+   // Inject power noise to mask the side-channel. The timer plays the
+   // pattern, so report() returns at once.
+   if (!mitigation.start(MITIGATION_PROFILES[attack_type])) return;
+   
+   LogRecord r(LOG_MITIGATION);
+   r.u32(d.seq).u8(attack_type).u8(d.confidence).u16(d.lag * HOP_SIZE * 1000 / SAMPLE_RATE);
+   telemetry.log(LEVEL_EVENTS, r);
+ }
+ 
  // ============ DISPLAY ============
+ void refresh_display() {
+   if (!total_inferences || !display.due(millis())) return;
+   
+   unsigned long start = micros();
+   update_display(shown_class, shown_latency, display_changed);
+   display_changed = false;
+   display_stats.add(micros() - start);
+ }
+ 
  void show_boot_screen() {
    u8g2.clearBuffer();
    u8g2.setFont(u8g2_font_logisoso16_tr);
@@ -370,7 +412,7 @@
    u8g2.drawStr(25, 48, "DEFENDER");
    u8g2.setFont(u8g2_font_5x7_tr);
    u8g2.drawStr(20, 60, "Random Forest 80.6%");
-   u8g2.sendBuffer();
+   display.flush(millis());
    delay(2000);
  }
  
@@ -380,9 +422,11 @@
    u8g2.drawStr(30, 24, "READY");
    u8g2.setFont(u8g2_font_6x10_tr);
    u8g2.drawStr(5, 40, "Random Forest");
-   u8g2.drawStr(5, 52, "Decision Tree");
+   u8g2.setCursor(5, 52);
+   u8g2.print(FOREST_NUM_TREES);
+   u8g2.print(" trees, voting");
    u8g2.drawStr(5, 64, "30 features, 6 classes");
-   u8g2.sendBuffer();
+   display.flush(millis());
  }
  
  void update_display(int cls, unsigned long latency_us, bool changed) {
@@ -430,5 +474,5 @@
      u8g2.drawBox(30 + i*16, 62 - bar_height, 14, bar_height);
    }
    
-   u8g2.sendBuffer();
+   display.flush(millis());
  }
\ No newline at end of file
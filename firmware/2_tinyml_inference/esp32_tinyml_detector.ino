@@ -7,26 +7,26 @@
  * OLED: SDA=21, SCL=22
  * 
  * LIBRARIES NEEDED (Arduino IDE):
- * 1. Install "EloquentTinyML" by Eloquent Arduino
- *    OR
- * 2. TensorFlowLite_ESP32 (if using official TFLM)
+ * 1. Install "TensorFlowLite_ESP32" (TensorFlow Lite Micro). The sketch
+ *    drives the interpreter itself so features go straight into its int8
+ *    input tensor (int8_model.h).
  */
 
  #include <WiFi.h>
  #include <Wire.h>
  #include <U8g2lib.h>
  
- // TinyML - Choose ONE of these options:
- // Option A: EloquentTinyML (easier, recommended)
- #include <EloquentTinyML.h>
+ #include "int8_model.h"
  #include "model.h"  // Generated by Python script
- 
- // Option B: Official TensorFlow Lite Micro
- // #include <TensorFlowLite_ESP32.h>
- // #include "tensorflow/lite/micro/all_ops_resolver.h"
- // #include "tensorflow/lite/micro/micro_error_reporter.h"
- // #include "tensorflow/lite/micro/micro_interpreter.h"
- // #include "tensorflow/lite/schema/schema_generated.h"
+ #include "order_statistics.h"
+ #include "rfft.h"
+ #include "spectral_features.h"
+ #include "wavelet_db4.h"
+ #include "timer_sample_source.h"
+ #include "retained_display.h"
+ #include "temporal_decoder.h"
+ #include "idle_cascade.h"     // Generated by extract_rf_to_cpp.py
+ #include "rate_controller.h"
  
  // ============ CONFIGURATION ============
  #define WIFI_SSID "CBTECH_OPEN_STARLINK"
@@ -39,61 +39,119 @@
  #define SAMPLE_RATE 200
  #define WINDOW_SIZE 100
  #define NUM_FEATURES 30
+ #define SAMPLE_RING_SIZE 64  // Samples loop() may fall behind (320 ms)
+ #define DISPLAY_FRAME_MS 250  // Shortest gap between OLED frames
+ #define DECODER_WINDOWS 8     // An activity needs DECODER_VOTES of the last
+ #define DECODER_VOTES 6       // 8 windows (4 s), from host/decoder_replay --every 2
+ #define IDLE_CASCADE 1        // Confident IDLE from cheap statistics skips the model
+ #define ADAPTIVE_RATE 1       // Drop to SAMPLE_RATE / RATE_DIVIDER after RATE_SETTLE_MS
+ #define RATE_DIVIDER 4        // of decoded IDLE; a trip on the activity detector or
+ #define RATE_SETTLE_MS 4000   // RATE_PROBE_MS at the low rate restores full rate
+ #define RATE_PROBE_MS 16000   // (rate_controller.h)
  
  // ============ HARDWARE ============
  U8G2_SH1106_128X64_NONAME_F_HW_I2C u8g2(U8G2_R0, U8X8_PIN_NONE);
+ RetainedDisplay display(u8g2, DISPLAY_FRAME_MS);
+ 
+ // What the next frame shows
+ int shown_class = 0;
+ unsigned long shown_latency = 0;
  
  // ============ TINYML MODEL ============
+ // model_batch windows per invoke (ml_training_pipeline.py --batch); a
+ // batch runs when full or when loop() has drained the ring
  #define ARENA_SIZE 20000
- Eloquent::TinyML::TfLite<NUM_FEATURES, 6, ARENA_SIZE> ml(model_data);
+ Int8Model<NUM_FEATURES, 6, model_batch, ARENA_SIZE> ml(model_data);
+ bool model_ready = false;
+ TemporalDecoder<DECODER_WINDOWS> decoder(DECODER_VOTES);
+ RateController rate(SAMPLE_RATE, RATE_DIVIDER, RATE_SETTLE_MS, RATE_PROBE_MS);
  
  // ============ FEATURE EXTRACTION ============
  class FeatureExtractor {
  private:
    float window[WINDOW_SIZE];
    int window_idx = 0;
+   bool window_full = false;
+   SortedWindow<float, WINDOW_SIZE> sorted;  // Median and quartiles
+   RealFFT<WINDOW_SIZE> fft;
+   float spectrum[WINDOW_SIZE/2];
+   WaveletDb4<WINDOW_SIZE> wavelet;
    
  public:
    void add_sample(float voltage) {
+     if (window_full) sorted.erase(window[window_idx]);
+     sorted.insert(voltage);
+     
      window[window_idx] = voltage;
      window_idx = (window_idx + 1) % WINDOW_SIZE;
+     if (window_idx == 0) window_full = true;
    }
    
    bool is_window_ready() {
      return window_idx == 0;
    }
    
-   void extract_features(float* features) {
-     // Time-domain features (14)
+   // The next window starts with the next sample. Slots keep their old
+   // values until overwritten, which is all sorted erases.
+   void restart() {
+     window_idx = 0;
+   }
+   
+   // Just what the cascade's first stage reads (CASCADE_FEATURE_MASK): a
+   // pass over the window, no sort, FFT, wavelet or model
+   void extract_cascade_features(float* features) {
      features[0] = calculate_mean(window, WINDOW_SIZE);
      features[1] = calculate_std(window, WINDOW_SIZE);
-     features[2] = calculate_var(window, WINDOW_SIZE);
-     features[3] = calculate_min(window, WINDOW_SIZE);
-     features[4] = calculate_max(window, WINDOW_SIZE);
      features[5] = calculate_range(window, WINDOW_SIZE);
-     features[6] = calculate_median(window, WINDOW_SIZE);
-     features[7] = calculate_skewness(window, WINDOW_SIZE);
-     features[8] = calculate_kurtosis(window, WINDOW_SIZE);
-     features[9] = calculate_percentile(window, WINDOW_SIZE, 25);
-     features[10] = calculate_percentile(window, WINDOW_SIZE, 75);
+     float abs_diff = 0;
+     for(int i = 0; i < WINDOW_SIZE-1; i++) {
+       abs_diff += abs(window[i+1] - window[i]);
+     }
+     features[11] = abs_diff / (WINDOW_SIZE-1);
+   }
+   
+   // All 30 features, standardized and quantized as they are computed,
+   // into a row of the model's int8 input tensor
+   void extract_features(int8_t* input) {
+     // Time-domain features (14)
+     put(input, 0, calculate_mean(window, WINDOW_SIZE));
+     put(input, 1, calculate_std(window, WINDOW_SIZE));
+     put(input, 2, calculate_var(window, WINDOW_SIZE));
+     put(input, 3, calculate_min(window, WINDOW_SIZE));
+     put(input, 4, calculate_max(window, WINDOW_SIZE));
+     put(input, 5, calculate_range(window, WINDOW_SIZE));
+     put(input, 6, sorted.quantile(0.5f));  // median
+     put(input, 7, calculate_skewness(window, WINDOW_SIZE));
+     put(input, 8, calculate_kurtosis(window, WINDOW_SIZE));
+     put(input, 9, sorted.quantile(0.25f));
+     put(input, 10, sorted.quantile(0.75f));
      
      // Derivatives
      float diff[WINDOW_SIZE-1];
      for(int i = 0; i < WINDOW_SIZE-1; i++) {
        diff[i] = window[i+1] - window[i];
      }
-     features[11] = calculate_mean_abs(diff, WINDOW_SIZE-1);
-     features[12] = calculate_std(diff, WINDOW_SIZE-1);
-     features[13] = calculate_max_abs(diff, WINDOW_SIZE-1);
+     put(input, 11, calculate_mean_abs(diff, WINDOW_SIZE-1));
+     put(input, 12, calculate_std(diff, WINDOW_SIZE-1));
+     put(input, 13, calculate_max_abs(diff, WINDOW_SIZE-1));
      
-     // Frequency-domain features (10) - Simplified FFT
-     extract_fft_features(window, WINDOW_SIZE, &features[14]);
+     // Frequency-domain features (10) - real FFT magnitudes
+     float block[10];
+     fft.magnitudes(window, spectrum);
+     extract_spectral_features(spectrum, WINDOW_SIZE/2, block);
+     for(int k = 0; k < 10; k++) put(input, 14 + k, block[k]);
      
-     // Wavelet features (6) - Simplified
-     extract_wavelet_features(window, WINDOW_SIZE, &features[24]);
+     // Wavelet features (6) - db4 to level 3, as pywt.wavedec
+     wavelet.extract(window, block);
+     for(int k = 0; k < 6; k++) put(input, 24 + k, block[k]);
    }
    
  private:
+   // The training scaler and the tensor's quantization in one multiply-add
+   void put(int8_t* input, int k, float value) {
+     input[k] = quantize_input(model_input_gain, model_input_bias, k, value);
+   }
+   
    float calculate_mean(float* data, int len) {
      float sum = 0;
      for(int i = 0; i < len; i++) sum += data[i];
@@ -135,25 +193,6 @@
      return calculate_max(data, len) - calculate_min(data, len);
    }
    
-   float calculate_median(float* data, int len) {
-     // Simple approximation using sorted subset
-     float temp[WINDOW_SIZE];
-     memcpy(temp, data, len * sizeof(float));
-     
-     // Bubble sort (simple for small arrays)
-     for(int i = 0; i < len-1; i++) {
-       for(int j = 0; j < len-i-1; j++) {
-         if(temp[j] > temp[j+1]) {
-           float swap = temp[j];
-           temp[j] = temp[j+1];
-           temp[j+1] = swap;
-         }
-       }
-     }
-     
-     return temp[len/2];
-   }
-   
    float calculate_skewness(float* data, int len) {
      float mean = calculate_mean(data, len);
      float std = calculate_std(data, len);
@@ -180,25 +219,6 @@
      return (sum_fourth / len) - 3.0;  // Excess kurtosis
    }
    
-   float calculate_percentile(float* data, int len, int percentile) {
-     float temp[WINDOW_SIZE];
-     memcpy(temp, data, len * sizeof(float));
-     
-     // Sort
-     for(int i = 0; i < len-1; i++) {
-       for(int j = 0; j < len-i-1; j++) {
-         if(temp[j] > temp[j+1]) {
-           float swap = temp[j];
-           temp[j] = temp[j+1];
-           temp[j+1] = swap;
-         }
-       }
-     }
-     
-     int idx = (percentile * len) / 100;
-     return temp[idx];
-   }
-   
    float calculate_mean_abs(float* data, int len) {
      float sum = 0;
      for(int i = 0; i < len; i++) {
@@ -215,63 +235,18 @@
      }
      return max_val;
    }
-   
-   void extract_fft_features(float* data, int len, float* features) {
-     // Simplified FFT features (approximation for embedded)
-     // In production, use a proper FFT library like arduinoFFT
-     
-     // For now, use frequency-based approximations
-     float sum_low = 0, sum_mid = 0, sum_high = 0;
-     
-     for(int i = 0; i < len/2; i++) {
-       float val = abs(data[i] - data[i + len/2]);
-       
-       if(i < 10) sum_low += val;
-       else if(i < 50) sum_mid += val;
-       else sum_high += val;
-     }
-     
-     features[0] = sum_low;   // Low freq energy
-     features[1] = sum_mid;   // Mid freq energy
-     features[2] = sum_high;  // High freq energy
-     features[3] = sum_low + sum_mid + sum_high;  // Total energy
-     features[4] = calculate_std(data, len);  // Spectral spread
-     features[5] = calculate_range(data, len); // Spectral range
-     features[6] = 0;  // Dominant freq (placeholder)
-     features[7] = 0;  // Peak magnitude (placeholder)
-     features[8] = 0;  // Centroid (placeholder)
-     features[9] = 0;  // Rolloff (placeholder)
-   }
-   
-   void extract_wavelet_features(float* data, int len, float* features) {
-     // Simplified wavelet approximation (Haar-like)
-     // Decompose into approximation and detail coefficients
-     
-     float approx[len/2];
-     float detail[len/2];
-     
-     for(int i = 0; i < len/2; i++) {
-       approx[i] = (data[2*i] + data[2*i+1]) / 2.0;
-       detail[i] = (data[2*i] - data[2*i+1]) / 2.0;
-     }
-     
-     features[0] = calculate_std(approx, len/2);
-     features[1] = calculate_std(detail, len/2);
-     features[2] = calculate_mean_abs(detail, len/2);
-     features[3] = calculate_max_abs(detail, len/2);
-     features[4] = calculate_var(approx, len/2);
-     features[5] = calculate_var(detail, len/2);
-   }
  };
  
  // ============ GLOBALS ============
  FeatureExtractor extractor;
- float features[NUM_FEATURES];
+ float features[NUM_FEATURES];  // The cascade's, as floats
+ unsigned long queued_since[model_batch];  // Window completion times of queued rows
  
- unsigned long last_sample = 0;
+ TimerSampleSource<SAMPLE_RING_SIZE> source(ADC_PIN);  // Timer ISR samples the ADC
  unsigned long last_inference = 0;
  int detection_count[6] = {0, 0, 0, 0, 0, 0};
  int total_inferences = 0;
+ int early_exits = 0;
  
  // ============ SETUP ============
  void setup() {
@@ -317,52 +292,112 @@
    
    // Initialize TinyML model
    Serial.println("\n🧠 Loading TinyML model...");
-   ml.begin();
-   Serial.print("✓ Model loaded: ");
-   Serial.print(model_data_len);
-   Serial.print(" bytes (");
-   Serial.print(model_data_len / 1024.0, 1);
-   Serial.println(" KB)");
+   // Rows would not line up with a model of another shape or type
+   model_ready = ml.begin();
+   if (model_ready) {
+     Serial.print("✓ Model loaded: ");
+     Serial.print(model_data_len);
+     Serial.print(" bytes (");
+     Serial.print(model_data_len / 1024.0, 1);
+     Serial.print(" KB), ");
+     Serial.print(model_batch);
+     Serial.println(" window(s) per invoke");
+   } else {
+     Serial.println("⚠ Model tensors do not match model.h (int8, model_batch x 30): not classifying");
+   }
    
    show_ready_screen();
    delay(2000);
    
    Serial.println("\n=== Real-time Inference Started ===\n");
+   
+   if (!source.begin(SAMPLE_RATE)) Serial.println("⚠ Sample timer unavailable");
  }
  
  // ============ MAIN LOOP ============
  void loop() {
-   unsigned long now = millis();
-   
-   // Sample at 200Hz
-   if (now - last_sample >= 5) {  // 5ms = 200Hz
-     last_sample = now;
+   // Drain what the timer sampled while the last inference ran
+   Sample s;
+   while (source.read(s)) {
+     // At the low rate only the rate controller's detector sees samples
+     bool full = !ADAPTIVE_RATE || rate.add_sample(s);
+     if (ADAPTIVE_RATE && rate.take_change()) {
+       apply_rate();
+     }
+     if (!full) continue;
      
-     // Read voltage
-     int adc_raw = analogRead(ADC_PIN);
-     float voltage_mv = (adc_raw / 4095.0) * 3300.0;
+     float voltage_mv = (s.adc / 4095.0) * 3300.0;
      
      // Add to feature extractor
      extractor.add_sample(voltage_mv);
      
      // Run inference when window is ready
-     if (extractor.is_window_ready()) {
+     if (model_ready && extractor.is_window_ready()) {
        run_inference();
      }
    }
+   // Caught up: windows queued for a batch run now
+   if (ml.pending()) run_model();
+   
+   // Frames go out on their own clock, not once per inference
+   if (total_inferences && display.due(millis())) {
+     update_display(shown_class, shown_latency);
+   }
+ }
+ 
+ // ============ ADAPTIVE RATE ============
+ void apply_rate() {
+   source.set_rate(rate.rate_hz());
+   rate.rate_applied(micros());
+   // Windows hold full-rate samples only, so features match the model's
+   if (!rate.is_low()) extractor.restart();
+   
+   Serial.print("Rate: ");
+   Serial.print(rate.rate_hz());
+   Serial.print(" Hz");
+   if (rate.is_low()) {
+     Serial.println(" (IDLE, inference paused)");
+   } else {
+     Serial.println(rate.tripped() ? " (activity detector)" : " (probe)");
+   }
  }
  
  // ============ INFERENCE ============
  void run_inference() {
    unsigned long start_time = micros();
    
-   // Extract features
-   extractor.extract_features(features);
-   
-   // Run TinyML model
-   int predicted_class = ml.predict(features);
+   // First stage: a confident IDLE skips full extraction and the model
+   extractor.extract_cascade_features(features);
+   bool early_exit = IDLE_CASCADE && cascade_accepts_idle(features);
+   if (early_exit) {
+     early_exits++;
+     // Windows already queued are older and are reported first
+     if (ml.pending()) run_model();
+     report_window(0, true, micros() - start_time);
+     return;
+   }
    
-   unsigned long inference_time = micros() - start_time;
+   // Into the next row of the input tensor; the model runs on a full batch
+   queued_since[ml.pending()] = start_time;
+   extractor.extract_features(ml.next_row());
+   ml.push_row();
+   if (ml.pending() == model_batch) run_model();
+ }
+ 
+ // One invoke over the queued windows, reported oldest first
+ void run_model() {
+   int rows = ml.pending();
+   ml.invoke();
+   for (int row = 0; row < rows; row++) {
+     report_window(ml.predicted(row), false, micros() - queued_since[row]);
+   }
+ }
+ 
+ // The decoder smooths each window's class over recent windows
+ void report_window(int window_class, bool early_exit, unsigned long inference_time) {
+   decoder.update(window_class);
+   int predicted_class = decoder.current();
+   if (ADAPTIVE_RATE) rate.add_window(predicted_class);
    
    // Update statistics
    detection_count[predicted_class]++;
@@ -373,12 +408,61 @@
    Serial.print(total_inferences);
    Serial.print(" | Activity: ");
    Serial.print(activity_names[predicted_class]);
-   Serial.print(" | Latency: ");
+   Serial.print(" ");
+   Serial.print(decoder.confidence_pct());
+   Serial.print("% (window: ");
+   Serial.print(activity_names[window_class]);
+   Serial.print(") | Latency: ");
    Serial.print(inference_time / 1000.0, 2);
-   Serial.println(" ms");
+   Serial.print(" ms");
+   if (early_exit) Serial.print(" | Early exit");
+   if (source.dropped()) {
+     Serial.print(" | Dropped samples: ");
+     Serial.print(source.dropped());
+   }
+   Serial.println();
+   if (total_inferences % 10 == 0) {
+     Serial.print("   [Display] ");
+     Serial.print(display.frames);
+     Serial.print(" frames, last ");
+     Serial.print(display.last_bytes);
+     Serial.print(" B, avg ");
+     Serial.print(display.avg_bytes());
+     Serial.print(" B of ");
+     Serial.print(OLED_FRAME_BYTES);
+     Serial.println(" B full frame");
+     Serial.print("   [Decoder] ");
+     Serial.print(decoder.changes);
+     Serial.print(" of ");
+     Serial.print(decoder.raw_changes);
+     Serial.println(" class changes kept");
+     Serial.print("   [Cascade] ");
+     Serial.print(early_exits);
+     Serial.print(" of ");
+     Serial.print(total_inferences);
+     Serial.println(" windows exited early");
+     Serial.print("   [Model] ");
+     Serial.print(total_inferences - early_exits);
+     Serial.print(" windows in ");
+     Serial.print(ml.invokes);
+     Serial.print(" invokes of up to ");
+     Serial.println(model_batch);
+     Serial.print("   [Rate] ");
+     Serial.print(rate.low_ms() / 1000.0, 1);
+     Serial.print(" s at ");
+     Serial.print(SAMPLE_RATE / RATE_DIVIDER);
+     Serial.print(" Hz, ");
+     Serial.print(rate.drops);
+     Serial.print(" drops, ");
+     Serial.print(rate.trips);
+     Serial.print(" trips, ");
+     Serial.print(rate.probes);
+     Serial.println(" probes");
+   }
    
-   // Update display
-   update_display(predicted_class, inference_time);
+   // Shown by the next frame
+   shown_class = predicted_class;
+   shown_latency = inference_time;
  }
  
  // ============ DISPLAY FUNCTIONS ============
@@ -390,7 +474,7 @@
    u8g2.drawStr(10, 48, "Side-Channel");
    u8g2.setFont(u8g2_font_6x10_tr);
    u8g2.drawStr(30, 60, "Detector");
-   u8g2.sendBuffer();
+   display.flush(millis());
    delay(2000);
  }
  
@@ -403,7 +487,7 @@
    u8g2.setCursor(10, 58);
    u8g2.print(model_data_len / 1024.0, 1);
    u8g2.print(" KB");
-   u8g2.sendBuffer();
+   display.flush(millis());
  }
  
  void update_display(int predicted_class, unsigned long latency_us) {
@@ -447,5 +531,5 @@
      u8g2.drawBox(50 + i*12, 62 - bar_height, 10, bar_height);
    }
    
-   u8g2.sendBuffer();
+   display.flush(millis());
  }
\ No newline at end of file
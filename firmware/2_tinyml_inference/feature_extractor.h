@@ -0,0 +1,264 @@
+// Streaming feature extractor for the detector sketches, specialized at
+// compile time on the window, the hop and the set of features the model
+// tests. add_sample() keeps the running moments, diff moments, min/max
+// deques, sorted view and spectrum current; extractor[k] computes feature k
+// on first use and memoizes it until the next sample. State and code for
+// features outside FeatureMask are compiled out.
+
+#ifndef FEATURE_EXTRACTOR_H
+#define FEATURE_EXTRACTOR_H
+
+#include <stdint.h>
+#include <math.h>
+#include "streaming_stats.h"
+#include "order_statistics.h"
+#include "rfft.h"
+#include "sliding_dft.h"
+#include "spectral_features.h"
+#include "wavelet_db4.h"
+
+#define NUM_FEATURES 30
+#define SPECTRAL_FIRST 14
+#define WAVELET_FIRST 24
+
+// Bits of features first..first+count-1
+constexpr uint32_t feature_bits(int first, int count = 1) {
+  return ((1UL << count) - 1) << first;
+}
+
+constexpr uint32_t FEATURE_MASK_ALL = feature_bits(0, NUM_FEATURES);
+
+namespace extractor_detail {
+
+// Member that takes no storage when its features are masked out
+template <bool Enabled, typename T>
+struct Slot {
+  T value;
+};
+
+template <typename T>
+struct Slot<false, T> {};
+
+// Per-sample sliding DFT, or a real FFT run when the spectrum is read
+template <bool Streaming, int N>
+struct Spectrum {
+  typedef SlidingDFT<N, N/2> Source;
+};
+
+template <int N>
+struct Spectrum<false, N> {
+  typedef RealFFT<N> Source;
+};
+
+}  // namespace extractor_detail
+
+// StreamingSpectrum: true updates a sliding DFT per sample, false runs a
+// real FFT over the window when a spectral feature is first read.
+template <int WindowSize, int Hop, uint32_t FeatureMask = FEATURE_MASK_ALL,
+          bool StreamingSpectrum = true>
+class FeatureExtractor {
+  static_assert(Hop <= WindowSize, "Hop must not exceed WindowSize");
+  static_assert(NUM_FEATURES <= 32, "computed_mask holds one bit per feature");
+  static_assert((FeatureMask & ~FEATURE_MASK_ALL) == 0, "FeatureMask names unknown features");
+
+  static constexpr bool uses(uint32_t bits) { return (FeatureMask & bits) != 0; }
+
+public:
+  // Which pieces of running state the mask needs
+  static constexpr bool kShape = uses(feature_bits(7, 2));  // skewness, kurtosis
+  static constexpr bool kMoments = uses(feature_bits(0, 3)) || kShape;
+  static constexpr bool kMin = uses(feature_bits(3) | feature_bits(5));
+  static constexpr bool kMax = uses(feature_bits(4) | feature_bits(5));
+  static constexpr bool kSorted = uses(feature_bits(6) | feature_bits(9, 2));
+  static constexpr bool kAbsDiffSum = uses(feature_bits(11));
+  static constexpr bool kDiffMoments = uses(feature_bits(12));
+  static constexpr bool kAbsDiffMax = uses(feature_bits(13));
+  static constexpr bool kSpectral = uses(feature_bits(SPECTRAL_FIRST, NUM_SPECTRAL_FEATURES));
+  static constexpr bool kWavelet = uses(feature_bits(WAVELET_FIRST, NUM_WAVELET_FEATURES));
+  static constexpr bool kWindowCopy = kShape || kWavelet || (kSpectral && !StreamingSpectrum);
+
+  void add_sample(float voltage) {
+    int32_t x = to_fixed(voltage);
+    uint32_t t = sample_count;
+
+    // Oldest sample and the first difference leave the window
+    int32_t oldest = window_full ? ring[ring_head] : 0;
+    if (window_full) {
+      int32_t d_old = ring[(ring_head + 1) % WindowSize] - oldest;
+      if constexpr (kMoments) moments.value.remove(oldest);
+      if constexpr (kSorted) sorted.value.erase(oldest);
+      if constexpr (kDiffMoments) diff_moments.value.remove(d_old);
+      if constexpr (kAbsDiffSum) abs_diff_sum.value -= abs_fixed(d_old);
+      (void)d_old;
+    }
+
+    if (t > 0) {
+      int32_t d = x - last_sample;
+      if constexpr (kDiffMoments) diff_moments.value.add(d);
+      if constexpr (kAbsDiffSum) abs_diff_sum.value += abs_fixed(d);
+      if constexpr (kAbsDiffMax) abs_diff_deque.value.push(t, abs_fixed(d));
+      (void)d;
+    }
+
+    if constexpr (kMoments) moments.value.add(x);
+    if constexpr (kSorted) sorted.value.insert(x);
+    if constexpr (kSpectral && StreamingSpectrum) spectrum_source.value.update(x, oldest);
+    if constexpr (kMin) min_deque.value.push(t, x);
+    if constexpr (kMax) max_deque.value.push(t, x);
+
+    ring[ring_head] = x;
+    ring_head = (ring_head + 1) % WindowSize;
+    if (ring_head == 0) window_full = true;
+
+    last_sample = x;
+    sample_count++;
+    if (--hop_countdown == 0) hop_countdown = Hop;
+
+    // The window moved: every memoized feature is stale
+    computed_mask = 0;
+    window_copied = false;
+  }
+
+  bool is_window_ready() const {
+    return window_full && hop_countdown == Hop;
+  }
+
+  // Feature k of the current window, computed on first use. Features
+  // outside FeatureMask read as 0.
+  float operator[](int k) {
+    if (!(computed_mask & (1UL << k))) compute(k);
+    return values[k];
+  }
+
+  // Features computed for the current window so far
+  int features_computed() const {
+    return __builtin_popcount(computed_mask);
+  }
+
+  void extract_features(float* features) {
+    for(int k = 0; k < NUM_FEATURES; k++) {
+      features[k] = (*this)[k];
+    }
+  }
+
+private:
+  void set(int k, float value) {
+    values[k] = value;
+    computed_mask |= 1UL << k;
+  }
+
+  const float* chronological_window() {
+    if (!window_copied) {
+      for(int i = 0; i < WindowSize; i++) {
+        window.value[i] = from_fixed(ring[(ring_head + i) % WindowSize]);
+      }
+      window_copied = true;
+    }
+    return window.value;
+  }
+
+  void compute(int k) {
+    if (!(FeatureMask & (1UL << k))) {
+      set(k, 0);
+      return;
+    }
+    switch (k) {
+      // Time-domain features (14)
+      case 0: if constexpr (kMoments) set(0, moments.value.mean()); break;
+      case 1: if constexpr (kMoments) set(1, sqrt(moments.value.variance())); break;
+      case 2: if constexpr (kMoments) set(2, moments.value.variance()); break;
+      case 3: if constexpr (kMin) set(3, from_fixed(min_deque.value.top())); break;
+      case 4: if constexpr (kMax) set(4, from_fixed(max_deque.value.top())); break;
+      case 5:  // range
+        if constexpr (kMin && kMax) {
+          set(5, from_fixed(max_deque.value.top()) - from_fixed(min_deque.value.top()));
+        }
+        break;
+      case 6: if constexpr (kSorted) set(6, sorted.value.quantile(0.5f) / FIXED_ONE); break;
+      case 7:
+      case 8: if constexpr (kShape) shape_features(); break;
+      case 9: if constexpr (kSorted) set(9, sorted.value.quantile(0.25f) / FIXED_ONE); break;
+      case 10: if constexpr (kSorted) set(10, sorted.value.quantile(0.75f) / FIXED_ONE); break;
+
+      // Derivative features (3) - std is of the signed diff, as in training
+      case 11:
+        if constexpr (kAbsDiffSum) {
+          set(11, abs_diff_sum.value / ((float)(WindowSize - 1) * FIXED_ONE));
+        }
+        break;
+      case 12: if constexpr (kDiffMoments) set(12, sqrt(diff_moments.value.variance())); break;
+      case 13: if constexpr (kAbsDiffMax) set(13, from_fixed(abs_diff_deque.value.top())); break;
+
+      default:
+        if (k < WAVELET_FIRST) {
+          // Frequency-domain features (10) share one |X[k]| of the window
+          if constexpr (kSpectral) {
+            if constexpr (StreamingSpectrum) {
+              spectrum_source.value.magnitudes(spectrum.value);
+            } else {
+              spectrum_source.value.magnitudes(chronological_window(), spectrum.value);
+            }
+            extract_spectral_features(spectrum.value, WindowSize/2, &values[SPECTRAL_FIRST]);
+            computed_mask |= feature_bits(SPECTRAL_FIRST, NUM_SPECTRAL_FEATURES);
+          }
+        } else {
+          // Wavelet features (6) share one db4 decomposition, as pywt.wavedec
+          if constexpr (kWavelet) {
+            wavelet.value.extract(chronological_window(), &values[WAVELET_FIRST]);
+            computed_mask |= feature_bits(WAVELET_FIRST, NUM_WAVELET_FEATURES);
+          }
+        }
+    }
+  }
+
+  // Skewness and excess kurtosis share one pass over the window; mean and
+  // std come from the running moments
+  void shape_features() {
+    float mean = moments.value.mean();
+    float std = sqrt(moments.value.variance());
+    if(std == 0) {
+      set(7, 0);
+      set(8, 0);
+      return;
+    }
+
+    const float* x = chronological_window();
+    float sum_cubed = 0;
+    float sum_fourth = 0;
+    for(int i = 0; i < WindowSize; i++) {
+      float z = (x[i] - mean) / std;
+      float z3 = z * z * z;
+      sum_cubed += z3;
+      sum_fourth += z3 * z;
+    }
+    set(7, sum_cubed / WindowSize);
+    set(8, (sum_fourth / WindowSize) - 3.0);  // Excess kurtosis
+  }
+
+  typedef typename extractor_detail::Spectrum<StreamingSpectrum, WindowSize>::Source SpectrumSource;
+
+  int32_t ring[WindowSize];     // Fixed-point samples, oldest at ring_head
+  int ring_head = 0;
+  uint32_t sample_count = 0;
+  int32_t last_sample = 0;
+  bool window_full = false;
+  bool window_copied = false;
+  int hop_countdown = WindowSize;
+
+  extractor_detail::Slot<kWindowCopy, float[WindowSize]> window;  // Chronological copy
+  extractor_detail::Slot<kMoments, SlidingMoments> moments;
+  extractor_detail::Slot<kDiffMoments, SlidingMoments> diff_moments;  // Signed first differences
+  extractor_detail::Slot<kAbsDiffSum, int64_t> abs_diff_sum{};
+  extractor_detail::Slot<kMin, MonotonicDeque<WindowSize, false>> min_deque;
+  extractor_detail::Slot<kMax, MonotonicDeque<WindowSize, true>> max_deque;
+  extractor_detail::Slot<kAbsDiffMax, MonotonicDeque<WindowSize - 1, true>> abs_diff_deque;
+  extractor_detail::Slot<kSorted, SortedWindow<int32_t, WindowSize>> sorted;  // Median and quartiles
+  extractor_detail::Slot<kSpectral, float[WindowSize/2]> spectrum;
+  extractor_detail::Slot<kSpectral, SpectrumSource> spectrum_source;
+  extractor_detail::Slot<kWavelet, WaveletDb4<WindowSize>> wavelet;
+
+  float values[NUM_FEATURES];   // Memoized features of the current window
+  uint32_t computed_mask = 0;   // Bit k set once values[k] is valid
+};
+
+#endif  // FEATURE_EXTRACTOR_H
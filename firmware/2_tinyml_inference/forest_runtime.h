@@ -0,0 +1,195 @@
+// Random forest runtimes: per-tree traversal of a flattened node array, and
+// QuickScorer bitvector evaluation of the whole ensemble at once.
+// Tables are emitted by extract_rf_to_cpp.py into random_forest_model.h.
+
+#ifndef FOREST_RUNTIME_H
+#define FOREST_RUNTIME_H
+
+#include <stdint.h>
+#include <string.h>
+
+#define FOREST_LEAF 0xFF
+#define FOREST_MAX_CLASSES 8
+
+// Nodes of each tree are stored in preorder, so a split's left child is
+// always the next node and only the right child needs an index. Leaves
+// reuse that index field for their class id. 8 bytes per node with float
+// thresholds, 6 with int16 thresholds over quantized features.
+template <typename T>
+struct ForestNodeT {
+  T threshold;      // Go left when features[feature] <= threshold
+  uint16_t right;   // Right child (tree-relative), or class id in a leaf
+  uint8_t feature;  // Feature index, or FOREST_LEAF
+  uint8_t reserved;
+};
+
+template <typename T>
+struct ForestT {
+  const ForestNodeT<T>* nodes;
+  const uint32_t* tree_offsets;  // First node of each tree in nodes
+  int num_trees;
+  int num_classes;
+};
+
+typedef ForestNodeT<float> ForestNode;
+typedef ForestT<float> Forest;
+
+// Leaf reached by one tree. The child select is a conditional move, so the
+// only branch per level is the loop test. features is an array or any
+// provider with operator[], so features can be computed on first use.
+template <typename T, typename Features>
+inline int forest_tree_predict(const ForestNodeT<T>* tree, Features&& features) {
+  uint16_t i = 0;
+  while (tree[i].feature != FOREST_LEAF) {
+    const ForestNodeT<T>& n = tree[i];
+    i = features[n.feature] <= n.threshold ? i + 1 : n.right;
+  }
+  return tree[i].right;
+}
+
+// Majority vote over all trees; ties go to the lower class id. votes, if
+// given, receives the per-class counts (num_classes entries).
+template <typename T, typename Features>
+inline int forest_predict(const ForestT<T>& forest, Features&& features,
+                          uint16_t* votes = nullptr) {
+  uint16_t counts[FOREST_MAX_CLASSES] = {0};
+  for (int t = 0; t < forest.num_trees; t++) {
+    counts[forest_tree_predict(&forest.nodes[forest.tree_offsets[t]], features)]++;
+  }
+
+  int best = 0;
+  for (int c = 1; c < forest.num_classes; c++) {
+    if (counts[c] > counts[best]) best = c;
+  }
+  if (votes) {
+    for (int c = 0; c < forest.num_classes; c++) votes[c] = counts[c];
+  }
+  return best;
+}
+
+// ============ QUANTIZED FEATURES ============
+// For parts without an FPU the trees can compare integers only. int16
+// models map each feature once per window to floor((x - offset) * scale),
+// clamped to +-limit, with offset/scale chosen per feature by the generator
+// so every split sorts the training windows exactly as the float split
+// does. int32 models use the float's own bits reordered as a signed
+// integer, which orders exactly like the float and needs no float math.
+struct FeatureQuant {
+  float offset;
+  float scale;
+};
+
+inline int32_t forest_quantize(float x, const FeatureQuant& q, int32_t limit) {
+  float v = (x - q.offset) * q.scale;
+  if (!(v < (float)limit)) return limit;  // NaN goes right, as in the float tree
+  if (v <= -(float)limit) return -limit;
+  int32_t i = (int32_t)v;
+  return i > v ? i - 1 : i;               // floor
+}
+
+inline void forest_quantize_all(const FeatureQuant* quant, const float* features,
+                                int32_t* out, int num_features, int32_t limit) {
+  for (int f = 0; f < num_features; f++) out[f] = forest_quantize(features[f], quant[f], limit);
+}
+
+// Monotonic float -> int32: negative floats have their magnitude bits flipped.
+// NaN of either sign keys above every threshold, so it goes right.
+inline int32_t forest_float_key(float x) {
+  int32_t i;
+  memcpy(&i, &x, sizeof(i));
+  if ((i & 0x7FFFFFFF) > 0x7F800000) return INT32_MAX;
+  return i >= 0 ? i : (i ^ 0x7FFFFFFF);
+}
+
+inline void forest_float_key_all(const float* features, int32_t* out, int num_features) {
+  for (int f = 0; f < num_features; f++) out[f] = forest_float_key(features[f]);
+}
+
+// Quantize-on-read views over a lazy feature provider
+template <typename Features>
+struct QuantizedFeatures {
+  Features& features;
+  const FeatureQuant* quant;
+  int32_t limit;
+  int32_t operator[](int k) const { return forest_quantize(features[k], quant[k], limit); }
+};
+
+template <typename Features>
+struct FloatKeyFeatures {
+  Features& features;
+  int32_t operator[](int k) const { return forest_float_key(features[k]); }
+};
+
+// ============ QUICKSCORER BACKEND ============
+// Every split of every tree, grouped by feature and sorted by threshold.
+// Leaves are numbered left to right per tree; a split whose test fails
+// (!(x <= threshold), so NaN fails it and goes right as in the other
+// backends) rules out the leaves of its left subtree, which are a
+// contiguous range. After all failing splits are applied, the exit leaf of
+// each tree is its lowest surviving bit.
+//
+// Each condition stores that range pre-split into AND masks for the
+// bitvector words it touches; nine in ten fit in a single word.
+struct QsCondition {
+  float threshold;
+  uint32_t mask;       // AND mask for bitvectors[word]
+  uint32_t tail_mask;  // AND mask for bitvectors[word + span] when span > 0
+  uint16_t word;       // First word, counted across all trees
+  uint8_t span;        // Further words touched; the ones in between are zeroed
+  uint8_t reserved;
+};
+
+struct QuickScorer {
+  const QsCondition* conditions;
+  const uint32_t* feature_offsets;  // num_features + 1 entries
+  const uint8_t* leaf_classes;
+  const uint32_t* leaf_offsets;     // First leaf of each tree in leaf_classes
+  int num_features;
+  int num_trees;
+  int num_classes;
+  int words_per_tree;               // 32-bit words per tree bitvector
+};
+
+// bitvectors: num_trees * words_per_tree words of scratch, owned by the caller.
+// Features no split uses are never read.
+template <typename Features>
+inline int quickscorer_predict(const QuickScorer& qs, Features&& features,
+                               uint32_t* bitvectors, uint16_t* votes = nullptr) {
+  int words = qs.num_trees * qs.words_per_tree;
+  for (int i = 0; i < words; i++) bitvectors[i] = ~0u;
+
+  // Feature-major scan; stops at the first split each value passes
+  for (int f = 0; f < qs.num_features; f++) {
+    const QsCondition* c = &qs.conditions[qs.feature_offsets[f]];
+    const QsCondition* end = &qs.conditions[qs.feature_offsets[f + 1]];
+    if (c == end) continue;
+    float x = features[f];
+    for (; c < end && !(x <= c->threshold); c++) {
+      bitvectors[c->word] &= c->mask;
+      if (c->span) {
+        for (int w = 1; w < c->span; w++) bitvectors[c->word + w] = 0;
+        bitvectors[c->word + c->span] &= c->tail_mask;
+      }
+    }
+  }
+
+  uint16_t counts[FOREST_MAX_CLASSES] = {0};
+  for (int t = 0; t < qs.num_trees; t++) {
+    const uint32_t* v = &bitvectors[t * qs.words_per_tree];
+    int w = 0;
+    while (v[w] == 0) w++;
+    int leaf = (w << 5) + __builtin_ctz(v[w]);
+    counts[qs.leaf_classes[qs.leaf_offsets[t] + leaf]]++;
+  }
+
+  int best = 0;
+  for (int c = 1; c < qs.num_classes; c++) {
+    if (counts[c] > counts[best]) best = c;
+  }
+  if (votes) {
+    for (int c = 0; c < qs.num_classes; c++) votes[c] = counts[c];
+  }
+  return best;
+}
+
+#endif  // FOREST_RUNTIME_H
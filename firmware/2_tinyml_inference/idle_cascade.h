@@ -0,0 +1,49 @@
+// Auto-generated by ml_training/extract_rf_to_cpp.py - do not edit
+// IDLE early exit: the first stage of the detectors' cascade
+// Learned from data/processed (3119 windows): precision >= 0.99, depth <= 6,
+// leaves >= 20 windows
+// Exits 46 windows (1.5%), 46 of them IDLE (100.0%),
+// 7.7% of all IDLE windows
+
+#ifndef IDLE_CASCADE_H
+#define IDLE_CASCADE_H
+
+#include <stdint.h>
+
+// Features the first stage reads: mean, std, range, mean_abs_diff.
+// The streaming extractor keeps them as running sums and deques, so they
+// cost O(1) per window.
+static constexpr uint32_t CASCADE_FEATURE_MASK = 0x00000823;
+
+// True when the window is IDLE with confidence and the full extraction
+// and classifier can be skipped. Reads features[k] only as it needs them.
+template <typename Features>
+bool cascade_accepts_idle(Features& features) {
+  if (features[0] <= 1418.8512f) {  // mean
+    return false;
+  } else {
+    if (features[0] <= 1424.01282f) {  // mean
+      if (features[1] <= 24.7015419f) {  // std
+        if (features[0] <= 1422.30005f) {  // mean
+          if (features[1] <= 19.5768833f) {  // std
+            return true;  // 25 of 25 IDLE
+          } else {
+            if (features[11] <= 19.7761116f) {  // mean_abs_diff
+              return false;
+            } else {
+              return true;  // 21 of 21 IDLE
+            }
+          }
+        } else {
+          return false;
+        }
+      } else {
+        return false;
+      }
+    } else {
+      return false;
+    }
+  }
+}
+
+#endif  // IDLE_CASCADE_H
@@ -0,0 +1,92 @@
+// TFLite Micro model with int8 input, fed in place
+// The sketch's extractor writes each feature straight into a row of the
+// interpreter's input tensor, standardized and quantized in one multiply-add
+// (model_input_gain/model_input_bias, generated into model.h with the
+// training StandardScaler folded in). No float feature vector is copied,
+// scaled and quantized on every invoke.
+//
+// A model exported with model_batch > 1 takes that many windows per invoke.
+// Rows are filled one window at a time, and invoke() runs however many are
+// queued; rows past them hold stale windows whose scores are ignored.
+
+#ifndef INT8_MODEL_H
+#define INT8_MODEL_H
+
+#include <math.h>
+#include <stdint.h>
+#include <TensorFlowLite_ESP32.h>
+#include "tensorflow/lite/micro/all_ops_resolver.h"
+#include "tensorflow/lite/micro/micro_error_reporter.h"
+#include "tensorflow/lite/micro/micro_interpreter.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+
+// Feature k of a window as the model's int8 input; NaN reads as the minimum
+inline int8_t quantize_input(const float* gain, const float* bias, int k, float x) {
+  float q = x * gain[k] + bias[k];
+  if (!(q > -128.0f)) return -128;
+  if (q > 127.0f) return 127;
+  return (int8_t)lroundf(q);
+}
+
+template <int Inputs, int Outputs, int Batch, int ArenaSize>
+class Int8Model {
+public:
+  explicit Int8Model(const unsigned char* model_data) : model_data(model_data) {}
+
+  // False if the model is not int8 Batch x Inputs in, Batch x Outputs out
+  bool begin() {
+    const tflite::Model* model = tflite::GetModel(model_data);
+    if (model->version() != TFLITE_SCHEMA_VERSION) return false;
+    static tflite::MicroErrorReporter reporter;
+    static tflite::AllOpsResolver resolver;
+    static tflite::MicroInterpreter static_interpreter(model, resolver, arena, ArenaSize, &reporter);
+    interpreter = &static_interpreter;
+    if (interpreter->AllocateTensors() != kTfLiteOk) return false;
+
+    input = interpreter->input(0);
+    output = interpreter->output(0);
+    return input->type == kTfLiteInt8 && input->bytes == (size_t)Batch * Inputs &&
+           output->type == kTfLiteInt8 && output->bytes == (size_t)Batch * Outputs;
+  }
+
+  // The next free row, or nullptr when the batch is full
+  int8_t* next_row() {
+    if (queued == Batch) return nullptr;
+    return input->data.int8 + queued * Inputs;
+  }
+
+  // The row from next_row() is filled
+  void push_row() { queued++; }
+
+  int pending() const { return queued; }
+
+  // Runs the queued rows; their classes are then predicted(0) onwards
+  bool invoke() {
+    queued = 0;
+    invokes++;
+    return interpreter->Invoke() == kTfLiteOk;
+  }
+
+  // Highest int8 score wins: quantization is monotonic, so this is the
+  // argmax of the dequantized softmax too
+  int predicted(int row) const {
+    const int8_t* scores = output->data.int8 + row * Outputs;
+    int best = 0;
+    for (int c = 1; c < Outputs; c++) {
+      if (scores[c] > scores[best]) best = c;
+    }
+    return best;
+  }
+
+  uint32_t invokes = 0;
+
+private:
+  const unsigned char* model_data;
+  tflite::MicroInterpreter* interpreter = nullptr;
+  TfLiteTensor* input = nullptr;
+  TfLiteTensor* output = nullptr;
+  int queued = 0;
+  alignas(16) uint8_t arena[ArenaSize];
+};
+
+#endif  // INT8_MODEL_H
@@ -0,0 +1,136 @@
+// ESP32 hardware-timer mitigation pulse generator
+// start() precomputes the whole pulse pattern for a class's profile, as
+// high/low durations, and a second hardware timer plays it: each alarm's ISR
+// flips the pin and loads the next duration. The caller returns at once, so
+// masking no longer holds up the loop that reports and draws, and a pulse
+// train lasts as long as the profile asks rather than as long as the caller
+// can afford to spin.
+
+#ifndef MITIGATION_H
+#define MITIGATION_H
+
+#include <Arduino.h>
+
+#define MITIGATION_TIMER 1        // SAMPLE_TIMER is 0
+#define MITIGATION_MAX_EDGES 512  // 256 pulses, 2 KB
+
+// Intensity and duration for one activity class
+struct MitigationProfile {
+  uint8_t pulses;        // Per train; 0: no mitigation
+  uint16_t min_us;       // Each high and low phase is random in [min_us, max_us)
+  uint16_t max_us;
+  uint16_t every_ms;     // Train period; 0: a single train
+  uint16_t duration_ms;  // How long trains repeat
+};
+
+class MitigationEngine {
+public:
+  explicit MitigationEngine(uint8_t pin) : pin(pin) {}
+
+  bool begin() {
+    instance = this;
+    pinMode(pin, OUTPUT);
+    digitalWrite(pin, LOW);
+#if ESP_ARDUINO_VERSION_MAJOR >= 3
+    timer = timerBegin(1000000);
+    if (!timer) return false;
+    timerStop(timer);
+    timerAttachInterrupt(timer, on_timer);
+#else
+    timer = timerBegin(MITIGATION_TIMER, 80, true);  // 80 MHz APB / 80
+    if (!timer) return false;
+    timerAttachInterrupt(timer, on_timer, true);
+#endif
+    return true;
+  }
+
+  // Replaces whatever pattern is playing. False if the profile is empty.
+  bool start(const MitigationProfile& p) {
+    if (!timer || !p.pulses || p.max_us <= p.min_us) return false;
+    stop();
+
+    int trains = p.every_ms && p.duration_ms > p.every_ms ? p.duration_ms / p.every_ms : 1;
+    count = 0;
+    for (int t = 0; t < trains; t++) {
+      uint32_t train_us = 0;
+      for (int i = 0; i < p.pulses && count + 2 <= MITIGATION_MAX_EDGES; i++) {
+        edges[count++] = random(p.min_us, p.max_us);
+        edges[count++] = random(p.min_us, p.max_us);
+        train_us += edges[count - 2] + edges[count - 1];
+      }
+      // The last low phase runs on to the next train
+      if (t + 1 < trains && p.every_ms * 1000u > train_us) edges[count - 1] += p.every_ms * 1000u - train_us;
+      if (count + 2 > MITIGATION_MAX_EDGES) break;
+    }
+
+    next = 1;
+    level = HIGH;
+    running = true;
+    started++;
+    digitalWrite(pin, HIGH);
+    arm(edges[0], true);
+    return true;
+  }
+
+  void stop() {
+    if (!running) return;
+#if ESP_ARDUINO_VERSION_MAJOR >= 3
+    timerStop(timer);
+#else
+    timerAlarmDisable(timer);
+#endif
+    digitalWrite(pin, LOW);
+    running = false;
+  }
+
+  bool active() const { return running; }
+
+  uint32_t started = 0;           // Patterns started
+  volatile uint32_t pulses = 0;   // Pulses played, over all patterns
+
+private:
+  void IRAM_ATTR arm(uint32_t us, bool restart) {
+#if ESP_ARDUINO_VERSION_MAJOR >= 3
+    if (restart) {
+      timerWrite(timer, 0);
+      timerStart(timer);
+    }
+    timerAlarm(timer, us, true, 0);
+#else
+    if (restart) timerWrite(timer, 0);
+    timerAlarmWrite(timer, us, true);
+    if (restart) timerAlarmEnable(timer);
+#endif
+  }
+
+  // The alarm that ends phase next - 1: flip the pin and time the next phase
+  static void IRAM_ATTR on_timer() {
+    MitigationEngine* self = instance;
+    if (self->next >= self->count) {
+#if ESP_ARDUINO_VERSION_MAJOR >= 3
+      timerStop(self->timer);
+#else
+      timerAlarmDisable(self->timer);
+#endif
+      self->running = false;
+      return;
+    }
+    self->level = !self->level;
+    digitalWrite(self->pin, self->level);
+    if (self->level == LOW) self->pulses++;
+    self->arm(self->edges[self->next++], false);
+  }
+
+  static MitigationEngine* instance;
+  hw_timer_t* timer = nullptr;
+  uint8_t pin;
+  uint32_t edges[MITIGATION_MAX_EDGES];
+  volatile int count = 0;
+  volatile int next = 0;
+  volatile uint8_t level = LOW;
+  volatile bool running = false;
+};
+
+MitigationEngine* MitigationEngine::instance = nullptr;
+
+#endif  // MITIGATION_H
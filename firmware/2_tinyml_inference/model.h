@@ -6,1072 +6,1096 @@
 #define MODEL_H
 
 const unsigned char model_data[] = {
-  0x1c,0x00,0x00,0x00,0x54,0x46,0x4c,0x33,0x14,0x00,0x20,0x00
-  0x1c,0x00,0x18,0x00,0x14,0x00,0x10,0x00,0x0c,0x00,0x00,0x00
-  0x08,0x00,0x04,0x00,0x14,0x00,0x00,0x00,0x1c,0x00,0x00,0x00
-  0x88,0x00,0x00,0x00,0xe0,0x00,0x00,0x00,0x6c,0x14,0x00,0x00
-  0x7c,0x14,0x00,0x00,0xec,0x30,0x00,0x00,0x03,0x00,0x00,0x00
-  0x01,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x12,0xe9,0xff,0xff
-  0x0c,0x00,0x00,0x00,0x1c,0x00,0x00,0x00,0x3c,0x00,0x00,0x00
-  0x0f,0x00,0x00,0x00,0x73,0x65,0x72,0x76,0x69,0x6e,0x67,0x5f
-  0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x00,0x01,0x00,0x00,0x00
-  0x04,0x00,0x00,0x00,0x94,0xff,0xff,0xff,0x1a,0x00,0x00,0x00
-  0x04,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x6f,0x75,0x74,0x70
-  0x75,0x74,0x5f,0x30,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00
-  0x04,0x00,0x00,0x00,0x5a,0xeb,0xff,0xff,0x04,0x00,0x00,0x00
-  0x0b,0x00,0x00,0x00,0x69,0x6e,0x70,0x75,0x74,0x5f,0x6c,0x61
-  0x79,0x65,0x72,0x00,0x02,0x00,0x00,0x00,0x34,0x00,0x00,0x00
-  0x04,0x00,0x00,0x00,0xdc,0xff,0xff,0xff,0x1d,0x00,0x00,0x00
-  0x04,0x00,0x00,0x00,0x13,0x00,0x00,0x00,0x43,0x4f,0x4e,0x56
-  0x45,0x52,0x53,0x49,0x4f,0x4e,0x5f,0x4d,0x45,0x54,0x41,0x44
-  0x41,0x54,0x41,0x00,0x08,0x00,0x0c,0x00,0x08,0x00,0x04,0x00
-  0x08,0x00,0x00,0x00,0x1c,0x00,0x00,0x00,0x04,0x00,0x00,0x00
-  0x13,0x00,0x00,0x00,0x6d,0x69,0x6e,0x5f,0x72,0x75,0x6e,0x74
-  0x69,0x6d,0x65,0x5f,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x00
-  0x1e,0x00,0x00,0x00,0x88,0x13,0x00,0x00,0x80,0x13,0x00,0x00
-  0x6c,0x13,0x00,0x00,0x50,0x13,0x00,0x00,0x3c,0x13,0x00,0x00
-  0x20,0x13,0x00,0x00,0x04,0x13,0x00,0x00,0xdc,0x12,0x00,0x00
-  0x4c,0x11,0x00,0x00,0x3c,0x10,0x00,0x00,0x2c,0x08,0x00,0x00
-  0x9c,0x07,0x00,0x00,0x8c,0x01,0x00,0x00,0x3c,0x01,0x00,0x00
-  0xfc,0x00,0x00,0x00,0xf4,0x00,0x00,0x00,0xec,0x00,0x00,0x00
-  0xe4,0x00,0x00,0x00,0xdc,0x00,0x00,0x00,0xd4,0x00,0x00,0x00
-  0xcc,0x00,0x00,0x00,0xc4,0x00,0x00,0x00,0xbc,0x00,0x00,0x00
-  0xb4,0x00,0x00,0x00,0xac,0x00,0x00,0x00,0xa4,0x00,0x00,0x00
-  0x9c,0x00,0x00,0x00,0x94,0x00,0x00,0x00,0x74,0x00,0x00,0x00
-  0x04,0x00,0x00,0x00,0x4a,0xec,0xff,0xff,0x04,0x00,0x00,0x00
-  0x60,0x00,0x00,0x00,0x0c,0x00,0x00,0x00,0x08,0x00,0x0e,0x00
-  0x08,0x00,0x04,0x00,0x08,0x00,0x00,0x00,0x10,0x00,0x00,0x00
-  0x28,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x08,0x00,0x04,0x00
-  0x06,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00
-  0xeb,0x03,0x00,0x00,0x0c,0x00,0x18,0x00,0x14,0x00,0x10,0x00
-  0x0c,0x00,0x04,0x00,0x0c,0x00,0x00,0x00,0x64,0x51,0x24,0x32
-  0xbc,0xa1,0x16,0x0d,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00
-  0x04,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x32,0x2e,0x32,0x30
-  0x2e,0x30,0x00,0x00,0xb6,0xec,0xff,0xff,0x04,0x00,0x00,0x00
-  0x10,0x00,0x00,0x00,0x31,0x2e,0x31,0x34,0x2e,0x30,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xb8,0xd1,0xff,0xff
-  0xbc,0xd1,0xff,0xff,0xc0,0xd1,0xff,0xff,0xc4,0xd1,0xff,0xff
-  0xc8,0xd1,0xff,0xff,0xcc,0xd1,0xff,0xff,0xd0,0xd1,0xff,0xff
-  0xd4,0xd1,0xff,0xff,0xd8,0xd1,0xff,0xff,0xdc,0xd1,0xff,0xff
-  0xe0,0xd1,0xff,0xff,0xe4,0xd1,0xff,0xff,0xe8,0xd1,0xff,0xff
-  0x06,0xed,0xff,0xff,0x04,0x00,0x00,0x00,0x30,0x00,0x00,0x00
-  0x7f,0xfe,0x85,0x26,0xcc,0x7f,0x5c,0xa1,0x81,0x10,0x7f,0x88
-  0xb8,0x7f,0x05,0xca,0xac,0x81,0x32,0x3b,0x7f,0xf1,0xb9,0x81
-  0x57,0x7f,0x7a,0x24,0xbc,0x81,0x44,0x7f,0x79,0x13,0x81,0xa9
-  0x81,0x63,0x00,0x7f,0x59,0xdf,0x7f,0xcd,0xf2,0x44,0xb1,0x81
-  0x42,0xed,0xff,0xff,0x04,0x00,0x00,0x00,0x40,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x8e,0xed,0xff,0xff,0x04,0x00,0x00,0x00
-  0x00,0x06,0x00,0x00,0xf2,0xab,0x84,0xbf,0x63,0xc2,0xa5,0x55
-  0x74,0xf4,0xe4,0x72,0x7c,0xd4,0x09,0x1e,0x45,0x96,0x7f,0x2b
-  0xc9,0x99,0x4d,0x63,0xe1,0x30,0x85,0x27,0x17,0x1b,0x08,0xc0
-  0xd8,0x05,0xba,0x1a,0x79,0x18,0x72,0x91,0xa6,0xdf,0xe2,0x67
-  0x7a,0xcf,0xb2,0xc2,0x25,0xc6,0x66,0xee,0xef,0x79,0x8c,0x0c
-  0x81,0x93,0x2f,0x23,0xa2,0xfb,0x05,0x44,0xb3,0xff,0xee,0xc5
-  0x9d,0xc5,0x03,0xe0,0x5d,0xdf,0xd9,0xea,0x88,0x0f,0xb0,0x51
-  0xf7,0xb4,0xc5,0x4c,0x56,0xd8,0xde,0x05,0xb1,0x38,0xea,0xbd
-  0x0a,0x11,0x86,0x5c,0xa1,0x43,0x8c,0xb6,0x40,0xdf,0xc1,0xb4
-  0xf7,0x6d,0x3a,0xba,0x2d,0xca,0xe6,0x38,0x82,0x81,0x00,0x40
-  0x3d,0x4d,0xc6,0x73,0x58,0x02,0xe4,0xef,0x12,0x17,0x25,0x1a
-  0x15,0x8b,0xfd,0xac,0x45,0xb7,0xb3,0xf7,0x5c,0x05,0x15,0xe8
-  0x3e,0xab,0x04,0xc9,0x97,0xbb,0x4f,0x00,0xcf,0xb8,0xb2,0xcc
-  0xc2,0xdc,0x12,0xf4,0x01,0x6b,0x4b,0x90,0x23,0x23,0x6f,0x66
-  0xd0,0xd8,0x7b,0x31,0x9f,0xe6,0x27,0xbe,0x42,0xe5,0xe1,0x85
-  0x38,0x9a,0x3e,0x7b,0x9a,0x1e,0xb3,0x72,0x7f,0xd5,0xb6,0xa4
-  0x1f,0x69,0x98,0x77,0xcb,0xa0,0xd8,0x37,0x34,0x25,0xa1,0xc1
-  0xc6,0x4d,0x14,0x68,0xc2,0x24,0x78,0xdd,0xc6,0x57,0x90,0x20
-  0x57,0x8d,0x6b,0x75,0x2e,0x95,0xd0,0xb5,0x43,0x25,0x99,0x2d
-  0xa9,0xff,0xbf,0x0e,0x01,0xc5,0x0b,0x6d,0xed,0xf1,0x0c,0x7f
-  0xaa,0xd4,0x4a,0x06,0xc2,0x15,0xe2,0x21,0x99,0x94,0x3d,0x68
-  0x4d,0xdd,0x70,0x9c,0xa0,0xfe,0x67,0x86,0xa0,0x66,0x83,0x99
-  0xb6,0x89,0x81,0x3b,0x31,0x26,0x52,0xcc,0xe4,0x8a,0x4e,0x48
-  0x70,0x3b,0xf3,0x1a,0xbc,0xde,0xb8,0x7c,0xdd,0x71,0xea,0xea
-  0xd3,0x13,0x87,0xd2,0x3b,0xd5,0x2e,0x23,0x42,0xc3,0x61,0x14
-  0x10,0x89,0x9f,0xcb,0xdd,0x05,0x02,0xa6,0xb9,0x50,0x26,0x66
-  0xc0,0x17,0x4e,0xc6,0xa3,0xad,0xef,0x4e,0xdd,0xe2,0x18,0xfd
-  0x44,0x81,0xb2,0x03,0x66,0xea,0x50,0x35,0x5a,0xfb,0x22,0xee
-  0x69,0x10,0x42,0xaa,0x4d,0x4f,0x17,0xaf,0xeb,0x86,0x6f,0x39
-  0x5a,0x99,0x06,0x1e,0x87,0x32,0x4f,0xde,0x05,0x73,0xf5,0xe8
-  0xe7,0x2b,0x56,0x8d,0x17,0xd1,0x94,0x44,0x70,0x83,0x3b,0xd1
-  0x81,0x53,0xbd,0xa3,0xa4,0xb2,0x45,0xf6,0x4c,0x07,0x0e,0x72
-  0xcd,0x62,0xb1,0x5d,0x2c,0xcd,0x1f,0x59,0xdc,0x54,0xb1,0xba
-  0x5d,0x09,0xfb,0x4f,0x56,0x27,0x21,0xde,0x4e,0xe5,0x00,0xd9
-  0x8f,0x9a,0x28,0x6d,0x48,0x28,0x4e,0x8d,0xe4,0x92,0xd9,0xee
-  0x12,0xca,0xa7,0x0f,0x81,0x27,0xa9,0x1a,0x66,0xbe,0x57,0x16
-  0xa6,0x48,0x9a,0xdd,0x42,0xe8,0x4b,0x8b,0x68,0x07,0x24,0x7e
-  0xaa,0xc9,0x8a,0x39,0x04,0x6d,0xe8,0xa0,0x73,0x30,0xbc,0xd6
-  0xe0,0x00,0x3f,0xa5,0x67,0xe1,0xdc,0x37,0xc0,0xcb,0xca,0x2b
-  0x4f,0x2e,0x99,0xdc,0x77,0xf5,0xda,0x75,0x51,0x38,0xf0,0xee
-  0x4a,0x81,0x0d,0x6d,0xea,0xa6,0x1a,0xf3,0x05,0x05,0x54,0x2b
-  0x99,0xf2,0xce,0x67,0xb7,0x98,0x89,0x60,0xfd,0x36,0xe2,0xf2
-  0xe8,0x4c,0x76,0x7f,0x7b,0x16,0x22,0x05,0xc1,0x85,0x89,0xa0
-  0x40,0x5e,0xe7,0x21,0x0c,0xdc,0xdc,0xda,0xa6,0x28,0x14,0x7b
-  0x46,0x8b,0x99,0xf0,0xeb,0x3e,0xd0,0x29,0x2c,0x01,0x5a,0xe7
-  0x40,0x19,0x05,0xf2,0xf8,0x47,0x81,0xc3,0xb4,0xfe,0x95,0x82
-  0x09,0xa4,0xf2,0x5b,0xfd,0xba,0xc4,0x79,0xe0,0x5e,0xb2,0xfb
-  0x02,0x98,0x58,0x42,0x51,0x06,0xde,0x67,0x4d,0x2d,0x27,0x28
-  0xf8,0x06,0xd7,0xef,0xb0,0xbb,0xc8,0xb8,0x12,0x5c,0x26,0x6f
-  0x0b,0x71,0x96,0x2a,0x38,0x6d,0x5a,0x9e,0x9a,0xf1,0x8e,0x87
-  0x66,0x7f,0xa7,0x9b,0x48,0x46,0xc2,0xda,0x41,0xef,0x37,0x32
-  0xff,0x8e,0x19,0x92,0xd2,0xf2,0xcc,0x59,0x69,0xca,0xe3,0xb2
-  0x53,0x21,0x6e,0xa5,0x15,0x2a,0xbf,0x3e,0x3b,0x44,0xba,0x9a
-  0x63,0x60,0xac,0x53,0x09,0x34,0x28,0x11,0x81,0xe6,0x28,0xd2
-  0x0a,0x71,0x63,0x27,0xe3,0x20,0x9f,0x37,0x1c,0xb7,0x3f,0x9f
-  0xa4,0x0a,0x25,0x31,0xc1,0xef,0xc2,0x5f,0x8b,0x12,0x23,0x54
-  0x4b,0x30,0x19,0xc9,0x9a,0x88,0x67,0xb9,0x5a,0xd6,0xce,0x3f
-  0xc4,0x6c,0x23,0xa4,0x53,0x45,0x48,0x96,0x08,0xf7,0x50,0x51
-  0x5c,0x0a,0xaf,0x66,0x63,0xba,0x68,0x0e,0x83,0x41,0xf2,0x9d
-  0xd8,0x98,0x34,0x86,0x15,0xce,0x63,0x23,0x5f,0x32,0xe6,0xa7
-  0x23,0xf1,0x81,0xe4,0xf7,0x94,0xeb,0x10,0x86,0x0c,0x1f,0xdb
-  0x98,0x7b,0x94,0x68,0x7e,0x8f,0x26,0x60,0xc0,0xea,0x9e,0x8f
-  0x15,0xd4,0x96,0x81,0x35,0x05,0x3c,0xc0,0x1d,0xaf,0x35,0x54
-  0x03,0x68,0x14,0x1c,0xc8,0x5f,0xf6,0x35,0x45,0x83,0x6b,0xc0
-  0x78,0xf5,0xbd,0xf8,0x43,0x49,0xa0,0x55,0xd6,0xc0,0x51,0xe4
-  0x81,0x0d,0x5e,0xab,0xd0,0xcf,0xa2,0x9e,0xda,0xca,0x82,0xab
-  0x5e,0x15,0xff,0xac,0x59,0x8f,0x26,0x2b,0x58,0x46,0xfa,0x20
-  0xd1,0x4f,0x4c,0x1d,0xf6,0x51,0x35,0x25,0x85,0xbc,0x57,0x67
-  0x8f,0x41,0x3c,0xc2,0xb8,0x2a,0x81,0xd5,0x96,0x22,0x5b,0xf2
-  0x36,0x65,0x10,0xd0,0xe1,0x16,0x4a,0x18,0x93,0x19,0xf0,0x07
-  0xa5,0x33,0xd1,0x17,0x62,0xb3,0xf5,0x4a,0xfd,0xa9,0xd9,0x67
-  0x4e,0x34,0xc5,0x17,0x36,0x12,0x49,0x3e,0x2f,0xc0,0x5d,0xdc
-  0x63,0xa8,0x61,0xfb,0x33,0x52,0x12,0x83,0xb3,0x50,0x55,0x62
-  0xb1,0x92,0x26,0x1a,0x82,0x91,0x1d,0x1a,0xc7,0xd9,0x13,0xe9
-  0x23,0x20,0xa6,0x8b,0x97,0x5f,0x1b,0x7f,0x9c,0xcd,0xf5,0x33
-  0x53,0x2d,0x4a,0x4c,0xca,0x55,0xd8,0xdd,0x8d,0x9f,0x4e,0xdd
-  0x34,0xf4,0x9d,0xf2,0x5a,0x8d,0xe4,0x95,0x11,0xa2,0x5b,0xc8
-  0x5d,0xfb,0x1f,0x2b,0x83,0x8e,0xe6,0xc9,0x27,0x99,0xfd,0x83
-  0x03,0xbf,0xe7,0x64,0x15,0xb0,0x40,0x2b,0x85,0xd0,0xe8,0x60
-  0xdd,0x16,0xb7,0xbb,0x36,0x8d,0x7f,0x4d,0x35,0x35,0x07,0x39
-  0xba,0xbf,0xfe,0x06,0x20,0xc6,0x1b,0x60,0x54,0xb9,0x9d,0xc2
-  0xf8,0x16,0xcb,0x59,0xbf,0x13,0x08,0xbb,0xcd,0xc1,0x97,0xee
-  0x32,0xbb,0xa2,0x21,0x81,0x83,0xbb,0x8a,0x2a,0xc8,0xf0,0x1d
-  0xb0,0x4f,0x3a,0x4b,0x38,0xdd,0x1a,0x26,0x14,0xd2,0xae,0x21
-  0xb5,0xe6,0xa4,0xa8,0x3c,0x52,0xb4,0xd7,0x59,0x22,0xb0,0xb8
-  0xdd,0xba,0xab,0xd8,0x05,0x96,0xab,0x81,0x8a,0x10,0xa0,0xeb
-  0xab,0xca,0x1d,0xf8,0x4b,0xb4,0x9e,0x39,0x17,0xfd,0xb6,0x07
-  0xa0,0xfe,0x33,0xf8,0xcc,0x01,0xe3,0xbc,0x1d,0x07,0xd1,0x3e
-  0xce,0x25,0x3d,0x11,0x9f,0x13,0xc0,0xa4,0xac,0x40,0xbd,0xa6
-  0x1a,0x66,0xfc,0xd0,0xc5,0x46,0xd3,0x7b,0x2a,0x71,0x78,0x95
-  0xd7,0x9c,0xfd,0xec,0xe8,0x43,0xd9,0xff,0x22,0x5e,0xab,0x40
-  0xbe,0x5d,0x21,0x66,0xfb,0xbb,0xec,0x65,0x9c,0x7f,0x1b,0x46
-  0x7b,0xdf,0x76,0x97,0x2e,0x52,0x29,0xaa,0xcc,0x82,0xd4,0xe4
-  0xc0,0x5a,0xfd,0x1a,0x01,0xec,0x25,0xb7,0x23,0xb6,0xff,0xa2
-  0x97,0x64,0x63,0x1a,0x0b,0xa4,0xd7,0x62,0x4c,0x55,0x4f,0x23
-  0x00,0x47,0xfe,0x70,0x5c,0xfa,0x99,0x99,0x47,0xfe,0x53,0xb5
-  0x65,0x17,0x81,0x8d,0xd8,0x26,0x29,0x89,0x7d,0x27,0x79,0x58
-  0x27,0xf9,0xce,0x1a,0xbb,0x0f,0x95,0x00,0x4b,0xd9,0xc4,0x61
-  0xab,0x45,0x58,0xb1,0xd4,0xaa,0x9c,0x69,0xf4,0x9b,0xe9,0x2b
-  0x43,0x4b,0x37,0x18,0xf4,0x59,0xb6,0x1c,0x7f,0x01,0xb2,0x04
-  0x48,0x5f,0x02,0xe2,0x79,0x8f,0xaf,0xe6,0xb8,0xf8,0x56,0x79
-  0xb8,0x6c,0x50,0x79,0xa2,0xf3,0x5d,0xd2,0xd4,0x7f,0x1c,0xaa
-  0x48,0xf0,0x13,0x81,0x12,0xf8,0x65,0x0e,0xf9,0x62,0x18,0x84
-  0x84,0x0a,0x1f,0x70,0x6b,0xc5,0xa5,0x86,0xcc,0x85,0xe7,0x01
-  0x32,0x66,0xb4,0x50,0xf7,0x89,0xd6,0xab,0x19,0xf6,0x6a,0x3a
-  0x42,0x9e,0x05,0x68,0xbb,0x11,0x14,0x61,0x36,0x29,0xb2,0x1d
-  0xcf,0xe3,0x14,0x09,0x5e,0x07,0x17,0xe6,0xa0,0x3a,0xd4,0x08
-  0x63,0xe7,0x97,0x41,0x2d,0x9c,0xba,0x00,0x48,0xd4,0xfe,0xea
-  0x81,0xa8,0xa4,0xd7,0x73,0x0c,0xdc,0x8f,0x22,0x6e,0x37,0xbf
-  0x3b,0x59,0xa6,0x8a,0x5e,0x62,0x09,0xc5,0x59,0xc4,0x1e,0xb7
-  0xf0,0x14,0x98,0x39,0x3e,0xa4,0x63,0x15,0x53,0x13,0xb5,0x9d
-  0xad,0xe8,0xad,0x03,0x8b,0xab,0xd8,0x95,0x81,0xc1,0x90,0xf1
-  0xdc,0x3d,0x00,0x5e,0x94,0x30,0xe1,0x8a,0x9f,0x62,0x74,0x0d
-  0x02,0xce,0x46,0x44,0xe6,0x4c,0xdd,0xaa,0x48,0x73,0x81,0x9c
-  0x66,0xd5,0x2c,0x9d,0x84,0xb9,0xb5,0xf1,0x95,0xe6,0x37,0x64
-  0x91,0x05,0x06,0xa9,0x2e,0x12,0x56,0xd4,0x11,0x06,0x43,0x5c
-  0x08,0x84,0x3e,0x3e,0x0d,0x5b,0x83,0xe3,0xcd,0xb1,0x3f,0x11
-  0xac,0x00,0x3b,0xe3,0xf0,0xa6,0x00,0xff,0x0d,0x34,0x5c,0x81
-  0xa9,0xf2,0x68,0x44,0x9c,0xa4,0x74,0xb4,0x39,0xc2,0xd8,0x2f
-  0x3b,0x9b,0xca,0xd5,0x97,0xa2,0x07,0x3a,0xc4,0xb7,0xab,0x98
-  0xa7,0x93,0xfd,0xd9,0x9e,0x12,0x43,0x84,0x56,0x53,0x40,0x9c
-  0xa3,0x0b,0xf1,0x95,0xdf,0xe9,0x03,0xa2,0x82,0x63,0xc0,0x81
-  0x25,0x4b,0x3a,0xcc,0x47,0x95,0xf3,0xca,0xfd,0x49,0x8c,0x2e
-  0x0f,0x92,0xc2,0x24,0x40,0x93,0xfb,0x68,0x5e,0xa9,0xd2,0x90
-  0x8b,0x81,0x5e,0xe3,0x7e,0x0c,0x0b,0x8e,0x91,0x6a,0xc6,0x43
-  0x8c,0x39,0xf5,0x01,0x03,0xb4,0xa7,0xeb,0xf0,0x5b,0x97,0xa3
-  0x10,0x15,0xc0,0x3a,0x27,0x1f,0xa1,0xa3,0x81,0x98,0x5e,0xcd
-  0xe6,0x58,0x8a,0xaa,0xb0,0xe4,0xdb,0x98,0xcb,0xc3,0x9b,0xc4
-  0x7f,0x74,0x5f,0x34,0x9a,0xf3,0xff,0xff,0x04,0x00,0x00,0x00
-  0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x26,0xf4,0xff,0xff,0x04,0x00,0x00,0x00,0x00,0x08,0x00,0x00
-  0x4d,0x0c,0x9d,0x22,0xc0,0xa9,0x85,0x51,0xf7,0x60,0x6b,0xcf
-  0x60,0x17,0x91,0x1b,0x82,0x1a,0x87,0x81,0x7d,0x88,0x74,0xb4
-  0x5a,0x34,0x76,0x8d,0xbc,0x2f,0x03,0x02,0x49,0x9b,0x14,0x8b
-  0x48,0xac,0x5e,0x9d,0x4f,0xe9,0x84,0xf5,0x44,0x50,0x25,0x94
-  0x4f,0xa4,0xd8,0x1f,0x5e,0xf1,0x21,0x6c,0x81,0x12,0xd1,0x59
-  0x0f,0x53,0x23,0xbf,0x7f,0xb6,0x43,0x2a,0x02,0xf9,0x07,0xc3
-  0xfc,0x48,0x09,0x44,0x10,0x9a,0x82,0xa5,0xe2,0x2c,0x31,0x6a
-  0xba,0x6c,0x94,0x33,0x88,0xf1,0x4d,0xa8,0x89,0x01,0x7c,0x6a
-  0x95,0xc8,0x4b,0x8d,0x07,0x69,0x38,0x39,0x9a,0x82,0x13,0xee
-  0xa1,0x3a,0x5f,0x40,0x74,0xd2,0x3a,0xe8,0x5e,0xde,0x32,0x81
-  0xc1,0x0a,0xe1,0xe8,0x57,0xab,0x37,0x8a,0xbe,0xf6,0xfc,0xad
-  0x88,0x1d,0xfd,0x83,0x39,0x57,0x70,0x58,0x9e,0xca,0xdc,0x0e
-  0xdd,0xe2,0x7f,0x4e,0xcb,0xb1,0x93,0xc4,0x41,0x82,0x7e,0x43
-  0x1a,0x7f,0x6e,0x0b,0xea,0x21,0x81,0x54,0x23,0xa0,0x6c,0x3f
-  0x9b,0xa0,0xff,0xf6,0xad,0xa6,0x31,0x2f,0x52,0x98,0x71,0x37
-  0xad,0xb6,0xb1,0xb4,0x3b,0x59,0x8b,0xf4,0xa2,0x60,0xa4,0xe5
-  0x53,0xb7,0xe6,0x13,0x3a,0x60,0xce,0x16,0x29,0x32,0xc2,0xfd
-  0x28,0x9c,0xbf,0xff,0xd9,0xea,0x9c,0x85,0x3c,0xd3,0x51,0x03
-  0xe3,0x0e,0x03,0xa0,0xd3,0xd0,0x81,0xc6,0xcc,0xd2,0xd1,0x2d
-  0xe7,0x2c,0x24,0xa7,0x32,0x68,0x14,0x97,0x95,0xc5,0x4b,0x5d
-  0xeb,0x5f,0xa4,0xe9,0x89,0xd1,0xb7,0x81,0x54,0xaf,0xa1,0xf9
-  0x85,0x9e,0xf5,0xa2,0x06,0x38,0x1b,0xf3,0xf8,0x42,0xbb,0x23
-  0x01,0xfc,0x33,0x18,0x91,0xb8,0xfd,0xf9,0xef,0x39,0xc3,0x1c
-  0x16,0x65,0x81,0x30,0x9f,0xdb,0x56,0xba,0xaa,0x54,0x54,0x53
-  0x21,0x47,0x2c,0x9e,0xdc,0xda,0xa8,0xb6,0x00,0x24,0xce,0xfc
-  0xb7,0x6c,0x07,0xfa,0x93,0xad,0x54,0x12,0xa6,0xa1,0xea,0x7f
-  0xb8,0x28,0xad,0x95,0x55,0xc8,0x59,0x10,0xb6,0xd1,0x4a,0xd1
-  0x13,0xac,0x49,0x69,0xc2,0x26,0x07,0x9b,0x92,0xc2,0x81,0xea
-  0x54,0xc3,0x4d,0x0d,0x55,0x2b,0x05,0xbd,0xfd,0x1f,0x6f,0xd4
-  0x6c,0x08,0x83,0xe5,0x81,0x7f,0x20,0x02,0x2c,0xf2,0xc3,0x52
-  0x76,0xe7,0x69,0x44,0x79,0x88,0x1e,0x64,0xb3,0x84,0x23,0x8b
-  0x34,0xfd,0x05,0x3f,0x68,0xdb,0x9a,0x9d,0x9e,0xcd,0xa8,0xf1
-  0xd3,0x38,0xf4,0xd9,0x9e,0xa5,0x3c,0xb7,0x51,0x05,0xa6,0xe3
-  0x3c,0x45,0x36,0x31,0xad,0x43,0x1a,0x1f,0x37,0x15,0x81,0x48
-  0x31,0xb2,0x35,0x1a,0xfd,0xbb,0xce,0xf7,0x39,0x41,0xe7,0xf6
-  0x86,0xec,0x81,0x15,0xef,0x36,0x17,0x22,0x6c,0xcd,0x4e,0xad
-  0x9a,0x40,0x48,0x64,0xab,0x79,0x1b,0x68,0xdc,0x05,0x29,0x89
-  0x88,0xb4,0x45,0x46,0xcf,0x57,0x58,0x5a,0x81,0x19,0xc2,0x89
-  0xc9,0x6a,0xd0,0x41,0xe4,0x68,0x68,0x4c,0x09,0x32,0xd0,0xde
-  0xc0,0x7e,0xc4,0x26,0xa4,0x11,0xf7,0xa9,0xdc,0x00,0x2f,0x44
-  0x7d,0x3a,0x3f,0xa2,0xc6,0xb3,0xd3,0x1a,0x64,0x1a,0x81,0x3a
-  0xf3,0x0a,0x6d,0x43,0xd8,0x28,0xe5,0xbc,0x3f,0xd6,0xfa,0xab
-  0x3b,0x98,0x0e,0x7b,0xbd,0x4c,0xf4,0x9f,0x10,0x8f,0xeb,0x4f
-  0x1b,0x30,0xb9,0xc3,0x88,0x94,0xff,0x8b,0x11,0xe7,0xa6,0x48
-  0x52,0x1a,0x7f,0x12,0x15,0xd8,0x53,0x36,0x9d,0xc7,0xfb,0x73
-  0x0a,0xac,0x71,0xf2,0xec,0xee,0x01,0x66,0x08,0xad,0xf7,0xaf
-  0x54,0xc9,0xf3,0x09,0x58,0x79,0x06,0x16,0x24,0xb0,0x8c,0xf8
-  0x7f,0x8b,0x58,0x91,0xa8,0xa9,0xc6,0x8b,0xf6,0x6a,0x3d,0x29
-  0xb4,0x28,0x3e,0x60,0x25,0x81,0x97,0x0e,0x3d,0x52,0xbe,0x5e
-  0x84,0xff,0x9d,0xba,0x40,0xd5,0x68,0xfc,0x6a,0xc1,0x09,0x44
-  0x3c,0x8c,0x57,0x45,0x13,0x91,0xcc,0x3b,0x0e,0x1f,0x17,0xb6
-  0x5f,0xa9,0x6c,0x94,0x89,0x60,0x70,0x12,0x75,0x4f,0x9a,0xde
-  0x7a,0x18,0xeb,0x64,0x24,0x04,0xf9,0xc4,0x14,0xc4,0x22,0x41
-  0x55,0x81,0xef,0x71,0x15,0x22,0xc7,0xe7,0xda,0x26,0x6b,0xd0
-  0x39,0xc8,0x94,0x79,0x0e,0x18,0x81,0xef,0x81,0x63,0x57,0xee
-  0xd4,0x6a,0x21,0x49,0xb6,0x97,0x2f,0x6c,0xa2,0xd7,0xfa,0x96
-  0xc7,0xe9,0xf8,0x5f,0x2b,0x0a,0xd0,0x4e,0x41,0x81,0x13,0xb9
-  0x93,0x4a,0xe6,0x84,0x86,0xcf,0x30,0xdd,0xe9,0xa8,0x62,0x15
-  0xe5,0x66,0x97,0x2d,0xdf,0xaf,0x69,0xa5,0x55,0x72,0x6e,0x49
-  0x44,0x0e,0xf3,0xde,0x92,0x6e,0x1f,0x6f,0xa5,0x2a,0x0d,0x50
-  0x86,0xb6,0x83,0x75,0x11,0xa5,0x87,0xef,0x1c,0xdc,0x04,0x09
-  0x2e,0x7f,0xf6,0xd5,0x6f,0x9b,0xdf,0x64,0x4a,0xb0,0x14,0xee
-  0xe1,0xd3,0x22,0xe7,0x2c,0x20,0xc0,0xb4,0x45,0xbf,0x52,0x93
-  0xdb,0xa3,0xb7,0x45,0x71,0x81,0x01,0x22,0xc1,0x6f,0xd3,0x30
-  0xff,0x2b,0x61,0x9c,0x2c,0xef,0x72,0x67,0x63,0x81,0x9b,0x3a
-  0xcc,0x43,0xf4,0xef,0xf0,0xc6,0x6f,0x87,0x82,0xfb,0x0c,0x90
-  0x85,0xf0,0x0a,0x3f,0xfd,0x9c,0x17,0xa7,0xaa,0x35,0x6e,0xfc
-  0x69,0xb6,0xca,0xc1,0xc2,0x84,0x13,0x06,0x77,0x4e,0x33,0x00
-  0xa3,0xf1,0xa6,0x91,0x71,0xe0,0x57,0xfd,0x72,0x6d,0x35,0x81
-  0x54,0x52,0x67,0xc6,0x4f,0x3b,0x8e,0xc1,0x3a,0xaa,0x5d,0x64
-  0xdb,0xdf,0xa8,0xdd,0x38,0xc7,0x1c,0xb6,0xff,0x81,0x00,0x3c
-  0x39,0xe4,0x13,0x5e,0xdc,0x25,0x1b,0xab,0x8f,0xbc,0x87,0x29
-  0x23,0x05,0x6d,0xe7,0xf6,0x41,0xa3,0xa2,0xa2,0xc2,0x55,0x5a
-  0x81,0x4e,0x6b,0xce,0x7a,0x31,0x29,0xb4,0xd4,0x74,0x0a,0x87
-  0x34,0x22,0x8d,0x06,0x58,0xb6,0x61,0xc8,0x5e,0x29,0xa9,0xc3
-  0x29,0xdb,0x28,0x84,0x2b,0xf5,0x81,0xe0,0xd5,0x8b,0xcd,0x1a
-  0xdb,0xa9,0x34,0x0c,0x03,0x72,0xc3,0xca,0xbc,0x72,0x4c,0x8e
-  0x5a,0x73,0xa1,0x60,0xd6,0x48,0x6c,0x54,0x5f,0x89,0xe3,0xf2
-  0xab,0xa9,0xeb,0xf2,0x9f,0x50,0xa8,0x14,0x11,0x9d,0xc2,0xd6
-  0x31,0xce,0xe9,0xe4,0xe7,0xdc,0xa6,0x7f,0x53,0x7b,0x99,0xe4
-  0x9b,0x7e,0xc9,0xb8,0xec,0x37,0xb2,0x60,0xaa,0x0c,0x4f,0xda
-  0x35,0x0d,0x22,0x7e,0x33,0x84,0x1d,0x7f,0x4a,0x1f,0x02,0x31
-  0x11,0x8f,0xff,0x90,0x3b,0xf4,0x86,0x41,0x24,0x60,0x4b,0x12
-  0x3e,0x14,0x3b,0x22,0x1b,0xdc,0x32,0xbb,0x32,0xc7,0x81,0x20
-  0xb4,0xa9,0x94,0xc6,0xef,0x57,0x5e,0xc3,0x96,0x27,0xeb,0x1d
-  0xe6,0x40,0xf7,0xce,0x71,0xae,0xd4,0xdc,0x34,0x9e,0x9a,0x33
-  0xb0,0x81,0x50,0x9e,0x3e,0x61,0xf8,0xf4,0x4c,0x39,0x7a,0xd8
-  0x89,0xf1,0x9f,0x8d,0xdb,0xf6,0x78,0xfc,0x0c,0x97,0x73,0x4c
-  0x97,0x14,0x9b,0x81,0xc5,0x91,0xe5,0xe4,0x4b,0xc4,0xda,0xa2
-  0x27,0x56,0x26,0x49,0x25,0xfe,0x24,0xe4,0xcf,0x8f,0x4f,0xe9
-  0xcb,0xe5,0x99,0xb6,0x19,0xd8,0x2e,0xf8,0x00,0x3e,0x8d,0xc2
-  0x5e,0x75,0xcc,0x4b,0x09,0xe3,0xce,0xc3,0xd9,0xdb,0x59,0xf6
-  0xab,0xf6,0x53,0x85,0xec,0xff,0xff,0xdd,0x7f,0xba,0x48,0x90
-  0x2d,0x87,0xaa,0x71,0xe1,0x4f,0xbc,0x86,0xcf,0x2e,0x07,0x12
-  0x4b,0xe5,0x4e,0xb6,0x53,0x81,0x5a,0xd0,0x1c,0xcc,0x55,0xb7
-  0x2d,0x18,0x95,0x5a,0x23,0xfa,0x44,0x83,0x43,0x4c,0xf2,0xbe
-  0xa2,0x7b,0x3f,0xce,0xce,0x70,0x40,0x86,0x59,0x3d,0xee,0x2b
-  0x89,0x5b,0x81,0xc0,0xca,0xe7,0x0e,0xbf,0x7e,0x6b,0xa2,0x71
-  0x6b,0x85,0xef,0x64,0x3d,0xe1,0xeb,0x5c,0x3f,0xa2,0xec,0x52
-  0x3b,0xc8,0xee,0xb7,0xbf,0xed,0x2a,0xb2,0xa1,0xc9,0xe7,0xac
-  0x81,0x01,0xed,0xc6,0x4a,0x7d,0x97,0xa5,0x07,0xd2,0x99,0xca
-  0x56,0x92,0x66,0x27,0x5b,0x8e,0xa2,0x68,0x4e,0xa1,0x49,0xe5
-  0xa3,0xe5,0xae,0x8f,0x50,0x23,0x08,0x22,0x31,0xba,0x63,0x22
-  0x1a,0x41,0x81,0x52,0xa3,0x2c,0x8b,0x2e,0xb6,0xb9,0x60,0x4c
-  0xa2,0xce,0x61,0x6d,0x8f,0x35,0x6d,0xb9,0xeb,0x81,0x75,0x9a
-  0xfc,0x76,0x8e,0x8b,0x19,0xda,0x93,0x39,0xfe,0x5e,0x6d,0x63
-  0x92,0x3e,0x49,0x8c,0x5c,0xb7,0x01,0x85,0x55,0x43,0x6f,0xb8
-  0x28,0x21,0xe8,0x0b,0x6a,0xf1,0xa1,0x02,0xa0,0xfc,0x0e,0x1a
-  0xe4,0x52,0x8d,0x88,0x2b,0x6e,0x9b,0x84,0x81,0xe5,0xad,0xf5
-  0x3d,0x54,0x6b,0xc1,0x81,0x72,0xa8,0xd8,0x03,0x96,0xe2,0xf1
-  0x6e,0x01,0x35,0x18,0x4c,0x66,0x5e,0xb6,0x71,0xd2,0x03,0x92
-  0x83,0x06,0x84,0xa9,0x4d,0x1d,0xac,0x50,0xcd,0x8c,0x2c,0xea
-  0x55,0x3e,0x34,0xb0,0xf4,0xa0,0x86,0xe9,0x5b,0xe5,0x97,0xfe
-  0xce,0x91,0x2b,0xe9,0x95,0x17,0x81,0x78,0x85,0xe9,0xe5,0xc1
-  0x3f,0x78,0x5d,0x95,0xdf,0x70,0x8a,0xeb,0xea,0xc8,0x6e,0xae
-  0x10,0x81,0x71,0x9b,0xb5,0xd8,0xce,0xa5,0xd4,0xc4,0x22,0x2f
-  0xea,0x69,0x13,0xba,0x7e,0xe2,0xa2,0x99,0xdd,0xb6,0x6f,0x2e
-  0xc1,0x35,0x4a,0x30,0xbc,0xe5,0x5a,0xaa,0x97,0x25,0xf6,0x1b
-  0x6f,0x65,0xd8,0xc4,0x4d,0xfa,0x01,0xd2,0x21,0x36,0x66,0x38
-  0xa0,0x12,0x81,0x10,0x0b,0xe0,0xa6,0xab,0xa9,0x75,0xce,0x9d
-  0x99,0x0a,0xca,0x0c,0x91,0x89,0x1b,0x1e,0x0c,0x13,0x0e,0xf6
-  0x45,0x5e,0x44,0xb0,0x97,0xcd,0x7f,0x01,0x73,0x17,0x92,0x41
-  0x28,0xee,0x66,0x59,0x61,0x71,0x22,0xcd,0xfc,0x09,0xe2,0x5c
-  0xa1,0x09,0xbd,0xbc,0xed,0xab,0xcf,0x34,0x5f,0xa8,0x6f,0x7f
-  0x31,0xa4,0xe4,0x78,0x67,0xdb,0xa7,0xea,0xc1,0x10,0x5a,0xb0
-  0x44,0x76,0xae,0xcc,0x13,0x7d,0x1c,0xf6,0xcb,0x64,0xfe,0x4b
-  0x1a,0x2e,0xa2,0xd3,0x0e,0xff,0xe8,0xf2,0x9e,0x49,0x3a,0xdd
-  0x0f,0x62,0x1c,0xc1,0xbc,0x05,0x81,0xb7,0xe1,0xd3,0x5a,0xaa
-  0xa7,0x92,0x70,0x30,0x65,0x90,0xb6,0x31,0x4d,0xeb,0xa5,0xbf
-  0xde,0xa3,0x81,0x95,0xed,0xef,0x69,0xde,0xcf,0x38,0xcc,0x3b
-  0xf6,0xce,0xb3,0x35,0x30,0x87,0xe8,0x55,0x92,0x33,0x40,0xb3
-  0x45,0x94,0xee,0xbd,0x44,0x61,0x54,0xd9,0xbe,0xdd,0x73,0xb5
-  0xe8,0xfe,0x9a,0xe4,0xa3,0x2b,0x81,0xc0,0x4b,0x5d,0xc2,0x6e
-  0x61,0x59,0x65,0x62,0x81,0x6d,0xfe,0xcb,0x59,0x6b,0xa5,0xc2
-  0x4d,0x4e,0x81,0xe7,0xb5,0x4c,0x7d,0x6e,0xb8,0x8b,0x7e,0x31
-  0x67,0xd9,0x84,0xcc,0xd5,0x9f,0x0e,0x3f,0xc7,0x30,0xbd,0x67
-  0x40,0x1f,0x01,0xea,0x95,0x61,0xbf,0x29,0x89,0xd1,0x52,0xb1
-  0x29,0xa4,0x30,0xd1,0x1f,0x41,0x3a,0x0d,0xd8,0x98,0x0c,0x81
-  0x58,0x28,0x4e,0x5a,0x52,0x2c,0xa3,0xbd,0x25,0x95,0x47,0x96
-  0xb8,0xfc,0x8b,0x0f,0x4b,0xc0,0x25,0xe9,0x50,0x4a,0x86,0x84
-  0x8f,0xec,0x51,0x1b,0xf0,0x3f,0x0a,0x0f,0x1d,0x5c,0x00,0x78
-  0x7f,0x0f,0x3d,0x62,0x12,0x2c,0x5c,0xb3,0x81,0xfd,0x51,0x29
-  0x31,0x94,0x94,0xc3,0x43,0x44,0x9b,0xd0,0x95,0x52,0x9f,0x1e
-  0x28,0xe0,0x85,0xdb,0x59,0x49,0x04,0x51,0xee,0x8f,0x67,0x32
-  0xa8,0xb3,0xf5,0xc3,0x92,0x43,0x7f,0xc2,0xb7,0x5a,0x44,0x77
-  0xec,0xf7,0x03,0xf8,0xb2,0xc9,0xd5,0xf8,0xef,0x85,0x24,0xd8
-  0x56,0x31,0xfd,0x2f,0xe4,0xb3,0xa9,0x90,0xc3,0x30,0xb6,0x1d
-  0x88,0x90,0xbc,0x28,0x81,0x2f,0x91,0x02,0xad,0x3d,0x7a,0x0d
-  0x7c,0x99,0x52,0xd3,0x38,0x12,0x63,0x35,0xaa,0x53,0xa4,0xaa
-  0x4a,0x5c,0x2c,0x3b,0x98,0x0e,0x02,0xb1,0x2b,0xcc,0xe8,0x94
-  0x79,0xe6,0x28,0x70,0x26,0x66,0x40,0xe9,0xa1,0x7b,0xda,0x08
-  0x46,0x7a,0x21,0x8e,0xac,0x93,0xe5,0xdf,0x7c,0x03,0x7f,0x33
-  0x77,0xe5,0xb4,0x98,0x14,0xbb,0xb6,0x4b,0xc7,0x00,0x36,0xb2
-  0xb7,0xc5,0x5d,0xfa,0x7b,0xd9,0xe3,0xa3,0xa9,0x31,0xb6,0xbe
-  0xf7,0x13,0xf4,0x95,0x6a,0x86,0xa8,0x81,0xd1,0x1c,0x82,0xd9
-  0x54,0xa5,0xac,0xb4,0xfa,0xc1,0xd0,0x60,0xe9,0x7a,0x18,0xa3
-  0x48,0xc6,0x45,0x8c,0x56,0xc8,0x7f,0xd0,0xcd,0x3c,0x37,0x2e
-  0x4a,0xb1,0xfe,0x40,0xc4,0x06,0x99,0xed,0x9e,0x61,0x5b,0xa3
-  0x0f,0xfd,0x35,0xca,0xe6,0x3a,0xda,0x59,0x21,0x39,0x68,0x54
-  0xd3,0xd6,0x4e,0xe8,0x07,0x81,0x9e,0x32,0x40,0x90,0x39,0x5f
-  0x3c,0x87,0x7c,0xab,0x0f,0x5d,0xb4,0x81,0xf9,0xb1,0xf9,0xc1
-  0x16,0x1e,0xf9,0x48,0xaf,0x65,0xe6,0x17,0x30,0x6f,0x38,0x12
-  0x99,0x7c,0x9e,0x63,0xe5,0xf2,0x1b,0x3c,0x3b,0xe7,0x7a,0x9d
-  0xce,0x46,0xd1,0xf5,0xf6,0x21,0x6d,0x97,0x97,0xf1,0x16,0xe5
-  0x9e,0x3e,0x1e,0x81,0x64,0x1d,0xcb,0xae,0x9c,0x2e,0xd6,0xa2
-  0x2e,0xc1,0x6d,0xe4,0xea,0x59,0x8d,0x61,0xc5,0x6d,0x24,0x1e
-  0xfd,0x39,0x94,0x3d,0x99,0x77,0x6b,0x83,0x4e,0xbd,0x76,0xe4
-  0x0e,0xc9,0x8f,0x9f,0x19,0x06,0x81,0xcf,0x30,0x25,0x4e,0xdf
-  0xbb,0x2e,0x23,0x06,0x7f,0x82,0xed,0x13,0x92,0x5e,0x1e,0x5c
-  0x44,0x82,0x07,0x29,0x45,0xef,0x63,0x01,0x3f,0x83,0x45,0xe5
-  0x05,0xa3,0x09,0x08,0x9d,0xd5,0xa4,0x99,0x32,0xfc,0xff,0xff
-  0x04,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-  0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff
-  0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x3e,0xfd,0xff,0xff,0x04,0x00,0x00,0x00,0x80,0x01,0x00,0x00
-  0xdc,0xe1,0x07,0x35,0xd2,0x5a,0x2a,0x36,0xb1,0x79,0x77,0x5f
-  0x5f,0xd9,0x69,0x8b,0xc4,0xf4,0x37,0x93,0x25,0xb1,0xd8,0xf4
-  0x7b,0xec,0x89,0x55,0x20,0x9c,0x7f,0x18,0x41,0xa2,0x45,0xf9
-  0x8e,0xc4,0x31,0xa8,0x22,0x33,0x1d,0x2a,0x2b,0x0b,0x86,0x9d
-  0xfc,0x35,0x87,0x15,0x12,0xbd,0xa4,0x69,0xcc,0x6c,0x0e,0xef
-  0x8b,0x86,0xa9,0x7f,0x33,0xff,0xf8,0x78,0x5c,0xc5,0xfd,0x22
-  0x91,0x42,0xdf,0x92,0x39,0xe5,0x08,0xef,0xb4,0x16,0xf4,0x6a
-  0x5e,0x1b,0x50,0xbf,0x50,0xe8,0x22,0xf4,0xe2,0x63,0xfd,0x6d
-  0xfe,0x63,0xf7,0x4d,0xaf,0x19,0x52,0xe6,0x7f,0x64,0x4e,0x54
-  0xf9,0xcb,0x01,0xb0,0x11,0xcb,0xb7,0x84,0x32,0xeb,0x95,0xc2
-  0xfd,0x69,0x69,0x12,0x6a,0x7b,0x29,0x49,0x89,0xce,0x55,0x40
-  0x66,0xcd,0x9a,0x41,0x1a,0x4a,0xea,0x45,0x4a,0x42,0x33,0x13
-  0x86,0x97,0x26,0x33,0x50,0x19,0xc5,0xd9,0xc5,0xf2,0xca,0x47
-  0x56,0x0d,0x6f,0xe1,0x1f,0xc8,0x19,0x28,0x73,0x03,0x7c,0xce
-  0xbc,0x0a,0xe1,0x5a,0x32,0x3d,0x10,0xc3,0x81,0xaf,0xa4,0x89
-  0x3f,0xb9,0xd5,0x74,0x18,0x33,0xd8,0xc1,0x3b,0xa8,0xb4,0x5b
-  0xee,0x8d,0xe1,0x94,0x45,0xd6,0x15,0x88,0x62,0xff,0xf1,0xad
-  0x64,0x58,0xa7,0x90,0xbc,0x06,0x38,0x22,0x7a,0xb5,0x28,0x8a
-  0x0d,0x3b,0xd7,0x42,0x7b,0xde,0xfd,0x19,0x72,0x5b,0xda,0x6a
-  0x85,0xe5,0x4c,0xc4,0x29,0x26,0xdf,0x2d,0xc3,0xd2,0x2b,0x7f
-  0xde,0xd4,0x68,0x33,0xb7,0xb3,0xa4,0xfc,0x16,0xb4,0x89,0xb2
-  0x70,0x04,0xb7,0x90,0x74,0x3e,0xe3,0xb2,0x4f,0xc2,0x4e,0x46
-  0x66,0x7c,0x89,0x1d,0x16,0x37,0x6b,0xed,0x93,0x0d,0x28,0x52
-  0xb0,0x9f,0x0f,0xb2,0x6a,0x4b,0x61,0x77,0x61,0x51,0xe7,0xd7
-  0x42,0x3e,0xfa,0x37,0x86,0x28,0xdb,0xfe,0xd0,0x70,0x79,0x81
-  0x12,0xbe,0x74,0x6f,0xef,0xca,0x3b,0xe7,0xbd,0xb1,0x94,0x4c
-  0xcd,0xaa,0xad,0xf3,0x34,0x28,0xed,0x3c,0x3b,0xca,0x00,0x04
-  0x8a,0x76,0xf8,0xc9,0xbe,0x81,0xde,0xfa,0x4e,0xe5,0xfe,0x0d
-  0xbb,0xa8,0xa0,0x2e,0x55,0xde,0x35,0x20,0x27,0xd0,0xe3,0x39
-  0x59,0x62,0xc0,0x50,0x96,0xb1,0x52,0xe5,0x41,0xe0,0x75,0x74
-  0x0f,0x98,0xae,0x78,0x31,0x90,0x74,0x99,0x0e,0x5d,0x47,0x3c
-  0x2a,0xe3,0xe0,0x4c,0xf9,0x71,0x89,0x30,0xef,0x78,0xfd,0xf3
-  0xca,0xfe,0xff,0xff,0x04,0x00,0x00,0x00,0x18,0x00,0x00,0x00
-  0xf7,0xfe,0xff,0xff,0x06,0x00,0x00,0x00,0x9d,0x01,0x00,0x00
-  0xc7,0x00,0x00,0x00,0x42,0x00,0x00,0x00,0xec,0xfe,0xff,0xff
-  0xee,0xfe,0xff,0xff,0x04,0x00,0x00,0x00,0x0c,0x00,0x00,0x00
-  0xff,0xff,0xff,0xff,0x0c,0x00,0x00,0x00,0x20,0x00,0x00,0x00
-  0x06,0xff,0xff,0xff,0x04,0x00,0x00,0x00,0x0c,0x00,0x00,0x00
-  0xff,0xff,0xff,0xff,0x0e,0x00,0x00,0x00,0x10,0x00,0x00,0x00
-  0x1e,0xff,0xff,0xff,0x04,0x00,0x00,0x00,0x04,0x00,0x00,0x00
-  0x01,0x00,0x00,0x00,0x2e,0xff,0xff,0xff,0x04,0x00,0x00,0x00
-  0x0c,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x1c,0x00,0x00,0x00
-  0x10,0x00,0x00,0x00,0x46,0xff,0xff,0xff,0x04,0x00,0x00,0x00
-  0x04,0x00,0x00,0x00,0xfd,0xff,0xff,0xff,0x3c,0xe4,0xff,0xff
-  0x40,0xe4,0xff,0xff,0x0f,0x00,0x00,0x00,0x4d,0x4c,0x49,0x52
-  0x20,0x43,0x6f,0x6e,0x76,0x65,0x72,0x74,0x65,0x64,0x2e,0x00
-  0x01,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x00,0x00,0x0e,0x00
-  0x18,0x00,0x14,0x00,0x10,0x00,0x0c,0x00,0x08,0x00,0x04,0x00
-  0x0e,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x1c,0x00,0x00,0x00
-  0x2c,0x03,0x00,0x00,0x30,0x03,0x00,0x00,0x34,0x03,0x00,0x00
-  0x04,0x00,0x00,0x00,0x6d,0x61,0x69,0x6e,0x00,0x00,0x00,0x00
-  0x0d,0x00,0x00,0x00,0xe4,0x02,0x00,0x00,0x80,0x02,0x00,0x00
-  0x48,0x02,0x00,0x00,0x0c,0x02,0x00,0x00,0xb8,0x01,0x00,0x00
-  0x90,0x01,0x00,0x00,0x60,0x01,0x00,0x00,0x18,0x01,0x00,0x00
-  0xf0,0x00,0x00,0x00,0xbc,0x00,0x00,0x00,0x78,0x00,0x00,0x00
-  0x40,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0xbe,0xfd,0xff,0xff
-  0x1c,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0x1c,0x00,0x00,0x00
-  0x20,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x06,0x00
-  0x08,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x80,0x3f
-  0x01,0x00,0x00,0x00,0x1a,0x00,0x00,0x00,0x01,0x00,0x00,0x00
-  0x19,0x00,0x00,0x00,0xf6,0xfd,0xff,0xff,0x14,0x00,0x00,0x00
-  0x00,0x00,0x00,0x08,0x10,0x00,0x00,0x00,0x14,0x00,0x00,0x00
-  0x05,0x00,0x00,0x00,0x1c,0xe5,0xff,0xff,0x01,0x00,0x00,0x00
-  0x19,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x18,0x00,0x00,0x00
-  0x07,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x2a,0xfe,0xff,0xff
-  0x1c,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x1c,0x00,0x00,0x00
-  0x20,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x06,0x00
-  0x08,0x00,0x07,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x01
-  0x01,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x03,0x00,0x00,0x00
-  0x17,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x08,0x00,0x00,0x00
-  0x6a,0xfe,0xff,0xff,0x14,0x00,0x00,0x00,0x00,0x00,0x00,0x1b
-  0x10,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x04,0x00,0x00,0x00
-  0x90,0xe5,0xff,0xff,0x01,0x00,0x00,0x00,0x17,0x00,0x00,0x00
-  0x02,0x00,0x00,0x00,0x16,0x00,0x00,0x00,0x03,0x00,0x00,0x00
-  0xca,0xfe,0xff,0xff,0x0c,0x00,0x00,0x00,0x10,0x00,0x00,0x00
-  0x02,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x16,0x00,0x00,0x00
-  0x02,0x00,0x00,0x00,0x15,0x00,0x00,0x00,0x05,0x00,0x00,0x00
-  0xbe,0xfe,0xff,0xff,0x14,0x00,0x00,0x00,0x00,0x00,0x00,0x01
-  0x20,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x01,0x00,0x00,0x00
-  0xb0,0xfe,0xff,0xff,0x00,0x00,0x00,0x01,0x01,0x00,0x00,0x00
-  0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x00,0x00,0x00
-  0x15,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x14,0x00,0x00,0x00
-  0x0b,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,0xa2,0xfe,0xff,0xff
-  0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0x0c,0x00,0x00,0x00
-  0x10,0x00,0x00,0x00,0x24,0xe6,0xff,0xff,0x01,0x00,0x00,0x00
-  0x14,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x13,0x00,0x00,0x00
-  0x01,0x00,0x00,0x00,0x5e,0xff,0xff,0xff,0x0c,0x00,0x00,0x00
-  0x10,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x01,0x00,0x00,0x00
-  0x13,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x12,0x00,0x00,0x00
-  0x04,0x00,0x00,0x00,0x52,0xff,0xff,0xff,0x24,0x00,0x00,0x00
-  0x00,0x00,0x00,0x05,0x34,0x00,0x00,0x00,0x38,0x00,0x00,0x00
-  0x03,0x00,0x00,0x00,0x00,0x00,0x0e,0x00,0x18,0x00,0x17,0x00
-  0x10,0x00,0x0c,0x00,0x08,0x00,0x04,0x00,0x0e,0x00,0x00,0x00
-  0x01,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x01,0x00,0x00,0x00
-  0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x00,0x00,0x00
-  0x12,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x11,0x00,0x00,0x00
-  0x42,0xff,0xff,0xff,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x34
-  0x0c,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0xc4,0xe6,0xff,0xff
-  0x01,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x02,0x00,0x00,0x00
-  0x10,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x0a,0x00
-  0x10,0x00,0x0c,0x00,0x08,0x00,0x04,0x00,0x0a,0x00,0x00,0x00
-  0x0c,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x02,0x00,0x00,0x00
-  0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x02,0x00,0x00,0x00
-  0x0f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x0e,0x00
-  0x18,0x00,0x14,0x00,0x10,0x00,0x0c,0x00,0x0b,0x00,0x04,0x00
-  0x0e,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x01
-  0x2c,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x01,0x00,0x00,0x00
-  0x0c,0x00,0x14,0x00,0x13,0x00,0x0c,0x00,0x08,0x00,0x07,0x00
-  0x0c,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x00,0x00,0x00
-  0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x00,0x00,0x00
-  0x0f,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x0e,0x00,0x00,0x00
-  0x0d,0x00,0x00,0x00,0x0c,0x00,0x00,0x00,0x00,0x00,0x0e,0x00
-  0x14,0x00,0x00,0x00,0x10,0x00,0x0c,0x00,0x0b,0x00,0x04,0x00
-  0x0e,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x34
-  0x0c,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x90,0xe7,0xff,0xff
-  0x01,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x02,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00
-  0x1a,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x1b,0x00,0x00,0x00,0x7c,0x18,0x00,0x00,0x24,0x18,0x00,0x00
-  0xcc,0x17,0x00,0x00,0x90,0x17,0x00,0x00,0x50,0x17,0x00,0x00
-  0x10,0x17,0x00,0x00,0x74,0x16,0x00,0x00,0xd0,0x15,0x00,0x00
-  0x7c,0x12,0x00,0x00,0x20,0x0f,0x00,0x00,0x4c,0x0d,0x00,0x00
-  0x68,0x0b,0x00,0x00,0x54,0x0a,0x00,0x00,0x30,0x09,0x00,0x00
-  0x8c,0x08,0x00,0x00,0x90,0x07,0x00,0x00,0xc0,0x06,0x00,0x00
-  0x18,0x06,0x00,0x00,0x7c,0x05,0x00,0x00,0xe4,0x04,0x00,0x00
-  0x44,0x04,0x00,0x00,0x40,0x03,0x00,0x00,0x68,0x02,0x00,0x00
-  0xd8,0x01,0x00,0x00,0x24,0x01,0x00,0x00,0x80,0x00,0x00,0x00
-  0x04,0x00,0x00,0x00,0x06,0xe8,0xff,0xff,0x00,0x00,0x00,0x01
-  0x18,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x3c,0x00,0x00,0x00
-  0x1b,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0x50,0x00,0x00,0x00
-  0x02,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x06,0x00,0x00,0x00
-  0xec,0xe7,0xff,0xff,0x08,0x00,0x00,0x00,0x10,0x00,0x00,0x00
-  0x01,0x00,0x00,0x00,0x80,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-  0x01,0x00,0x00,0x00,0x00,0x00,0x80,0x3b,0x1b,0x00,0x00,0x00
-  0x53,0x74,0x61,0x74,0x65,0x66,0x75,0x6c,0x50,0x61,0x72,0x74
-  0x69,0x74,0x69,0x6f,0x6e,0x65,0x64,0x43,0x61,0x6c,0x6c,0x5f
-  0x31,0x3a,0x30,0x00,0x02,0x00,0x00,0x00,0x01,0x00,0x00,0x00
-  0x06,0x00,0x00,0x00,0x7e,0xe8,0xff,0xff,0x00,0x00,0x00,0x01
-  0x18,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x40,0x00,0x00,0x00
-  0x1a,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0x78,0x00,0x00,0x00
-  0x02,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x06,0x00,0x00,0x00
-  0x64,0xe8,0xff,0xff,0x08,0x00,0x00,0x00,0x14,0x00,0x00,0x00
-  0x01,0x00,0x00,0x00,0xf6,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-  0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x28,0x2c,0x77,0x3c
-  0x3c,0x00,0x00,0x00,0x73,0x65,0x71,0x75,0x65,0x6e,0x74,0x69
-  0x61,0x6c,0x5f,0x31,0x2f,0x64,0x65,0x6e,0x73,0x65,0x5f,0x31
-  0x5f,0x32,0x2f,0x4d,0x61,0x74,0x4d,0x75,0x6c,0x3b,0x73,0x65
-  0x71,0x75,0x65,0x6e,0x74,0x69,0x61,0x6c,0x5f,0x31,0x2f,0x64
-  0x65,0x6e,0x73,0x65,0x5f,0x31,0x5f,0x32,0x2f,0x42,0x69,0x61
-  0x73,0x41,0x64,0x64,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00
-  0x01,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x1e,0xe9,0xff,0xff
-  0x00,0x00,0x00,0x01,0x18,0x00,0x00,0x00,0x20,0x00,0x00,0x00
-  0x3c,0x00,0x00,0x00,0x19,0x00,0x00,0x00,0x00,0x00,0x00,0x09
-  0x88,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0xff,0xff,0xff,0xff
-  0x40,0x00,0x00,0x00,0x04,0xe9,0xff,0xff,0x08,0x00,0x00,0x00
-  0x10,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x80,0xff,0xff,0xff
-  0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0xa8,0x20,0x1f,0x3d
-  0x52,0x00,0x00,0x00,0x73,0x65,0x71,0x75,0x65,0x6e,0x74,0x69
-  0x61,0x6c,0x5f,0x31,0x2f,0x64,0x65,0x6e,0x73,0x65,0x5f,0x31
-  0x2f,0x4d,0x61,0x74,0x4d,0x75,0x6c,0x3b,0x73,0x65,0x71,0x75
-  0x65,0x6e,0x74,0x69,0x61,0x6c,0x5f,0x31,0x2f,0x64,0x65,0x6e
-  0x73,0x65,0x5f,0x31,0x2f,0x52,0x65,0x6c,0x75,0x3b,0x73,0x65
-  0x71,0x75,0x65,0x6e,0x74,0x69,0x61,0x6c,0x5f,0x31,0x2f,0x64
-  0x65,0x6e,0x73,0x65,0x5f,0x31,0x2f,0x42,0x69,0x61,0x73,0x41
-  0x64,0x64,0x00,0x00,0x02,0x00,0x00,0x00,0x01,0x00,0x00,0x00
-  0x40,0x00,0x00,0x00,0xce,0xe9,0xff,0xff,0x00,0x00,0x00,0x01
-  0x18,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x3c,0x00,0x00,0x00
-  0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0x64,0x00,0x00,0x00
-  0x02,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x20,0x00,0x00,0x00
-  0xb4,0xe9,0xff,0xff,0x08,0x00,0x00,0x00,0x10,0x00,0x00,0x00
-  0x01,0x00,0x00,0x00,0x80,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-  0x01,0x00,0x00,0x00,0x35,0xf1,0xdb,0x41,0x2c,0x00,0x00,0x00
-  0x73,0x65,0x71,0x75,0x65,0x6e,0x74,0x69,0x61,0x6c,0x5f,0x31
-  0x2f,0x67,0x6c,0x6f,0x62,0x61,0x6c,0x5f,0x61,0x76,0x65,0x72
-  0x61,0x67,0x65,0x5f,0x70,0x6f,0x6f,0x6c,0x69,0x6e,0x67,0x31
-  0x64,0x5f,0x31,0x2f,0x4d,0x65,0x61,0x6e,0x00,0x00,0x00,0x00
-  0x02,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x20,0x00,0x00,0x00
-  0x5a,0xea,0xff,0xff,0x00,0x00,0x00,0x01,0x18,0x00,0x00,0x00
-  0x24,0x00,0x00,0x00,0x44,0x00,0x00,0x00,0x17,0x00,0x00,0x00
-  0x00,0x00,0x00,0x09,0xa8,0x00,0x00,0x00,0x03,0x00,0x00,0x00
-  0xff,0xff,0xff,0xff,0x0c,0x00,0x00,0x00,0x20,0x00,0x00,0x00
-  0x44,0xea,0xff,0xff,0x08,0x00,0x00,0x00,0x14,0x00,0x00,0x00
-  0x01,0x00,0x00,0x00,0x80,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-  0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x7b,0xfd,0xf8,0x42
-  0x69,0x00,0x00,0x00,0x73,0x65,0x71,0x75,0x65,0x6e,0x74,0x69
-  0x61,0x6c,0x5f,0x31,0x2f,0x63,0x6f,0x6e,0x76,0x31,0x64,0x5f
-  0x31,0x5f,0x32,0x2f,0x52,0x65,0x6c,0x75,0x3b,0x73,0x65,0x71
-  0x75,0x65,0x6e,0x74,0x69,0x61,0x6c,0x5f,0x31,0x2f,0x63,0x6f
-  0x6e,0x76,0x31,0x64,0x5f,0x31,0x5f,0x32,0x2f,0x42,0x69,0x61
-  0x73,0x41,0x64,0x64,0x3b,0x73,0x65,0x71,0x75,0x65,0x6e,0x74
-  0x69,0x61,0x6c,0x5f,0x31,0x2f,0x63,0x6f,0x6e,0x76,0x31,0x64
-  0x5f,0x31,0x5f,0x32,0x2f,0x63,0x6f,0x6e,0x76,0x6f,0x6c,0x75
-  0x74,0x69,0x6f,0x6e,0x2f,0x53,0x71,0x75,0x65,0x65,0x7a,0x65
-  0x3b,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00
-  0x0c,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x2e,0xeb,0xff,0xff
-  0x00,0x00,0x00,0x01,0x18,0x00,0x00,0x00,0x28,0x00,0x00,0x00
-  0x48,0x00,0x00,0x00,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x09
-  0xd0,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0xff,0xff,0xff,0xff
-  0x01,0x00,0x00,0x00,0x0c,0x00,0x00,0x00,0x20,0x00,0x00,0x00
-  0x1c,0xeb,0xff,0xff,0x08,0x00,0x00,0x00,0x14,0x00,0x00,0x00
-  0x01,0x00,0x00,0x00,0x80,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-  0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x7b,0xfd,0xf8,0x42
-  0x8d,0x00,0x00,0x00,0x73,0x65,0x71,0x75,0x65,0x6e,0x74,0x69
-  0x61,0x6c,0x5f,0x31,0x2f,0x63,0x6f,0x6e,0x76,0x31,0x64,0x5f
-  0x31,0x5f,0x32,0x2f,0x52,0x65,0x6c,0x75,0x3b,0x73,0x65,0x71
-  0x75,0x65,0x6e,0x74,0x69,0x61,0x6c,0x5f,0x31,0x2f,0x63,0x6f
-  0x6e,0x76,0x31,0x64,0x5f,0x31,0x5f,0x32,0x2f,0x42,0x69,0x61
-  0x73,0x41,0x64,0x64,0x3b,0x73,0x65,0x71,0x75,0x65,0x6e,0x74
-  0x69,0x61,0x6c,0x5f,0x31,0x2f,0x63,0x6f,0x6e,0x76,0x31,0x64
-  0x5f,0x31,0x5f,0x32,0x2f,0x63,0x6f,0x6e,0x76,0x6f,0x6c,0x75
-  0x74,0x69,0x6f,0x6e,0x2f,0x53,0x71,0x75,0x65,0x65,0x7a,0x65
-  0x3b,0x3b,0x73,0x65,0x71,0x75,0x65,0x6e,0x74,0x69,0x61,0x6c
-  0x5f,0x31,0x2f,0x63,0x6f,0x6e,0x76,0x31,0x64,0x5f,0x31,0x5f
-  0x32,0x2f,0x63,0x6f,0x6e,0x76,0x6f,0x6c,0x75,0x74,0x69,0x6f
-  0x6e,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00
-  0x01,0x00,0x00,0x00,0x0c,0x00,0x00,0x00,0x20,0x00,0x00,0x00
-  0x2e,0xec,0xff,0xff,0x00,0x00,0x00,0x01,0x18,0x00,0x00,0x00
-  0x28,0x00,0x00,0x00,0x44,0x00,0x00,0x00,0x15,0x00,0x00,0x00
-  0x00,0x00,0x00,0x09,0x6c,0x00,0x00,0x00,0x04,0x00,0x00,0x00
-  0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x0e,0x00,0x00,0x00
-  0x10,0x00,0x00,0x00,0x1c,0xec,0xff,0xff,0x08,0x00,0x00,0x00
-  0x10,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x80,0xff,0xff,0xff
-  0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x07,0x2f,0x41,0x43
-  0x2e,0x00,0x00,0x00,0x73,0x65,0x71,0x75,0x65,0x6e,0x74,0x69
-  0x61,0x6c,0x5f,0x31,0x2f,0x63,0x6f,0x6e,0x76,0x31,0x64,0x5f
-  0x31,0x5f,0x32,0x2f,0x63,0x6f,0x6e,0x76,0x6f,0x6c,0x75,0x74
-  0x69,0x6f,0x6e,0x2f,0x45,0x78,0x70,0x61,0x6e,0x64,0x44,0x69
-  0x6d,0x73,0x00,0x00,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00
-  0x01,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x10,0x00,0x00,0x00
-  0xca,0xec,0xff,0xff,0x00,0x00,0x00,0x01,0x18,0x00,0x00,0x00
-  0x24,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x14,0x00,0x00,0x00
-  0x00,0x00,0x00,0x09,0x68,0x00,0x00,0x00,0x03,0x00,0x00,0x00
-  0xff,0xff,0xff,0xff,0x0e,0x00,0x00,0x00,0x10,0x00,0x00,0x00
-  0xb4,0xec,0xff,0xff,0x08,0x00,0x00,0x00,0x10,0x00,0x00,0x00
-  0x01,0x00,0x00,0x00,0x80,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-  0x01,0x00,0x00,0x00,0x07,0x2f,0x41,0x43,0x2e,0x00,0x00,0x00
-  0x73,0x65,0x71,0x75,0x65,0x6e,0x74,0x69,0x61,0x6c,0x5f,0x31
-  0x2f,0x6d,0x61,0x78,0x5f,0x70,0x6f,0x6f,0x6c,0x69,0x6e,0x67
-  0x31,0x64,0x5f,0x31,0x2f,0x4d,0x61,0x78,0x50,0x6f,0x6f,0x6c
-  0x31,0x64,0x2f,0x53,0x71,0x75,0x65,0x65,0x7a,0x65,0x00,0x00
-  0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x0e,0x00,0x00,0x00
-  0x10,0x00,0x00,0x00,0x5e,0xed,0xff,0xff,0x00,0x00,0x00,0x01
-  0x18,0x00,0x00,0x00,0x28,0x00,0x00,0x00,0x48,0x00,0x00,0x00
-  0x13,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0x68,0x00,0x00,0x00
-  0x04,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00
-  0x0e,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x4c,0xed,0xff,0xff
-  0x08,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x01,0x00,0x00,0x00
-  0x80,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00
-  0x01,0x00,0x00,0x00,0x07,0x2f,0x41,0x43,0x26,0x00,0x00,0x00
-  0x73,0x65,0x71,0x75,0x65,0x6e,0x74,0x69,0x61,0x6c,0x5f,0x31
-  0x2f,0x6d,0x61,0x78,0x5f,0x70,0x6f,0x6f,0x6c,0x69,0x6e,0x67
-  0x31,0x64,0x5f,0x31,0x2f,0x4d,0x61,0x78,0x50,0x6f,0x6f,0x6c
-  0x31,0x64,0x00,0x00,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00
-  0x01,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x10,0x00,0x00,0x00
-  0xf6,0xed,0xff,0xff,0x00,0x00,0x00,0x01,0x18,0x00,0x00,0x00
-  0x28,0x00,0x00,0x00,0x48,0x00,0x00,0x00,0x12,0x00,0x00,0x00
-  0x00,0x00,0x00,0x09,0x74,0x00,0x00,0x00,0x04,0x00,0x00,0x00
-  0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x1c,0x00,0x00,0x00
-  0x10,0x00,0x00,0x00,0xe4,0xed,0xff,0xff,0x08,0x00,0x00,0x00
-  0x14,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x80,0xff,0xff,0xff
-  0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00
-  0x07,0x2f,0x41,0x43,0x31,0x00,0x00,0x00,0x73,0x65,0x71,0x75
-  0x65,0x6e,0x74,0x69,0x61,0x6c,0x5f,0x31,0x2f,0x6d,0x61,0x78
-  0x5f,0x70,0x6f,0x6f,0x6c,0x69,0x6e,0x67,0x31,0x64,0x5f,0x31
-  0x2f,0x4d,0x61,0x78,0x50,0x6f,0x6f,0x6c,0x31,0x64,0x2f,0x45
-  0x78,0x70,0x61,0x6e,0x64,0x44,0x69,0x6d,0x73,0x00,0x00,0x00
-  0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00
-  0x1c,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x9a,0xee,0xff,0xff
-  0x00,0x00,0x00,0x01,0x18,0x00,0x00,0x00,0x24,0x00,0x00,0x00
-  0x44,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0x09
-  0xa0,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0xff,0xff,0xff,0xff
-  0x1c,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x84,0xee,0xff,0xff
-  0x08,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x01,0x00,0x00,0x00
-  0x80,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00
-  0x01,0x00,0x00,0x00,0x07,0x2f,0x41,0x43,0x63,0x00,0x00,0x00
-  0x73,0x65,0x71,0x75,0x65,0x6e,0x74,0x69,0x61,0x6c,0x5f,0x31
-  0x2f,0x63,0x6f,0x6e,0x76,0x31,0x64,0x5f,0x31,0x2f,0x52,0x65
-  0x6c,0x75,0x3b,0x73,0x65,0x71,0x75,0x65,0x6e,0x74,0x69,0x61
-  0x6c,0x5f,0x31,0x2f,0x63,0x6f,0x6e,0x76,0x31,0x64,0x5f,0x31
-  0x2f,0x42,0x69,0x61,0x73,0x41,0x64,0x64,0x3b,0x73,0x65,0x71
-  0x75,0x65,0x6e,0x74,0x69,0x61,0x6c,0x5f,0x31,0x2f,0x63,0x6f
-  0x6e,0x76,0x31,0x64,0x5f,0x31,0x2f,0x63,0x6f,0x6e,0x76,0x6f
-  0x6c,0x75,0x74,0x69,0x6f,0x6e,0x2f,0x53,0x71,0x75,0x65,0x65
-  0x7a,0x65,0x3b,0x00,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00
-  0x1c,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x66,0xef,0xff,0xff
-  0x00,0x00,0x00,0x01,0x18,0x00,0x00,0x00,0x28,0x00,0x00,0x00
-  0x48,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x09
-  0xc8,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0xff,0xff,0xff,0xff
-  0x01,0x00,0x00,0x00,0x1c,0x00,0x00,0x00,0x10,0x00,0x00,0x00
-  0x54,0xef,0xff,0xff,0x08,0x00,0x00,0x00,0x14,0x00,0x00,0x00
-  0x01,0x00,0x00,0x00,0x80,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-  0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x07,0x2f,0x41,0x43
-  0x85,0x00,0x00,0x00,0x73,0x65,0x71,0x75,0x65,0x6e,0x74,0x69
-  0x61,0x6c,0x5f,0x31,0x2f,0x63,0x6f,0x6e,0x76,0x31,0x64,0x5f
-  0x31,0x2f,0x52,0x65,0x6c,0x75,0x3b,0x73,0x65,0x71,0x75,0x65
-  0x6e,0x74,0x69,0x61,0x6c,0x5f,0x31,0x2f,0x63,0x6f,0x6e,0x76
-  0x31,0x64,0x5f,0x31,0x2f,0x42,0x69,0x61,0x73,0x41,0x64,0x64
-  0x3b,0x73,0x65,0x71,0x75,0x65,0x6e,0x74,0x69,0x61,0x6c,0x5f
-  0x31,0x2f,0x63,0x6f,0x6e,0x76,0x31,0x64,0x5f,0x31,0x2f,0x63
-  0x6f,0x6e,0x76,0x6f,0x6c,0x75,0x74,0x69,0x6f,0x6e,0x2f,0x53
-  0x71,0x75,0x65,0x65,0x7a,0x65,0x3b,0x3b,0x73,0x65,0x71,0x75
-  0x65,0x6e,0x74,0x69,0x61,0x6c,0x5f,0x31,0x2f,0x63,0x6f,0x6e
-  0x76,0x31,0x64,0x5f,0x31,0x2f,0x63,0x6f,0x6e,0x76,0x6f,0x6c
-  0x75,0x74,0x69,0x6f,0x6e,0x00,0x00,0x00,0x04,0x00,0x00,0x00
-  0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x1c,0x00,0x00,0x00
-  0x10,0x00,0x00,0x00,0x5e,0xf0,0xff,0xff,0x00,0x00,0x00,0x01
-  0x18,0x00,0x00,0x00,0x28,0x00,0x00,0x00,0x48,0x00,0x00,0x00
-  0x0f,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0x70,0x00,0x00,0x00
-  0x04,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00
-  0x1e,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x4c,0xf0,0xff,0xff
-  0x08,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x01,0x00,0x00,0x00
-  0x80,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00
-  0x01,0x00,0x00,0x00,0x69,0x3e,0x0f,0x44,0x2c,0x00,0x00,0x00
-  0x73,0x65,0x71,0x75,0x65,0x6e,0x74,0x69,0x61,0x6c,0x5f,0x31
-  0x2f,0x63,0x6f,0x6e,0x76,0x31,0x64,0x5f,0x31,0x2f,0x63,0x6f
-  0x6e,0x76,0x6f,0x6c,0x75,0x74,0x69,0x6f,0x6e,0x2f,0x45,0x78
-  0x70,0x61,0x6e,0x64,0x44,0x69,0x6d,0x73,0x00,0x00,0x00,0x00
-  0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00
-  0x1e,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x52,0xf1,0xff,0xff
-  0x00,0x00,0x00,0x01,0x14,0x00,0x00,0x00,0xe8,0x00,0x00,0x00
-  0x0e,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0xf4,0x00,0x00,0x00
-  0xd4,0xf0,0xff,0xff,0x08,0x00,0x00,0x00,0x8c,0x00,0x00,0x00
-  0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0xb7,0xfd,0xf2,0x3a
-  0xb0,0x6a,0x11,0x3b,0xfc,0x92,0x04,0x3b,0x54,0xdf,0x1c,0x3b
-  0xfd,0x0d,0x01,0x3b,0xf6,0x76,0x1f,0x3b,0x14,0xdf,0xd8,0x3a
-  0x20,0xf4,0x17,0x3b,0xa7,0x9e,0x16,0x3b,0x11,0x4f,0x08,0x3b
-  0x84,0x91,0x19,0x3b,0x27,0x84,0x24,0x3b,0xdf,0xba,0x21,0x3b
-  0x64,0xa5,0x11,0x3b,0xea,0x5e,0x1f,0x3b,0x0f,0xd7,0x0d,0x3b
-  0x12,0x00,0x00,0x00,0x74,0x66,0x6c,0x2e,0x70,0x73,0x65,0x75
-  0x64,0x6f,0x5f,0x71,0x63,0x6f,0x6e,0x73,0x74,0x37,0x00,0x00
-  0x04,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x01,0x00,0x00,0x00
-  0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x72,0xf2,0xff,0xff
-  0x00,0x00,0x00,0x01,0x14,0x00,0x00,0x00,0xe4,0x00,0x00,0x00
-  0x0d,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xf0,0x00,0x00,0x00
-  0xf4,0xf1,0xff,0xff,0x08,0x00,0x00,0x00,0x88,0x00,0x00,0x00
-  0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x10,0x00,0x00,0x00,0xf6,0xf6,0x87,0x3f,0x18,0xbc,0xa2,0x3f
-  0xd9,0x5c,0x94,0x3f,0xfd,0x8d,0xaf,0x3f,0x8d,0x6c,0x90,0x3f
-  0xa7,0x74,0xb2,0x3f,0xf6,0xb2,0x72,0x3f,0xd3,0x0c,0xaa,0x3f
-  0xaf,0x8e,0xa8,0x3f,0xcb,0x8a,0x98,0x3f,0x72,0xdb,0xab,0x3f
-  0xdb,0x1b,0xb8,0x3f,0xa0,0xfd,0xb4,0x3f,0xc9,0xfd,0xa2,0x3f
-  0xbe,0x59,0xb2,0x3f,0x6b,0xbb,0x9e,0x3f,0x12,0x00,0x00,0x00
-  0x74,0x66,0x6c,0x2e,0x70,0x73,0x65,0x75,0x64,0x6f,0x5f,0x71
-  0x63,0x6f,0x6e,0x73,0x74,0x36,0x00,0x00,0x01,0x00,0x00,0x00
-  0x10,0x00,0x00,0x00,0x82,0xf3,0xff,0xff,0x00,0x00,0x00,0x01
-  0x14,0x00,0x00,0x00,0xa8,0x01,0x00,0x00,0x0c,0x00,0x00,0x00
-  0x00,0x00,0x00,0x09,0xb4,0x01,0x00,0x00,0x04,0xf3,0xff,0xff
-  0x08,0x00,0x00,0x00,0x0c,0x01,0x00,0x00,0x20,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00
-  0x6e,0xbd,0xd1,0x3a,0xc4,0x68,0xd9,0x3a,0x07,0xf1,0xd4,0x3a
-  0xbc,0x8e,0xd9,0x3a,0x9b,0xad,0xe2,0x3a,0x14,0x0d,0xcf,0x3a
-  0x38,0x7d,0xd7,0x3a,0x93,0x55,0xd6,0x3a,0xdc,0x10,0xe0,0x3a
-  0x74,0x8a,0xd3,0x3a,0xa1,0xe8,0xc9,0x3a,0xd7,0x14,0xe7,0x3a
-  0x79,0x14,0xd2,0x3a,0x27,0x28,0xdf,0x3a,0x13,0x6b,0xd5,0x3a
-  0x3e,0xfa,0xc1,0x3a,0x38,0x7a,0xdd,0x3a,0x22,0xc4,0xde,0x3a
-  0xfa,0x22,0xce,0x3a,0x25,0x73,0xce,0x3a,0x1d,0x13,0xf9,0x3a
-  0xb2,0x81,0xde,0x3a,0xb4,0x6c,0xd2,0x3a,0x45,0x2a,0xc6,0x3a
-  0xff,0x35,0xc8,0x3a,0xf2,0xaa,0xbb,0x3a,0x41,0xee,0xe1,0x3a
-  0x28,0xb5,0xd7,0x3a,0xce,0x84,0xd4,0x3a,0x3a,0xa8,0xcd,0x3a
-  0xe5,0x21,0xd4,0x3a,0x4b,0xac,0xcf,0x3a,0x12,0x00,0x00,0x00
-  0x74,0x66,0x6c,0x2e,0x70,0x73,0x65,0x75,0x64,0x6f,0x5f,0x71
-  0x63,0x6f,0x6e,0x73,0x74,0x35,0x00,0x00,0x04,0x00,0x00,0x00
-  0x20,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x03,0x00,0x00,0x00
-  0x10,0x00,0x00,0x00,0x62,0xf5,0xff,0xff,0x00,0x00,0x00,0x01
-  0x14,0x00,0x00,0x00,0xa4,0x01,0x00,0x00,0x0b,0x00,0x00,0x00
-  0x00,0x00,0x00,0x02,0xb0,0x01,0x00,0x00,0xe4,0xf4,0xff,0xff
-  0x08,0x00,0x00,0x00,0x08,0x01,0x00,0x00,0x20,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x57,0x46,0x9e,0x3e
-  0xec,0x0f,0xa4,0x3e,0xd4,0xb0,0xa0,0x3e,0x93,0x2c,0xa4,0x3e
-  0x86,0x0e,0xab,0x3e,0xe5,0x3e,0x9c,0x3e,0xfd,0x9c,0xa2,0x3e
-  0xe3,0xbd,0xa1,0x3e,0xdf,0x15,0xa9,0x3e,0x3e,0xa2,0x9f,0x3e
-  0x79,0x5d,0x98,0x3e,0x29,0x61,0xae,0x3e,0x07,0x88,0x9e,0x3e
-  0x44,0x66,0xa8,0x3e,0xee,0x0c,0xa1,0x3e,0x4b,0x61,0x92,0x3e
-  0xd4,0x21,0xa7,0x3e,0xca,0x1a,0xa8,0x3e,0x3d,0x8e,0x9b,0x3e
-  0xbc,0xca,0x9b,0x3e,0x2a,0xf5,0xbb,0x3e,0xa7,0xe8,0xa7,0x3e
-  0x9b,0xca,0x9e,0x3e,0x45,0x8a,0x95,0x3e,0x7d,0x15,0x97,0x3e
-  0x5a,0x9e,0x8d,0x3e,0x20,0x7e,0xaa,0x3e,0x33,0xc7,0xa2,0x3e
-  0x29,0x5f,0xa0,0x3e,0x9b,0x31,0x9b,0x3e,0x86,0x14,0xa0,0x3e
-  0x0b,0xb7,0x9c,0x3e,0x12,0x00,0x00,0x00,0x74,0x66,0x6c,0x2e
-  0x70,0x73,0x65,0x75,0x64,0x6f,0x5f,0x71,0x63,0x6f,0x6e,0x73
-  0x74,0x34,0x00,0x00,0x01,0x00,0x00,0x00,0x20,0x00,0x00,0x00
-  0x32,0xf7,0xff,0xff,0x00,0x00,0x00,0x01,0x14,0x00,0x00,0x00
-  0x28,0x03,0x00,0x00,0x0a,0x00,0x00,0x00,0x00,0x00,0x00,0x09
-  0x34,0x03,0x00,0x00,0xb4,0xf6,0xff,0xff,0x08,0x00,0x00,0x00
-  0x0c,0x02,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00
-  0x8c,0x1c,0xf7,0x3a,0x22,0x1b,0x08,0x3b,0x00,0x2c,0xf0,0x3a
-  0xd5,0xb1,0xfe,0x3a,0x20,0x2c,0xf0,0x3a,0xb2,0xfd,0x02,0x3b
-  0x18,0x8a,0x07,0x3b,0xa3,0x71,0x00,0x3b,0x86,0xd5,0x14,0x3b
-  0x7f,0x4b,0xfe,0x3a,0xd2,0x9f,0x08,0x3b,0x41,0x3e,0xf5,0x3a
-  0x4b,0x7a,0x1b,0x3b,0x19,0x1b,0x04,0x3b,0x33,0xe6,0xe9,0x3a
-  0x32,0x1b,0xf3,0x3a,0xdc,0x99,0xfe,0x3a,0x5b,0xe5,0xf4,0x3a
-  0xe4,0x13,0x09,0x3b,0xb9,0xfa,0xf6,0x3a,0x5b,0x37,0x00,0x3b
-  0x43,0xc3,0x07,0x3b,0x61,0x36,0xf8,0x3a,0x87,0x05,0xfc,0x3a
-  0x3b,0xfa,0x06,0x3b,0xe2,0x49,0x02,0x3b,0x27,0x1b,0x09,0x3b
-  0x8d,0xba,0xfb,0x3a,0xc2,0x4c,0xfa,0x3a,0xc6,0xb6,0xff,0x3a
-  0x5b,0xbd,0xfb,0x3a,0x3c,0x6a,0xfd,0x3a,0x91,0xbc,0xec,0x3a
-  0x4f,0x16,0x00,0x3b,0xee,0x23,0x00,0x3b,0x19,0xc1,0x0e,0x3b
-  0x77,0x0f,0x00,0x3b,0x06,0x15,0xfd,0x3a,0xfe,0xb5,0x09,0x3b
-  0x9a,0xd9,0x01,0x3b,0xc2,0xca,0x02,0x3b,0xe6,0xc0,0xf9,0x3a
-  0xbf,0xa7,0x00,0x3b,0xd4,0x9c,0x00,0x3b,0x92,0xd3,0xf9,0x3a
-  0x32,0x3c,0x00,0x3b,0x10,0xae,0xf2,0x3a,0xd8,0xaf,0xfb,0x3a
-  0xf4,0x39,0x00,0x3b,0xb3,0xae,0xfe,0x3a,0x02,0x9b,0x00,0x3b
-  0x0f,0xd0,0x07,0x3b,0x30,0xae,0x00,0x3b,0xb2,0x43,0x0b,0x3b
-  0x12,0x2d,0xfb,0x3a,0x9c,0x68,0xf3,0x3a,0x0c,0x5e,0xfc,0x3a
-  0x3e,0x71,0xf9,0x3a,0x00,0x42,0xf2,0x3a,0x37,0x1f,0x0b,0x3b
-  0x1b,0xca,0xec,0x3a,0x45,0xca,0x00,0x3b,0x05,0x31,0xfc,0x3a
-  0x8e,0x25,0xf8,0x3a,0x12,0x00,0x00,0x00,0x74,0x66,0x6c,0x2e
-  0x70,0x73,0x65,0x75,0x64,0x6f,0x5f,0x71,0x63,0x6f,0x6e,0x73
-  0x74,0x33,0x00,0x00,0x02,0x00,0x00,0x00,0x40,0x00,0x00,0x00
-  0x20,0x00,0x00,0x00,0x8a,0xfa,0xff,0xff,0x00,0x00,0x00,0x01
-  0x14,0x00,0x00,0x00,0x24,0x03,0x00,0x00,0x09,0x00,0x00,0x00
-  0x00,0x00,0x00,0x02,0x30,0x03,0x00,0x00,0x0c,0xfa,0xff,0xff
-  0x08,0x00,0x00,0x00,0x08,0x02,0x00,0x00,0x40,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00
-  0x41,0x4e,0x54,0x3d,0xe8,0xde,0x69,0x3d,0xef,0x57,0x4e,0x3d
-  0x1b,0xd2,0x5a,0x3d,0x0b,0x58,0x4e,0x3d,0xe6,0x14,0x61,0x3d
-  0xaf,0xe5,0x68,0x3d,0x78,0xb4,0x5c,0x3d,0xcb,0xbd,0x7f,0x3d
-  0x2f,0x7a,0x5a,0x3d,0xe7,0xc2,0x6a,0x3d,0x54,0xb3,0x52,0x3d
-  0x1c,0x94,0x85,0x3d,0x4e,0xff,0x62,0x3d,0x50,0xf4,0x48,0x3d
-  0x53,0xdd,0x50,0x3d,0x83,0xbd,0x5a,0x3d,0xf3,0x66,0x52,0x3d
-  0x58,0x8a,0x6b,0x3d,0x31,0x31,0x54,0x3d,0x53,0x50,0x5c,0x3d
-  0xea,0x47,0x69,0x3d,0x64,0x40,0x55,0x3d,0x30,0x86,0x58,0x3d
-  0x7c,0xee,0x67,0x3d,0xee,0xdf,0x5f,0x3d,0xd3,0x96,0x6b,0x3d
-  0xc5,0x45,0x58,0x3d,0x80,0x0b,0x57,0x3d,0x4b,0xb2,0x5b,0x3d
-  0x2e,0x48,0x58,0x3d,0xa7,0xb8,0x59,0x3d,0x5f,0x64,0x4b,0x3d
-  0x8a,0x17,0x5c,0x3d,0xf2,0x2e,0x5c,0x3d,0x63,0x4b,0x75,0x3d
-  0xc8,0x0b,0x5c,0x3d,0x71,0x6f,0x59,0x3d,0xe2,0xa0,0x6c,0x3d
-  0xff,0x1e,0x5f,0x3d,0x60,0xbd,0x60,0x3d,0x57,0x93,0x56,0x3d
-  0x72,0x11,0x5d,0x3d,0xaf,0xfe,0x5c,0x3d,0x62,0xa3,0x56,0x3d
-  0xa4,0x58,0x5c,0x3d,0x90,0x7f,0x50,0x3d,0x92,0x3c,0x58,0x3d
-  0xca,0x54,0x5c,0x3d,0x6a,0xcf,0x5a,0x3d,0x8f,0xfb,0x5c,0x3d
-  0xe8,0x5d,0x69,0x3d,0x83,0x1c,0x5d,0x3d,0x42,0x4c,0x6f,0x3d
-  0x38,0xcc,0x57,0x3d,0xd5,0x1f,0x51,0x3d,0x3d,0xd2,0x58,0x3d
-  0xe7,0x4e,0x56,0x3d,0xb8,0x22,0x50,0x3d,0x92,0x0d,0x6f,0x3d
-  0x00,0x70,0x4b,0x3d,0xc4,0x4c,0x5d,0x3d,0x8e,0xab,0x58,0x3d
-  0xef,0x31,0x55,0x3d,0x12,0x00,0x00,0x00,0x74,0x66,0x6c,0x2e
-  0x70,0x73,0x65,0x75,0x64,0x6f,0x5f,0x71,0x63,0x6f,0x6e,0x73
-  0x74,0x32,0x00,0x00,0x01,0x00,0x00,0x00,0x40,0x00,0x00,0x00
-  0xda,0xfd,0xff,0xff,0x00,0x00,0x00,0x01,0x14,0x00,0x00,0x00
-  0x70,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x09
-  0x7c,0x00,0x00,0x00,0x5c,0xfd,0xff,0xff,0x08,0x00,0x00,0x00
-  0x3c,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x06,0x00,0x00,0x00,0x9c,0x0c,0x14,0x3b,0xbe,0x0b,0x13,0x3b
-  0x5a,0x92,0x14,0x3b,0xf4,0x24,0x13,0x3b,0xea,0x07,0x0c,0x3b
-  0x52,0x49,0x14,0x3b,0x12,0x00,0x00,0x00,0x74,0x66,0x6c,0x2e
-  0x70,0x73,0x65,0x75,0x64,0x6f,0x5f,0x71,0x63,0x6f,0x6e,0x73
-  0x74,0x31,0x00,0x00,0x02,0x00,0x00,0x00,0x06,0x00,0x00,0x00
-  0x40,0x00,0x00,0x00,0x7a,0xfe,0xff,0xff,0x00,0x00,0x00,0x01
-  0x14,0x00,0x00,0x00,0x6c,0x00,0x00,0x00,0x07,0x00,0x00,0x00
-  0x00,0x00,0x00,0x02,0x78,0x00,0x00,0x00,0xfc,0xfd,0xff,0xff
-  0x08,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x06,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  0x06,0x00,0x00,0x00,0x6f,0x0d,0xb8,0x38,0x1a,0xce,0xb6,0x38
-  0xb3,0xb3,0xb8,0x38,0x71,0xed,0xb6,0x38,0x8e,0x15,0xae,0x38
-  0xe9,0x58,0xb8,0x38,0x11,0x00,0x00,0x00,0x74,0x66,0x6c,0x2e
-  0x70,0x73,0x65,0x75,0x64,0x6f,0x5f,0x71,0x63,0x6f,0x6e,0x73
-  0x74,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x06,0x00,0x00,0x00
-  0x12,0xff,0xff,0xff,0x00,0x00,0x00,0x01,0x14,0x00,0x00,0x00
-  0x14,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x02
-  0x1c,0x00,0x00,0x00,0xfc,0xfe,0xff,0xff,0x0f,0x00,0x00,0x00
-  0x61,0x72,0x69,0x74,0x68,0x2e,0x63,0x6f,0x6e,0x73,0x74,0x61
-  0x6e,0x74,0x34,0x00,0x01,0x00,0x00,0x00,0x03,0x00,0x00,0x00
-  0x4e,0xff,0xff,0xff,0x00,0x00,0x00,0x01,0x14,0x00,0x00,0x00
-  0x14,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x02
-  0x1c,0x00,0x00,0x00,0x38,0xff,0xff,0xff,0x0f,0x00,0x00,0x00
-  0x61,0x72,0x69,0x74,0x68,0x2e,0x63,0x6f,0x6e,0x73,0x74,0x61
-  0x6e,0x74,0x33,0x00,0x01,0x00,0x00,0x00,0x03,0x00,0x00,0x00
-  0x8a,0xff,0xff,0xff,0x00,0x00,0x00,0x01,0x14,0x00,0x00,0x00
-  0x14,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x02
-  0x1c,0x00,0x00,0x00,0x74,0xff,0xff,0xff,0x0f,0x00,0x00,0x00
-  0x61,0x72,0x69,0x74,0x68,0x2e,0x63,0x6f,0x6e,0x73,0x74,0x61
-  0x6e,0x74,0x32,0x00,0x00,0x00,0x00,0x00,0xc2,0xff,0xff,0xff
-  0x00,0x00,0x00,0x01,0x14,0x00,0x00,0x00,0x14,0x00,0x00,0x00
-  0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x1c,0x00,0x00,0x00
-  0xac,0xff,0xff,0xff,0x0f,0x00,0x00,0x00,0x61,0x72,0x69,0x74
-  0x68,0x2e,0x63,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x31,0x00
-  0x01,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x16,0x00
-  0x1c,0x00,0x18,0x00,0x17,0x00,0x10,0x00,0x0c,0x00,0x08,0x00
-  0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x16,0x00,0x00,0x00
-  0x00,0x00,0x00,0x01,0x18,0x00,0x00,0x00,0x18,0x00,0x00,0x00
-  0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x20,0x00,0x00,0x00
-  0x04,0x00,0x04,0x00,0x04,0x00,0x00,0x00,0x0e,0x00,0x00,0x00
-  0x61,0x72,0x69,0x74,0x68,0x2e,0x63,0x6f,0x6e,0x73,0x74,0x61
-  0x6e,0x74,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x16,0x00
-  0x20,0x00,0x1c,0x00,0x1b,0x00,0x14,0x00,0x10,0x00,0x0c,0x00
-  0x00,0x00,0x00,0x00,0x08,0x00,0x07,0x00,0x16,0x00,0x00,0x00
-  0x00,0x00,0x00,0x01,0x18,0x00,0x00,0x00,0x30,0x00,0x00,0x00
-  0x50,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x09
-  0x68,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0xff,0xff,0xff,0xff
-  0x1e,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x0c,0x00,0x0c,0x00
-  0x00,0x00,0x00,0x00,0x08,0x00,0x04,0x00,0x0c,0x00,0x00,0x00
-  0x08,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x01,0x00,0x00,0x00
-  0x80,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00
-  0x01,0x00,0x00,0x00,0x69,0x3e,0x0f,0x44,0x1d,0x00,0x00,0x00
-  0x73,0x65,0x72,0x76,0x69,0x6e,0x67,0x5f,0x64,0x65,0x66,0x61
-  0x75,0x6c,0x74,0x5f,0x69,0x6e,0x70,0x75,0x74,0x5f,0x6c,0x61
-  0x79,0x65,0x72,0x3a,0x30,0x00,0x00,0x00,0x03,0x00,0x00,0x00
-  0x01,0x00,0x00,0x00,0x1e,0x00,0x00,0x00,0x01,0x00,0x00,0x00
-  0x07,0x00,0x00,0x00,0x90,0x00,0x00,0x00,0x70,0x00,0x00,0x00
-  0x54,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x2c,0x00,0x00,0x00
-  0x18,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0xb4,0xff,0xff,0xff
-  0x19,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x19
-  0xc4,0xff,0xff,0xff,0x09,0x00,0x00,0x00,0x04,0x00,0x00,0x00
-  0x00,0x00,0x00,0x09,0xd4,0xff,0xff,0xff,0x28,0x00,0x00,0x00
-  0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0xe4,0xff,0xff,0xff
-  0x11,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x11
-  0xd8,0xff,0xff,0xff,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x16
-  0x0c,0x00,0x10,0x00,0x0f,0x00,0x00,0x00,0x08,0x00,0x04,0x00
-  0x0c,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x00
-  0x00,0x00,0x00,0x03,0x0c,0x00,0x0c,0x00,0x0b,0x00,0x00,0x00
-  0x00,0x00,0x04,0x00,0x0c,0x00,0x00,0x00,0x46,0x00,0x00,0x00
+  0x1c,0x00,0x00,0x00,0x54,0x46,0x4c,0x33,0x14,0x00,0x20,0x00,
+  0x1c,0x00,0x18,0x00,0x14,0x00,0x10,0x00,0x0c,0x00,0x00,0x00,
+  0x08,0x00,0x04,0x00,0x14,0x00,0x00,0x00,0x1c,0x00,0x00,0x00,
+  0x88,0x00,0x00,0x00,0xe0,0x00,0x00,0x00,0x6c,0x14,0x00,0x00,
+  0x7c,0x14,0x00,0x00,0xec,0x30,0x00,0x00,0x03,0x00,0x00,0x00,
+  0x01,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x12,0xe9,0xff,0xff,
+  0x0c,0x00,0x00,0x00,0x1c,0x00,0x00,0x00,0x3c,0x00,0x00,0x00,
+  0x0f,0x00,0x00,0x00,0x73,0x65,0x72,0x76,0x69,0x6e,0x67,0x5f,
+  0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x00,0x01,0x00,0x00,0x00,
+  0x04,0x00,0x00,0x00,0x94,0xff,0xff,0xff,0x1a,0x00,0x00,0x00,
+  0x04,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x6f,0x75,0x74,0x70,
+  0x75,0x74,0x5f,0x30,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+  0x04,0x00,0x00,0x00,0x5a,0xeb,0xff,0xff,0x04,0x00,0x00,0x00,
+  0x0b,0x00,0x00,0x00,0x69,0x6e,0x70,0x75,0x74,0x5f,0x6c,0x61,
+  0x79,0x65,0x72,0x00,0x02,0x00,0x00,0x00,0x34,0x00,0x00,0x00,
+  0x04,0x00,0x00,0x00,0xdc,0xff,0xff,0xff,0x1d,0x00,0x00,0x00,
+  0x04,0x00,0x00,0x00,0x13,0x00,0x00,0x00,0x43,0x4f,0x4e,0x56,
+  0x45,0x52,0x53,0x49,0x4f,0x4e,0x5f,0x4d,0x45,0x54,0x41,0x44,
+  0x41,0x54,0x41,0x00,0x08,0x00,0x0c,0x00,0x08,0x00,0x04,0x00,
+  0x08,0x00,0x00,0x00,0x1c,0x00,0x00,0x00,0x04,0x00,0x00,0x00,
+  0x13,0x00,0x00,0x00,0x6d,0x69,0x6e,0x5f,0x72,0x75,0x6e,0x74,
+  0x69,0x6d,0x65,0x5f,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x00,
+  0x1e,0x00,0x00,0x00,0x88,0x13,0x00,0x00,0x80,0x13,0x00,0x00,
+  0x6c,0x13,0x00,0x00,0x50,0x13,0x00,0x00,0x3c,0x13,0x00,0x00,
+  0x20,0x13,0x00,0x00,0x04,0x13,0x00,0x00,0xdc,0x12,0x00,0x00,
+  0x4c,0x11,0x00,0x00,0x3c,0x10,0x00,0x00,0x2c,0x08,0x00,0x00,
+  0x9c,0x07,0x00,0x00,0x8c,0x01,0x00,0x00,0x3c,0x01,0x00,0x00,
+  0xfc,0x00,0x00,0x00,0xf4,0x00,0x00,0x00,0xec,0x00,0x00,0x00,
+  0xe4,0x00,0x00,0x00,0xdc,0x00,0x00,0x00,0xd4,0x00,0x00,0x00,
+  0xcc,0x00,0x00,0x00,0xc4,0x00,0x00,0x00,0xbc,0x00,0x00,0x00,
+  0xb4,0x00,0x00,0x00,0xac,0x00,0x00,0x00,0xa4,0x00,0x00,0x00,
+  0x9c,0x00,0x00,0x00,0x94,0x00,0x00,0x00,0x74,0x00,0x00,0x00,
+  0x04,0x00,0x00,0x00,0x4a,0xec,0xff,0xff,0x04,0x00,0x00,0x00,
+  0x60,0x00,0x00,0x00,0x0c,0x00,0x00,0x00,0x08,0x00,0x0e,0x00,
+  0x08,0x00,0x04,0x00,0x08,0x00,0x00,0x00,0x10,0x00,0x00,0x00,
+  0x28,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x08,0x00,0x04,0x00,
+  0x06,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+  0xeb,0x03,0x00,0x00,0x0c,0x00,0x18,0x00,0x14,0x00,0x10,0x00,
+  0x0c,0x00,0x04,0x00,0x0c,0x00,0x00,0x00,0x64,0x51,0x24,0x32,
+  0xbc,0xa1,0x16,0x0d,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+  0x04,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x32,0x2e,0x32,0x30,
+  0x2e,0x30,0x00,0x00,0xb6,0xec,0xff,0xff,0x04,0x00,0x00,0x00,
+  0x10,0x00,0x00,0x00,0x31,0x2e,0x31,0x34,0x2e,0x30,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xb8,0xd1,0xff,0xff,
+  0xbc,0xd1,0xff,0xff,0xc0,0xd1,0xff,0xff,0xc4,0xd1,0xff,0xff,
+  0xc8,0xd1,0xff,0xff,0xcc,0xd1,0xff,0xff,0xd0,0xd1,0xff,0xff,
+  0xd4,0xd1,0xff,0xff,0xd8,0xd1,0xff,0xff,0xdc,0xd1,0xff,0xff,
+  0xe0,0xd1,0xff,0xff,0xe4,0xd1,0xff,0xff,0xe8,0xd1,0xff,0xff,
+  0x06,0xed,0xff,0xff,0x04,0x00,0x00,0x00,0x30,0x00,0x00,0x00,
+  0x7f,0xfe,0x85,0x26,0xcc,0x7f,0x5c,0xa1,0x81,0x10,0x7f,0x88,
+  0xb8,0x7f,0x05,0xca,0xac,0x81,0x32,0x3b,0x7f,0xf1,0xb9,0x81,
+  0x57,0x7f,0x7a,0x24,0xbc,0x81,0x44,0x7f,0x79,0x13,0x81,0xa9,
+  0x81,0x63,0x00,0x7f,0x59,0xdf,0x7f,0xcd,0xf2,0x44,0xb1,0x81,
+  0x42,0xed,0xff,0xff,0x04,0x00,0x00,0x00,0x40,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x8e,0xed,0xff,0xff,0x04,0x00,0x00,0x00,
+  0x00,0x06,0x00,0x00,0xf2,0xab,0x84,0xbf,0x63,0xc2,0xa5,0x55,
+  0x74,0xf4,0xe4,0x72,0x7c,0xd4,0x09,0x1e,0x45,0x96,0x7f,0x2b,
+  0xc9,0x99,0x4d,0x63,0xe1,0x30,0x85,0x27,0x17,0x1b,0x08,0xc0,
+  0xd8,0x05,0xba,0x1a,0x79,0x18,0x72,0x91,0xa6,0xdf,0xe2,0x67,
+  0x7a,0xcf,0xb2,0xc2,0x25,0xc6,0x66,0xee,0xef,0x79,0x8c,0x0c,
+  0x81,0x93,0x2f,0x23,0xa2,0xfb,0x05,0x44,0xb3,0xff,0xee,0xc5,
+  0x9d,0xc5,0x03,0xe0,0x5d,0xdf,0xd9,0xea,0x88,0x0f,0xb0,0x51,
+  0xf7,0xb4,0xc5,0x4c,0x56,0xd8,0xde,0x05,0xb1,0x38,0xea,0xbd,
+  0x0a,0x11,0x86,0x5c,0xa1,0x43,0x8c,0xb6,0x40,0xdf,0xc1,0xb4,
+  0xf7,0x6d,0x3a,0xba,0x2d,0xca,0xe6,0x38,0x82,0x81,0x00,0x40,
+  0x3d,0x4d,0xc6,0x73,0x58,0x02,0xe4,0xef,0x12,0x17,0x25,0x1a,
+  0x15,0x8b,0xfd,0xac,0x45,0xb7,0xb3,0xf7,0x5c,0x05,0x15,0xe8,
+  0x3e,0xab,0x04,0xc9,0x97,0xbb,0x4f,0x00,0xcf,0xb8,0xb2,0xcc,
+  0xc2,0xdc,0x12,0xf4,0x01,0x6b,0x4b,0x90,0x23,0x23,0x6f,0x66,
+  0xd0,0xd8,0x7b,0x31,0x9f,0xe6,0x27,0xbe,0x42,0xe5,0xe1,0x85,
+  0x38,0x9a,0x3e,0x7b,0x9a,0x1e,0xb3,0x72,0x7f,0xd5,0xb6,0xa4,
+  0x1f,0x69,0x98,0x77,0xcb,0xa0,0xd8,0x37,0x34,0x25,0xa1,0xc1,
+  0xc6,0x4d,0x14,0x68,0xc2,0x24,0x78,0xdd,0xc6,0x57,0x90,0x20,
+  0x57,0x8d,0x6b,0x75,0x2e,0x95,0xd0,0xb5,0x43,0x25,0x99,0x2d,
+  0xa9,0xff,0xbf,0x0e,0x01,0xc5,0x0b,0x6d,0xed,0xf1,0x0c,0x7f,
+  0xaa,0xd4,0x4a,0x06,0xc2,0x15,0xe2,0x21,0x99,0x94,0x3d,0x68,
+  0x4d,0xdd,0x70,0x9c,0xa0,0xfe,0x67,0x86,0xa0,0x66,0x83,0x99,
+  0xb6,0x89,0x81,0x3b,0x31,0x26,0x52,0xcc,0xe4,0x8a,0x4e,0x48,
+  0x70,0x3b,0xf3,0x1a,0xbc,0xde,0xb8,0x7c,0xdd,0x71,0xea,0xea,
+  0xd3,0x13,0x87,0xd2,0x3b,0xd5,0x2e,0x23,0x42,0xc3,0x61,0x14,
+  0x10,0x89,0x9f,0xcb,0xdd,0x05,0x02,0xa6,0xb9,0x50,0x26,0x66,
+  0xc0,0x17,0x4e,0xc6,0xa3,0xad,0xef,0x4e,0xdd,0xe2,0x18,0xfd,
+  0x44,0x81,0xb2,0x03,0x66,0xea,0x50,0x35,0x5a,0xfb,0x22,0xee,
+  0x69,0x10,0x42,0xaa,0x4d,0x4f,0x17,0xaf,0xeb,0x86,0x6f,0x39,
+  0x5a,0x99,0x06,0x1e,0x87,0x32,0x4f,0xde,0x05,0x73,0xf5,0xe8,
+  0xe7,0x2b,0x56,0x8d,0x17,0xd1,0x94,0x44,0x70,0x83,0x3b,0xd1,
+  0x81,0x53,0xbd,0xa3,0xa4,0xb2,0x45,0xf6,0x4c,0x07,0x0e,0x72,
+  0xcd,0x62,0xb1,0x5d,0x2c,0xcd,0x1f,0x59,0xdc,0x54,0xb1,0xba,
+  0x5d,0x09,0xfb,0x4f,0x56,0x27,0x21,0xde,0x4e,0xe5,0x00,0xd9,
+  0x8f,0x9a,0x28,0x6d,0x48,0x28,0x4e,0x8d,0xe4,0x92,0xd9,0xee,
+  0x12,0xca,0xa7,0x0f,0x81,0x27,0xa9,0x1a,0x66,0xbe,0x57,0x16,
+  0xa6,0x48,0x9a,0xdd,0x42,0xe8,0x4b,0x8b,0x68,0x07,0x24,0x7e,
+  0xaa,0xc9,0x8a,0x39,0x04,0x6d,0xe8,0xa0,0x73,0x30,0xbc,0xd6,
+  0xe0,0x00,0x3f,0xa5,0x67,0xe1,0xdc,0x37,0xc0,0xcb,0xca,0x2b,
+  0x4f,0x2e,0x99,0xdc,0x77,0xf5,0xda,0x75,0x51,0x38,0xf0,0xee,
+  0x4a,0x81,0x0d,0x6d,0xea,0xa6,0x1a,0xf3,0x05,0x05,0x54,0x2b,
+  0x99,0xf2,0xce,0x67,0xb7,0x98,0x89,0x60,0xfd,0x36,0xe2,0xf2,
+  0xe8,0x4c,0x76,0x7f,0x7b,0x16,0x22,0x05,0xc1,0x85,0x89,0xa0,
+  0x40,0x5e,0xe7,0x21,0x0c,0xdc,0xdc,0xda,0xa6,0x28,0x14,0x7b,
+  0x46,0x8b,0x99,0xf0,0xeb,0x3e,0xd0,0x29,0x2c,0x01,0x5a,0xe7,
+  0x40,0x19,0x05,0xf2,0xf8,0x47,0x81,0xc3,0xb4,0xfe,0x95,0x82,
+  0x09,0xa4,0xf2,0x5b,0xfd,0xba,0xc4,0x79,0xe0,0x5e,0xb2,0xfb,
+  0x02,0x98,0x58,0x42,0x51,0x06,0xde,0x67,0x4d,0x2d,0x27,0x28,
+  0xf8,0x06,0xd7,0xef,0xb0,0xbb,0xc8,0xb8,0x12,0x5c,0x26,0x6f,
+  0x0b,0x71,0x96,0x2a,0x38,0x6d,0x5a,0x9e,0x9a,0xf1,0x8e,0x87,
+  0x66,0x7f,0xa7,0x9b,0x48,0x46,0xc2,0xda,0x41,0xef,0x37,0x32,
+  0xff,0x8e,0x19,0x92,0xd2,0xf2,0xcc,0x59,0x69,0xca,0xe3,0xb2,
+  0x53,0x21,0x6e,0xa5,0x15,0x2a,0xbf,0x3e,0x3b,0x44,0xba,0x9a,
+  0x63,0x60,0xac,0x53,0x09,0x34,0x28,0x11,0x81,0xe6,0x28,0xd2,
+  0x0a,0x71,0x63,0x27,0xe3,0x20,0x9f,0x37,0x1c,0xb7,0x3f,0x9f,
+  0xa4,0x0a,0x25,0x31,0xc1,0xef,0xc2,0x5f,0x8b,0x12,0x23,0x54,
+  0x4b,0x30,0x19,0xc9,0x9a,0x88,0x67,0xb9,0x5a,0xd6,0xce,0x3f,
+  0xc4,0x6c,0x23,0xa4,0x53,0x45,0x48,0x96,0x08,0xf7,0x50,0x51,
+  0x5c,0x0a,0xaf,0x66,0x63,0xba,0x68,0x0e,0x83,0x41,0xf2,0x9d,
+  0xd8,0x98,0x34,0x86,0x15,0xce,0x63,0x23,0x5f,0x32,0xe6,0xa7,
+  0x23,0xf1,0x81,0xe4,0xf7,0x94,0xeb,0x10,0x86,0x0c,0x1f,0xdb,
+  0x98,0x7b,0x94,0x68,0x7e,0x8f,0x26,0x60,0xc0,0xea,0x9e,0x8f,
+  0x15,0xd4,0x96,0x81,0x35,0x05,0x3c,0xc0,0x1d,0xaf,0x35,0x54,
+  0x03,0x68,0x14,0x1c,0xc8,0x5f,0xf6,0x35,0x45,0x83,0x6b,0xc0,
+  0x78,0xf5,0xbd,0xf8,0x43,0x49,0xa0,0x55,0xd6,0xc0,0x51,0xe4,
+  0x81,0x0d,0x5e,0xab,0xd0,0xcf,0xa2,0x9e,0xda,0xca,0x82,0xab,
+  0x5e,0x15,0xff,0xac,0x59,0x8f,0x26,0x2b,0x58,0x46,0xfa,0x20,
+  0xd1,0x4f,0x4c,0x1d,0xf6,0x51,0x35,0x25,0x85,0xbc,0x57,0x67,
+  0x8f,0x41,0x3c,0xc2,0xb8,0x2a,0x81,0xd5,0x96,0x22,0x5b,0xf2,
+  0x36,0x65,0x10,0xd0,0xe1,0x16,0x4a,0x18,0x93,0x19,0xf0,0x07,
+  0xa5,0x33,0xd1,0x17,0x62,0xb3,0xf5,0x4a,0xfd,0xa9,0xd9,0x67,
+  0x4e,0x34,0xc5,0x17,0x36,0x12,0x49,0x3e,0x2f,0xc0,0x5d,0xdc,
+  0x63,0xa8,0x61,0xfb,0x33,0x52,0x12,0x83,0xb3,0x50,0x55,0x62,
+  0xb1,0x92,0x26,0x1a,0x82,0x91,0x1d,0x1a,0xc7,0xd9,0x13,0xe9,
+  0x23,0x20,0xa6,0x8b,0x97,0x5f,0x1b,0x7f,0x9c,0xcd,0xf5,0x33,
+  0x53,0x2d,0x4a,0x4c,0xca,0x55,0xd8,0xdd,0x8d,0x9f,0x4e,0xdd,
+  0x34,0xf4,0x9d,0xf2,0x5a,0x8d,0xe4,0x95,0x11,0xa2,0x5b,0xc8,
+  0x5d,0xfb,0x1f,0x2b,0x83,0x8e,0xe6,0xc9,0x27,0x99,0xfd,0x83,
+  0x03,0xbf,0xe7,0x64,0x15,0xb0,0x40,0x2b,0x85,0xd0,0xe8,0x60,
+  0xdd,0x16,0xb7,0xbb,0x36,0x8d,0x7f,0x4d,0x35,0x35,0x07,0x39,
+  0xba,0xbf,0xfe,0x06,0x20,0xc6,0x1b,0x60,0x54,0xb9,0x9d,0xc2,
+  0xf8,0x16,0xcb,0x59,0xbf,0x13,0x08,0xbb,0xcd,0xc1,0x97,0xee,
+  0x32,0xbb,0xa2,0x21,0x81,0x83,0xbb,0x8a,0x2a,0xc8,0xf0,0x1d,
+  0xb0,0x4f,0x3a,0x4b,0x38,0xdd,0x1a,0x26,0x14,0xd2,0xae,0x21,
+  0xb5,0xe6,0xa4,0xa8,0x3c,0x52,0xb4,0xd7,0x59,0x22,0xb0,0xb8,
+  0xdd,0xba,0xab,0xd8,0x05,0x96,0xab,0x81,0x8a,0x10,0xa0,0xeb,
+  0xab,0xca,0x1d,0xf8,0x4b,0xb4,0x9e,0x39,0x17,0xfd,0xb6,0x07,
+  0xa0,0xfe,0x33,0xf8,0xcc,0x01,0xe3,0xbc,0x1d,0x07,0xd1,0x3e,
+  0xce,0x25,0x3d,0x11,0x9f,0x13,0xc0,0xa4,0xac,0x40,0xbd,0xa6,
+  0x1a,0x66,0xfc,0xd0,0xc5,0x46,0xd3,0x7b,0x2a,0x71,0x78,0x95,
+  0xd7,0x9c,0xfd,0xec,0xe8,0x43,0xd9,0xff,0x22,0x5e,0xab,0x40,
+  0xbe,0x5d,0x21,0x66,0xfb,0xbb,0xec,0x65,0x9c,0x7f,0x1b,0x46,
+  0x7b,0xdf,0x76,0x97,0x2e,0x52,0x29,0xaa,0xcc,0x82,0xd4,0xe4,
+  0xc0,0x5a,0xfd,0x1a,0x01,0xec,0x25,0xb7,0x23,0xb6,0xff,0xa2,
+  0x97,0x64,0x63,0x1a,0x0b,0xa4,0xd7,0x62,0x4c,0x55,0x4f,0x23,
+  0x00,0x47,0xfe,0x70,0x5c,0xfa,0x99,0x99,0x47,0xfe,0x53,0xb5,
+  0x65,0x17,0x81,0x8d,0xd8,0x26,0x29,0x89,0x7d,0x27,0x79,0x58,
+  0x27,0xf9,0xce,0x1a,0xbb,0x0f,0x95,0x00,0x4b,0xd9,0xc4,0x61,
+  0xab,0x45,0x58,0xb1,0xd4,0xaa,0x9c,0x69,0xf4,0x9b,0xe9,0x2b,
+  0x43,0x4b,0x37,0x18,0xf4,0x59,0xb6,0x1c,0x7f,0x01,0xb2,0x04,
+  0x48,0x5f,0x02,0xe2,0x79,0x8f,0xaf,0xe6,0xb8,0xf8,0x56,0x79,
+  0xb8,0x6c,0x50,0x79,0xa2,0xf3,0x5d,0xd2,0xd4,0x7f,0x1c,0xaa,
+  0x48,0xf0,0x13,0x81,0x12,0xf8,0x65,0x0e,0xf9,0x62,0x18,0x84,
+  0x84,0x0a,0x1f,0x70,0x6b,0xc5,0xa5,0x86,0xcc,0x85,0xe7,0x01,
+  0x32,0x66,0xb4,0x50,0xf7,0x89,0xd6,0xab,0x19,0xf6,0x6a,0x3a,
+  0x42,0x9e,0x05,0x68,0xbb,0x11,0x14,0x61,0x36,0x29,0xb2,0x1d,
+  0xcf,0xe3,0x14,0x09,0x5e,0x07,0x17,0xe6,0xa0,0x3a,0xd4,0x08,
+  0x63,0xe7,0x97,0x41,0x2d,0x9c,0xba,0x00,0x48,0xd4,0xfe,0xea,
+  0x81,0xa8,0xa4,0xd7,0x73,0x0c,0xdc,0x8f,0x22,0x6e,0x37,0xbf,
+  0x3b,0x59,0xa6,0x8a,0x5e,0x62,0x09,0xc5,0x59,0xc4,0x1e,0xb7,
+  0xf0,0x14,0x98,0x39,0x3e,0xa4,0x63,0x15,0x53,0x13,0xb5,0x9d,
+  0xad,0xe8,0xad,0x03,0x8b,0xab,0xd8,0x95,0x81,0xc1,0x90,0xf1,
+  0xdc,0x3d,0x00,0x5e,0x94,0x30,0xe1,0x8a,0x9f,0x62,0x74,0x0d,
+  0x02,0xce,0x46,0x44,0xe6,0x4c,0xdd,0xaa,0x48,0x73,0x81,0x9c,
+  0x66,0xd5,0x2c,0x9d,0x84,0xb9,0xb5,0xf1,0x95,0xe6,0x37,0x64,
+  0x91,0x05,0x06,0xa9,0x2e,0x12,0x56,0xd4,0x11,0x06,0x43,0x5c,
+  0x08,0x84,0x3e,0x3e,0x0d,0x5b,0x83,0xe3,0xcd,0xb1,0x3f,0x11,
+  0xac,0x00,0x3b,0xe3,0xf0,0xa6,0x00,0xff,0x0d,0x34,0x5c,0x81,
+  0xa9,0xf2,0x68,0x44,0x9c,0xa4,0x74,0xb4,0x39,0xc2,0xd8,0x2f,
+  0x3b,0x9b,0xca,0xd5,0x97,0xa2,0x07,0x3a,0xc4,0xb7,0xab,0x98,
+  0xa7,0x93,0xfd,0xd9,0x9e,0x12,0x43,0x84,0x56,0x53,0x40,0x9c,
+  0xa3,0x0b,0xf1,0x95,0xdf,0xe9,0x03,0xa2,0x82,0x63,0xc0,0x81,
+  0x25,0x4b,0x3a,0xcc,0x47,0x95,0xf3,0xca,0xfd,0x49,0x8c,0x2e,
+  0x0f,0x92,0xc2,0x24,0x40,0x93,0xfb,0x68,0x5e,0xa9,0xd2,0x90,
+  0x8b,0x81,0x5e,0xe3,0x7e,0x0c,0x0b,0x8e,0x91,0x6a,0xc6,0x43,
+  0x8c,0x39,0xf5,0x01,0x03,0xb4,0xa7,0xeb,0xf0,0x5b,0x97,0xa3,
+  0x10,0x15,0xc0,0x3a,0x27,0x1f,0xa1,0xa3,0x81,0x98,0x5e,0xcd,
+  0xe6,0x58,0x8a,0xaa,0xb0,0xe4,0xdb,0x98,0xcb,0xc3,0x9b,0xc4,
+  0x7f,0x74,0x5f,0x34,0x9a,0xf3,0xff,0xff,0x04,0x00,0x00,0x00,
+  0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x26,0xf4,0xff,0xff,0x04,0x00,0x00,0x00,0x00,0x08,0x00,0x00,
+  0x4d,0x0c,0x9d,0x22,0xc0,0xa9,0x85,0x51,0xf7,0x60,0x6b,0xcf,
+  0x60,0x17,0x91,0x1b,0x82,0x1a,0x87,0x81,0x7d,0x88,0x74,0xb4,
+  0x5a,0x34,0x76,0x8d,0xbc,0x2f,0x03,0x02,0x49,0x9b,0x14,0x8b,
+  0x48,0xac,0x5e,0x9d,0x4f,0xe9,0x84,0xf5,0x44,0x50,0x25,0x94,
+  0x4f,0xa4,0xd8,0x1f,0x5e,0xf1,0x21,0x6c,0x81,0x12,0xd1,0x59,
+  0x0f,0x53,0x23,0xbf,0x7f,0xb6,0x43,0x2a,0x02,0xf9,0x07,0xc3,
+  0xfc,0x48,0x09,0x44,0x10,0x9a,0x82,0xa5,0xe2,0x2c,0x31,0x6a,
+  0xba,0x6c,0x94,0x33,0x88,0xf1,0x4d,0xa8,0x89,0x01,0x7c,0x6a,
+  0x95,0xc8,0x4b,0x8d,0x07,0x69,0x38,0x39,0x9a,0x82,0x13,0xee,
+  0xa1,0x3a,0x5f,0x40,0x74,0xd2,0x3a,0xe8,0x5e,0xde,0x32,0x81,
+  0xc1,0x0a,0xe1,0xe8,0x57,0xab,0x37,0x8a,0xbe,0xf6,0xfc,0xad,
+  0x88,0x1d,0xfd,0x83,0x39,0x57,0x70,0x58,0x9e,0xca,0xdc,0x0e,
+  0xdd,0xe2,0x7f,0x4e,0xcb,0xb1,0x93,0xc4,0x41,0x82,0x7e,0x43,
+  0x1a,0x7f,0x6e,0x0b,0xea,0x21,0x81,0x54,0x23,0xa0,0x6c,0x3f,
+  0x9b,0xa0,0xff,0xf6,0xad,0xa6,0x31,0x2f,0x52,0x98,0x71,0x37,
+  0xad,0xb6,0xb1,0xb4,0x3b,0x59,0x8b,0xf4,0xa2,0x60,0xa4,0xe5,
+  0x53,0xb7,0xe6,0x13,0x3a,0x60,0xce,0x16,0x29,0x32,0xc2,0xfd,
+  0x28,0x9c,0xbf,0xff,0xd9,0xea,0x9c,0x85,0x3c,0xd3,0x51,0x03,
+  0xe3,0x0e,0x03,0xa0,0xd3,0xd0,0x81,0xc6,0xcc,0xd2,0xd1,0x2d,
+  0xe7,0x2c,0x24,0xa7,0x32,0x68,0x14,0x97,0x95,0xc5,0x4b,0x5d,
+  0xeb,0x5f,0xa4,0xe9,0x89,0xd1,0xb7,0x81,0x54,0xaf,0xa1,0xf9,
+  0x85,0x9e,0xf5,0xa2,0x06,0x38,0x1b,0xf3,0xf8,0x42,0xbb,0x23,
+  0x01,0xfc,0x33,0x18,0x91,0xb8,0xfd,0xf9,0xef,0x39,0xc3,0x1c,
+  0x16,0x65,0x81,0x30,0x9f,0xdb,0x56,0xba,0xaa,0x54,0x54,0x53,
+  0x21,0x47,0x2c,0x9e,0xdc,0xda,0xa8,0xb6,0x00,0x24,0xce,0xfc,
+  0xb7,0x6c,0x07,0xfa,0x93,0xad,0x54,0x12,0xa6,0xa1,0xea,0x7f,
+  0xb8,0x28,0xad,0x95,0x55,0xc8,0x59,0x10,0xb6,0xd1,0x4a,0xd1,
+  0x13,0xac,0x49,0x69,0xc2,0x26,0x07,0x9b,0x92,0xc2,0x81,0xea,
+  0x54,0xc3,0x4d,0x0d,0x55,0x2b,0x05,0xbd,0xfd,0x1f,0x6f,0xd4,
+  0x6c,0x08,0x83,0xe5,0x81,0x7f,0x20,0x02,0x2c,0xf2,0xc3,0x52,
+  0x76,0xe7,0x69,0x44,0x79,0x88,0x1e,0x64,0xb3,0x84,0x23,0x8b,
+  0x34,0xfd,0x05,0x3f,0x68,0xdb,0x9a,0x9d,0x9e,0xcd,0xa8,0xf1,
+  0xd3,0x38,0xf4,0xd9,0x9e,0xa5,0x3c,0xb7,0x51,0x05,0xa6,0xe3,
+  0x3c,0x45,0x36,0x31,0xad,0x43,0x1a,0x1f,0x37,0x15,0x81,0x48,
+  0x31,0xb2,0x35,0x1a,0xfd,0xbb,0xce,0xf7,0x39,0x41,0xe7,0xf6,
+  0x86,0xec,0x81,0x15,0xef,0x36,0x17,0x22,0x6c,0xcd,0x4e,0xad,
+  0x9a,0x40,0x48,0x64,0xab,0x79,0x1b,0x68,0xdc,0x05,0x29,0x89,
+  0x88,0xb4,0x45,0x46,0xcf,0x57,0x58,0x5a,0x81,0x19,0xc2,0x89,
+  0xc9,0x6a,0xd0,0x41,0xe4,0x68,0x68,0x4c,0x09,0x32,0xd0,0xde,
+  0xc0,0x7e,0xc4,0x26,0xa4,0x11,0xf7,0xa9,0xdc,0x00,0x2f,0x44,
+  0x7d,0x3a,0x3f,0xa2,0xc6,0xb3,0xd3,0x1a,0x64,0x1a,0x81,0x3a,
+  0xf3,0x0a,0x6d,0x43,0xd8,0x28,0xe5,0xbc,0x3f,0xd6,0xfa,0xab,
+  0x3b,0x98,0x0e,0x7b,0xbd,0x4c,0xf4,0x9f,0x10,0x8f,0xeb,0x4f,
+  0x1b,0x30,0xb9,0xc3,0x88,0x94,0xff,0x8b,0x11,0xe7,0xa6,0x48,
+  0x52,0x1a,0x7f,0x12,0x15,0xd8,0x53,0x36,0x9d,0xc7,0xfb,0x73,
+  0x0a,0xac,0x71,0xf2,0xec,0xee,0x01,0x66,0x08,0xad,0xf7,0xaf,
+  0x54,0xc9,0xf3,0x09,0x58,0x79,0x06,0x16,0x24,0xb0,0x8c,0xf8,
+  0x7f,0x8b,0x58,0x91,0xa8,0xa9,0xc6,0x8b,0xf6,0x6a,0x3d,0x29,
+  0xb4,0x28,0x3e,0x60,0x25,0x81,0x97,0x0e,0x3d,0x52,0xbe,0x5e,
+  0x84,0xff,0x9d,0xba,0x40,0xd5,0x68,0xfc,0x6a,0xc1,0x09,0x44,
+  0x3c,0x8c,0x57,0x45,0x13,0x91,0xcc,0x3b,0x0e,0x1f,0x17,0xb6,
+  0x5f,0xa9,0x6c,0x94,0x89,0x60,0x70,0x12,0x75,0x4f,0x9a,0xde,
+  0x7a,0x18,0xeb,0x64,0x24,0x04,0xf9,0xc4,0x14,0xc4,0x22,0x41,
+  0x55,0x81,0xef,0x71,0x15,0x22,0xc7,0xe7,0xda,0x26,0x6b,0xd0,
+  0x39,0xc8,0x94,0x79,0x0e,0x18,0x81,0xef,0x81,0x63,0x57,0xee,
+  0xd4,0x6a,0x21,0x49,0xb6,0x97,0x2f,0x6c,0xa2,0xd7,0xfa,0x96,
+  0xc7,0xe9,0xf8,0x5f,0x2b,0x0a,0xd0,0x4e,0x41,0x81,0x13,0xb9,
+  0x93,0x4a,0xe6,0x84,0x86,0xcf,0x30,0xdd,0xe9,0xa8,0x62,0x15,
+  0xe5,0x66,0x97,0x2d,0xdf,0xaf,0x69,0xa5,0x55,0x72,0x6e,0x49,
+  0x44,0x0e,0xf3,0xde,0x92,0x6e,0x1f,0x6f,0xa5,0x2a,0x0d,0x50,
+  0x86,0xb6,0x83,0x75,0x11,0xa5,0x87,0xef,0x1c,0xdc,0x04,0x09,
+  0x2e,0x7f,0xf6,0xd5,0x6f,0x9b,0xdf,0x64,0x4a,0xb0,0x14,0xee,
+  0xe1,0xd3,0x22,0xe7,0x2c,0x20,0xc0,0xb4,0x45,0xbf,0x52,0x93,
+  0xdb,0xa3,0xb7,0x45,0x71,0x81,0x01,0x22,0xc1,0x6f,0xd3,0x30,
+  0xff,0x2b,0x61,0x9c,0x2c,0xef,0x72,0x67,0x63,0x81,0x9b,0x3a,
+  0xcc,0x43,0xf4,0xef,0xf0,0xc6,0x6f,0x87,0x82,0xfb,0x0c,0x90,
+  0x85,0xf0,0x0a,0x3f,0xfd,0x9c,0x17,0xa7,0xaa,0x35,0x6e,0xfc,
+  0x69,0xb6,0xca,0xc1,0xc2,0x84,0x13,0x06,0x77,0x4e,0x33,0x00,
+  0xa3,0xf1,0xa6,0x91,0x71,0xe0,0x57,0xfd,0x72,0x6d,0x35,0x81,
+  0x54,0x52,0x67,0xc6,0x4f,0x3b,0x8e,0xc1,0x3a,0xaa,0x5d,0x64,
+  0xdb,0xdf,0xa8,0xdd,0x38,0xc7,0x1c,0xb6,0xff,0x81,0x00,0x3c,
+  0x39,0xe4,0x13,0x5e,0xdc,0x25,0x1b,0xab,0x8f,0xbc,0x87,0x29,
+  0x23,0x05,0x6d,0xe7,0xf6,0x41,0xa3,0xa2,0xa2,0xc2,0x55,0x5a,
+  0x81,0x4e,0x6b,0xce,0x7a,0x31,0x29,0xb4,0xd4,0x74,0x0a,0x87,
+  0x34,0x22,0x8d,0x06,0x58,0xb6,0x61,0xc8,0x5e,0x29,0xa9,0xc3,
+  0x29,0xdb,0x28,0x84,0x2b,0xf5,0x81,0xe0,0xd5,0x8b,0xcd,0x1a,
+  0xdb,0xa9,0x34,0x0c,0x03,0x72,0xc3,0xca,0xbc,0x72,0x4c,0x8e,
+  0x5a,0x73,0xa1,0x60,0xd6,0x48,0x6c,0x54,0x5f,0x89,0xe3,0xf2,
+  0xab,0xa9,0xeb,0xf2,0x9f,0x50,0xa8,0x14,0x11,0x9d,0xc2,0xd6,
+  0x31,0xce,0xe9,0xe4,0xe7,0xdc,0xa6,0x7f,0x53,0x7b,0x99,0xe4,
+  0x9b,0x7e,0xc9,0xb8,0xec,0x37,0xb2,0x60,0xaa,0x0c,0x4f,0xda,
+  0x35,0x0d,0x22,0x7e,0x33,0x84,0x1d,0x7f,0x4a,0x1f,0x02,0x31,
+  0x11,0x8f,0xff,0x90,0x3b,0xf4,0x86,0x41,0x24,0x60,0x4b,0x12,
+  0x3e,0x14,0x3b,0x22,0x1b,0xdc,0x32,0xbb,0x32,0xc7,0x81,0x20,
+  0xb4,0xa9,0x94,0xc6,0xef,0x57,0x5e,0xc3,0x96,0x27,0xeb,0x1d,
+  0xe6,0x40,0xf7,0xce,0x71,0xae,0xd4,0xdc,0x34,0x9e,0x9a,0x33,
+  0xb0,0x81,0x50,0x9e,0x3e,0x61,0xf8,0xf4,0x4c,0x39,0x7a,0xd8,
+  0x89,0xf1,0x9f,0x8d,0xdb,0xf6,0x78,0xfc,0x0c,0x97,0x73,0x4c,
+  0x97,0x14,0x9b,0x81,0xc5,0x91,0xe5,0xe4,0x4b,0xc4,0xda,0xa2,
+  0x27,0x56,0x26,0x49,0x25,0xfe,0x24,0xe4,0xcf,0x8f,0x4f,0xe9,
+  0xcb,0xe5,0x99,0xb6,0x19,0xd8,0x2e,0xf8,0x00,0x3e,0x8d,0xc2,
+  0x5e,0x75,0xcc,0x4b,0x09,0xe3,0xce,0xc3,0xd9,0xdb,0x59,0xf6,
+  0xab,0xf6,0x53,0x85,0xec,0xff,0xff,0xdd,0x7f,0xba,0x48,0x90,
+  0x2d,0x87,0xaa,0x71,0xe1,0x4f,0xbc,0x86,0xcf,0x2e,0x07,0x12,
+  0x4b,0xe5,0x4e,0xb6,0x53,0x81,0x5a,0xd0,0x1c,0xcc,0x55,0xb7,
+  0x2d,0x18,0x95,0x5a,0x23,0xfa,0x44,0x83,0x43,0x4c,0xf2,0xbe,
+  0xa2,0x7b,0x3f,0xce,0xce,0x70,0x40,0x86,0x59,0x3d,0xee,0x2b,
+  0x89,0x5b,0x81,0xc0,0xca,0xe7,0x0e,0xbf,0x7e,0x6b,0xa2,0x71,
+  0x6b,0x85,0xef,0x64,0x3d,0xe1,0xeb,0x5c,0x3f,0xa2,0xec,0x52,
+  0x3b,0xc8,0xee,0xb7,0xbf,0xed,0x2a,0xb2,0xa1,0xc9,0xe7,0xac,
+  0x81,0x01,0xed,0xc6,0x4a,0x7d,0x97,0xa5,0x07,0xd2,0x99,0xca,
+  0x56,0x92,0x66,0x27,0x5b,0x8e,0xa2,0x68,0x4e,0xa1,0x49,0xe5,
+  0xa3,0xe5,0xae,0x8f,0x50,0x23,0x08,0x22,0x31,0xba,0x63,0x22,
+  0x1a,0x41,0x81,0x52,0xa3,0x2c,0x8b,0x2e,0xb6,0xb9,0x60,0x4c,
+  0xa2,0xce,0x61,0x6d,0x8f,0x35,0x6d,0xb9,0xeb,0x81,0x75,0x9a,
+  0xfc,0x76,0x8e,0x8b,0x19,0xda,0x93,0x39,0xfe,0x5e,0x6d,0x63,
+  0x92,0x3e,0x49,0x8c,0x5c,0xb7,0x01,0x85,0x55,0x43,0x6f,0xb8,
+  0x28,0x21,0xe8,0x0b,0x6a,0xf1,0xa1,0x02,0xa0,0xfc,0x0e,0x1a,
+  0xe4,0x52,0x8d,0x88,0x2b,0x6e,0x9b,0x84,0x81,0xe5,0xad,0xf5,
+  0x3d,0x54,0x6b,0xc1,0x81,0x72,0xa8,0xd8,0x03,0x96,0xe2,0xf1,
+  0x6e,0x01,0x35,0x18,0x4c,0x66,0x5e,0xb6,0x71,0xd2,0x03,0x92,
+  0x83,0x06,0x84,0xa9,0x4d,0x1d,0xac,0x50,0xcd,0x8c,0x2c,0xea,
+  0x55,0x3e,0x34,0xb0,0xf4,0xa0,0x86,0xe9,0x5b,0xe5,0x97,0xfe,
+  0xce,0x91,0x2b,0xe9,0x95,0x17,0x81,0x78,0x85,0xe9,0xe5,0xc1,
+  0x3f,0x78,0x5d,0x95,0xdf,0x70,0x8a,0xeb,0xea,0xc8,0x6e,0xae,
+  0x10,0x81,0x71,0x9b,0xb5,0xd8,0xce,0xa5,0xd4,0xc4,0x22,0x2f,
+  0xea,0x69,0x13,0xba,0x7e,0xe2,0xa2,0x99,0xdd,0xb6,0x6f,0x2e,
+  0xc1,0x35,0x4a,0x30,0xbc,0xe5,0x5a,0xaa,0x97,0x25,0xf6,0x1b,
+  0x6f,0x65,0xd8,0xc4,0x4d,0xfa,0x01,0xd2,0x21,0x36,0x66,0x38,
+  0xa0,0x12,0x81,0x10,0x0b,0xe0,0xa6,0xab,0xa9,0x75,0xce,0x9d,
+  0x99,0x0a,0xca,0x0c,0x91,0x89,0x1b,0x1e,0x0c,0x13,0x0e,0xf6,
+  0x45,0x5e,0x44,0xb0,0x97,0xcd,0x7f,0x01,0x73,0x17,0x92,0x41,
+  0x28,0xee,0x66,0x59,0x61,0x71,0x22,0xcd,0xfc,0x09,0xe2,0x5c,
+  0xa1,0x09,0xbd,0xbc,0xed,0xab,0xcf,0x34,0x5f,0xa8,0x6f,0x7f,
+  0x31,0xa4,0xe4,0x78,0x67,0xdb,0xa7,0xea,0xc1,0x10,0x5a,0xb0,
+  0x44,0x76,0xae,0xcc,0x13,0x7d,0x1c,0xf6,0xcb,0x64,0xfe,0x4b,
+  0x1a,0x2e,0xa2,0xd3,0x0e,0xff,0xe8,0xf2,0x9e,0x49,0x3a,0xdd,
+  0x0f,0x62,0x1c,0xc1,0xbc,0x05,0x81,0xb7,0xe1,0xd3,0x5a,0xaa,
+  0xa7,0x92,0x70,0x30,0x65,0x90,0xb6,0x31,0x4d,0xeb,0xa5,0xbf,
+  0xde,0xa3,0x81,0x95,0xed,0xef,0x69,0xde,0xcf,0x38,0xcc,0x3b,
+  0xf6,0xce,0xb3,0x35,0x30,0x87,0xe8,0x55,0x92,0x33,0x40,0xb3,
+  0x45,0x94,0xee,0xbd,0x44,0x61,0x54,0xd9,0xbe,0xdd,0x73,0xb5,
+  0xe8,0xfe,0x9a,0xe4,0xa3,0x2b,0x81,0xc0,0x4b,0x5d,0xc2,0x6e,
+  0x61,0x59,0x65,0x62,0x81,0x6d,0xfe,0xcb,0x59,0x6b,0xa5,0xc2,
+  0x4d,0x4e,0x81,0xe7,0xb5,0x4c,0x7d,0x6e,0xb8,0x8b,0x7e,0x31,
+  0x67,0xd9,0x84,0xcc,0xd5,0x9f,0x0e,0x3f,0xc7,0x30,0xbd,0x67,
+  0x40,0x1f,0x01,0xea,0x95,0x61,0xbf,0x29,0x89,0xd1,0x52,0xb1,
+  0x29,0xa4,0x30,0xd1,0x1f,0x41,0x3a,0x0d,0xd8,0x98,0x0c,0x81,
+  0x58,0x28,0x4e,0x5a,0x52,0x2c,0xa3,0xbd,0x25,0x95,0x47,0x96,
+  0xb8,0xfc,0x8b,0x0f,0x4b,0xc0,0x25,0xe9,0x50,0x4a,0x86,0x84,
+  0x8f,0xec,0x51,0x1b,0xf0,0x3f,0x0a,0x0f,0x1d,0x5c,0x00,0x78,
+  0x7f,0x0f,0x3d,0x62,0x12,0x2c,0x5c,0xb3,0x81,0xfd,0x51,0x29,
+  0x31,0x94,0x94,0xc3,0x43,0x44,0x9b,0xd0,0x95,0x52,0x9f,0x1e,
+  0x28,0xe0,0x85,0xdb,0x59,0x49,0x04,0x51,0xee,0x8f,0x67,0x32,
+  0xa8,0xb3,0xf5,0xc3,0x92,0x43,0x7f,0xc2,0xb7,0x5a,0x44,0x77,
+  0xec,0xf7,0x03,0xf8,0xb2,0xc9,0xd5,0xf8,0xef,0x85,0x24,0xd8,
+  0x56,0x31,0xfd,0x2f,0xe4,0xb3,0xa9,0x90,0xc3,0x30,0xb6,0x1d,
+  0x88,0x90,0xbc,0x28,0x81,0x2f,0x91,0x02,0xad,0x3d,0x7a,0x0d,
+  0x7c,0x99,0x52,0xd3,0x38,0x12,0x63,0x35,0xaa,0x53,0xa4,0xaa,
+  0x4a,0x5c,0x2c,0x3b,0x98,0x0e,0x02,0xb1,0x2b,0xcc,0xe8,0x94,
+  0x79,0xe6,0x28,0x70,0x26,0x66,0x40,0xe9,0xa1,0x7b,0xda,0x08,
+  0x46,0x7a,0x21,0x8e,0xac,0x93,0xe5,0xdf,0x7c,0x03,0x7f,0x33,
+  0x77,0xe5,0xb4,0x98,0x14,0xbb,0xb6,0x4b,0xc7,0x00,0x36,0xb2,
+  0xb7,0xc5,0x5d,0xfa,0x7b,0xd9,0xe3,0xa3,0xa9,0x31,0xb6,0xbe,
+  0xf7,0x13,0xf4,0x95,0x6a,0x86,0xa8,0x81,0xd1,0x1c,0x82,0xd9,
+  0x54,0xa5,0xac,0xb4,0xfa,0xc1,0xd0,0x60,0xe9,0x7a,0x18,0xa3,
+  0x48,0xc6,0x45,0x8c,0x56,0xc8,0x7f,0xd0,0xcd,0x3c,0x37,0x2e,
+  0x4a,0xb1,0xfe,0x40,0xc4,0x06,0x99,0xed,0x9e,0x61,0x5b,0xa3,
+  0x0f,0xfd,0x35,0xca,0xe6,0x3a,0xda,0x59,0x21,0x39,0x68,0x54,
+  0xd3,0xd6,0x4e,0xe8,0x07,0x81,0x9e,0x32,0x40,0x90,0x39,0x5f,
+  0x3c,0x87,0x7c,0xab,0x0f,0x5d,0xb4,0x81,0xf9,0xb1,0xf9,0xc1,
+  0x16,0x1e,0xf9,0x48,0xaf,0x65,0xe6,0x17,0x30,0x6f,0x38,0x12,
+  0x99,0x7c,0x9e,0x63,0xe5,0xf2,0x1b,0x3c,0x3b,0xe7,0x7a,0x9d,
+  0xce,0x46,0xd1,0xf5,0xf6,0x21,0x6d,0x97,0x97,0xf1,0x16,0xe5,
+  0x9e,0x3e,0x1e,0x81,0x64,0x1d,0xcb,0xae,0x9c,0x2e,0xd6,0xa2,
+  0x2e,0xc1,0x6d,0xe4,0xea,0x59,0x8d,0x61,0xc5,0x6d,0x24,0x1e,
+  0xfd,0x39,0x94,0x3d,0x99,0x77,0x6b,0x83,0x4e,0xbd,0x76,0xe4,
+  0x0e,0xc9,0x8f,0x9f,0x19,0x06,0x81,0xcf,0x30,0x25,0x4e,0xdf,
+  0xbb,0x2e,0x23,0x06,0x7f,0x82,0xed,0x13,0x92,0x5e,0x1e,0x5c,
+  0x44,0x82,0x07,0x29,0x45,0xef,0x63,0x01,0x3f,0x83,0x45,0xe5,
+  0x05,0xa3,0x09,0x08,0x9d,0xd5,0xa4,0x99,0x32,0xfc,0xff,0xff,
+  0x04,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,
+  0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x3e,0xfd,0xff,0xff,0x04,0x00,0x00,0x00,0x80,0x01,0x00,0x00,
+  0xdc,0xe1,0x07,0x35,0xd2,0x5a,0x2a,0x36,0xb1,0x79,0x77,0x5f,
+  0x5f,0xd9,0x69,0x8b,0xc4,0xf4,0x37,0x93,0x25,0xb1,0xd8,0xf4,
+  0x7b,0xec,0x89,0x55,0x20,0x9c,0x7f,0x18,0x41,0xa2,0x45,0xf9,
+  0x8e,0xc4,0x31,0xa8,0x22,0x33,0x1d,0x2a,0x2b,0x0b,0x86,0x9d,
+  0xfc,0x35,0x87,0x15,0x12,0xbd,0xa4,0x69,0xcc,0x6c,0x0e,0xef,
+  0x8b,0x86,0xa9,0x7f,0x33,0xff,0xf8,0x78,0x5c,0xc5,0xfd,0x22,
+  0x91,0x42,0xdf,0x92,0x39,0xe5,0x08,0xef,0xb4,0x16,0xf4,0x6a,
+  0x5e,0x1b,0x50,0xbf,0x50,0xe8,0x22,0xf4,0xe2,0x63,0xfd,0x6d,
+  0xfe,0x63,0xf7,0x4d,0xaf,0x19,0x52,0xe6,0x7f,0x64,0x4e,0x54,
+  0xf9,0xcb,0x01,0xb0,0x11,0xcb,0xb7,0x84,0x32,0xeb,0x95,0xc2,
+  0xfd,0x69,0x69,0x12,0x6a,0x7b,0x29,0x49,0x89,0xce,0x55,0x40,
+  0x66,0xcd,0x9a,0x41,0x1a,0x4a,0xea,0x45,0x4a,0x42,0x33,0x13,
+  0x86,0x97,0x26,0x33,0x50,0x19,0xc5,0xd9,0xc5,0xf2,0xca,0x47,
+  0x56,0x0d,0x6f,0xe1,0x1f,0xc8,0x19,0x28,0x73,0x03,0x7c,0xce,
+  0xbc,0x0a,0xe1,0x5a,0x32,0x3d,0x10,0xc3,0x81,0xaf,0xa4,0x89,
+  0x3f,0xb9,0xd5,0x74,0x18,0x33,0xd8,0xc1,0x3b,0xa8,0xb4,0x5b,
+  0xee,0x8d,0xe1,0x94,0x45,0xd6,0x15,0x88,0x62,0xff,0xf1,0xad,
+  0x64,0x58,0xa7,0x90,0xbc,0x06,0x38,0x22,0x7a,0xb5,0x28,0x8a,
+  0x0d,0x3b,0xd7,0x42,0x7b,0xde,0xfd,0x19,0x72,0x5b,0xda,0x6a,
+  0x85,0xe5,0x4c,0xc4,0x29,0x26,0xdf,0x2d,0xc3,0xd2,0x2b,0x7f,
+  0xde,0xd4,0x68,0x33,0xb7,0xb3,0xa4,0xfc,0x16,0xb4,0x89,0xb2,
+  0x70,0x04,0xb7,0x90,0x74,0x3e,0xe3,0xb2,0x4f,0xc2,0x4e,0x46,
+  0x66,0x7c,0x89,0x1d,0x16,0x37,0x6b,0xed,0x93,0x0d,0x28,0x52,
+  0xb0,0x9f,0x0f,0xb2,0x6a,0x4b,0x61,0x77,0x61,0x51,0xe7,0xd7,
+  0x42,0x3e,0xfa,0x37,0x86,0x28,0xdb,0xfe,0xd0,0x70,0x79,0x81,
+  0x12,0xbe,0x74,0x6f,0xef,0xca,0x3b,0xe7,0xbd,0xb1,0x94,0x4c,
+  0xcd,0xaa,0xad,0xf3,0x34,0x28,0xed,0x3c,0x3b,0xca,0x00,0x04,
+  0x8a,0x76,0xf8,0xc9,0xbe,0x81,0xde,0xfa,0x4e,0xe5,0xfe,0x0d,
+  0xbb,0xa8,0xa0,0x2e,0x55,0xde,0x35,0x20,0x27,0xd0,0xe3,0x39,
+  0x59,0x62,0xc0,0x50,0x96,0xb1,0x52,0xe5,0x41,0xe0,0x75,0x74,
+  0x0f,0x98,0xae,0x78,0x31,0x90,0x74,0x99,0x0e,0x5d,0x47,0x3c,
+  0x2a,0xe3,0xe0,0x4c,0xf9,0x71,0x89,0x30,0xef,0x78,0xfd,0xf3,
+  0xca,0xfe,0xff,0xff,0x04,0x00,0x00,0x00,0x18,0x00,0x00,0x00,
+  0xf7,0xfe,0xff,0xff,0x06,0x00,0x00,0x00,0x9d,0x01,0x00,0x00,
+  0xc7,0x00,0x00,0x00,0x42,0x00,0x00,0x00,0xec,0xfe,0xff,0xff,
+  0xee,0xfe,0xff,0xff,0x04,0x00,0x00,0x00,0x0c,0x00,0x00,0x00,
+  0xff,0xff,0xff,0xff,0x0c,0x00,0x00,0x00,0x20,0x00,0x00,0x00,
+  0x06,0xff,0xff,0xff,0x04,0x00,0x00,0x00,0x0c,0x00,0x00,0x00,
+  0xff,0xff,0xff,0xff,0x0e,0x00,0x00,0x00,0x10,0x00,0x00,0x00,
+  0x1e,0xff,0xff,0xff,0x04,0x00,0x00,0x00,0x04,0x00,0x00,0x00,
+  0x01,0x00,0x00,0x00,0x2e,0xff,0xff,0xff,0x04,0x00,0x00,0x00,
+  0x0c,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x1c,0x00,0x00,0x00,
+  0x10,0x00,0x00,0x00,0x46,0xff,0xff,0xff,0x04,0x00,0x00,0x00,
+  0x04,0x00,0x00,0x00,0xfd,0xff,0xff,0xff,0x3c,0xe4,0xff,0xff,
+  0x40,0xe4,0xff,0xff,0x0f,0x00,0x00,0x00,0x4d,0x4c,0x49,0x52,
+  0x20,0x43,0x6f,0x6e,0x76,0x65,0x72,0x74,0x65,0x64,0x2e,0x00,
+  0x01,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x00,0x00,0x0e,0x00,
+  0x18,0x00,0x14,0x00,0x10,0x00,0x0c,0x00,0x08,0x00,0x04,0x00,
+  0x0e,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x1c,0x00,0x00,0x00,
+  0x2c,0x03,0x00,0x00,0x30,0x03,0x00,0x00,0x34,0x03,0x00,0x00,
+  0x04,0x00,0x00,0x00,0x6d,0x61,0x69,0x6e,0x00,0x00,0x00,0x00,
+  0x0d,0x00,0x00,0x00,0xe4,0x02,0x00,0x00,0x80,0x02,0x00,0x00,
+  0x48,0x02,0x00,0x00,0x0c,0x02,0x00,0x00,0xb8,0x01,0x00,0x00,
+  0x90,0x01,0x00,0x00,0x60,0x01,0x00,0x00,0x18,0x01,0x00,0x00,
+  0xf0,0x00,0x00,0x00,0xbc,0x00,0x00,0x00,0x78,0x00,0x00,0x00,
+  0x40,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0xbe,0xfd,0xff,0xff,
+  0x1c,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0x1c,0x00,0x00,0x00,
+  0x20,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x06,0x00,
+  0x08,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x80,0x3f,
+  0x01,0x00,0x00,0x00,0x1a,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+  0x19,0x00,0x00,0x00,0xf6,0xfd,0xff,0xff,0x14,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x08,0x10,0x00,0x00,0x00,0x14,0x00,0x00,0x00,
+  0x05,0x00,0x00,0x00,0x1c,0xe5,0xff,0xff,0x01,0x00,0x00,0x00,
+  0x19,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x18,0x00,0x00,0x00,
+  0x07,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x2a,0xfe,0xff,0xff,
+  0x1c,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x1c,0x00,0x00,0x00,
+  0x20,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x06,0x00,
+  0x08,0x00,0x07,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
+  0x01,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x03,0x00,0x00,0x00,
+  0x17,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x08,0x00,0x00,0x00,
+  0x6a,0xfe,0xff,0xff,0x14,0x00,0x00,0x00,0x00,0x00,0x00,0x1b,
+  0x10,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x04,0x00,0x00,0x00,
+  0x90,0xe5,0xff,0xff,0x01,0x00,0x00,0x00,0x17,0x00,0x00,0x00,
+  0x02,0x00,0x00,0x00,0x16,0x00,0x00,0x00,0x03,0x00,0x00,0x00,
+  0xca,0xfe,0xff,0xff,0x0c,0x00,0x00,0x00,0x10,0x00,0x00,0x00,
+  0x02,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x16,0x00,0x00,0x00,
+  0x02,0x00,0x00,0x00,0x15,0x00,0x00,0x00,0x05,0x00,0x00,0x00,
+  0xbe,0xfe,0xff,0xff,0x14,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
+  0x20,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+  0xb0,0xfe,0xff,0xff,0x00,0x00,0x00,0x01,0x01,0x00,0x00,0x00,
+  0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x00,0x00,0x00,
+  0x15,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x14,0x00,0x00,0x00,
+  0x0b,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,0xa2,0xfe,0xff,0xff,
+  0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0x0c,0x00,0x00,0x00,
+  0x10,0x00,0x00,0x00,0x24,0xe6,0xff,0xff,0x01,0x00,0x00,0x00,
+  0x14,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x13,0x00,0x00,0x00,
+  0x01,0x00,0x00,0x00,0x5e,0xff,0xff,0xff,0x0c,0x00,0x00,0x00,
+  0x10,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+  0x13,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x12,0x00,0x00,0x00,
+  0x04,0x00,0x00,0x00,0x52,0xff,0xff,0xff,0x24,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x05,0x34,0x00,0x00,0x00,0x38,0x00,0x00,0x00,
+  0x03,0x00,0x00,0x00,0x00,0x00,0x0e,0x00,0x18,0x00,0x17,0x00,
+  0x10,0x00,0x0c,0x00,0x08,0x00,0x04,0x00,0x0e,0x00,0x00,0x00,
+  0x01,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+  0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x00,0x00,0x00,
+  0x12,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x11,0x00,0x00,0x00,
+  0x42,0xff,0xff,0xff,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x34,
+  0x0c,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0xc4,0xe6,0xff,0xff,
+  0x01,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+  0x10,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x0a,0x00,
+  0x10,0x00,0x0c,0x00,0x08,0x00,0x04,0x00,0x0a,0x00,0x00,0x00,
+  0x0c,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+  0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+  0x0f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x0e,0x00,
+  0x18,0x00,0x14,0x00,0x10,0x00,0x0c,0x00,0x0b,0x00,0x04,0x00,
+  0x0e,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
+  0x2c,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+  0x0c,0x00,0x14,0x00,0x13,0x00,0x0c,0x00,0x08,0x00,0x07,0x00,
+  0x0c,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x00,0x00,0x00,
+  0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x00,0x00,0x00,
+  0x0f,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,
+  0x0d,0x00,0x00,0x00,0x0c,0x00,0x00,0x00,0x00,0x00,0x0e,0x00,
+  0x14,0x00,0x00,0x00,0x10,0x00,0x0c,0x00,0x0b,0x00,0x04,0x00,
+  0x0e,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x34,
+  0x0c,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x90,0xe7,0xff,0xff,
+  0x01,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+  0x1a,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x1b,0x00,0x00,0x00,0x7c,0x18,0x00,0x00,0x24,0x18,0x00,0x00,
+  0xcc,0x17,0x00,0x00,0x90,0x17,0x00,0x00,0x50,0x17,0x00,0x00,
+  0x10,0x17,0x00,0x00,0x74,0x16,0x00,0x00,0xd0,0x15,0x00,0x00,
+  0x7c,0x12,0x00,0x00,0x20,0x0f,0x00,0x00,0x4c,0x0d,0x00,0x00,
+  0x68,0x0b,0x00,0x00,0x54,0x0a,0x00,0x00,0x30,0x09,0x00,0x00,
+  0x8c,0x08,0x00,0x00,0x90,0x07,0x00,0x00,0xc0,0x06,0x00,0x00,
+  0x18,0x06,0x00,0x00,0x7c,0x05,0x00,0x00,0xe4,0x04,0x00,0x00,
+  0x44,0x04,0x00,0x00,0x40,0x03,0x00,0x00,0x68,0x02,0x00,0x00,
+  0xd8,0x01,0x00,0x00,0x24,0x01,0x00,0x00,0x80,0x00,0x00,0x00,
+  0x04,0x00,0x00,0x00,0x06,0xe8,0xff,0xff,0x00,0x00,0x00,0x01,
+  0x18,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x3c,0x00,0x00,0x00,
+  0x1b,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0x50,0x00,0x00,0x00,
+  0x02,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x06,0x00,0x00,0x00,
+  0xec,0xe7,0xff,0xff,0x08,0x00,0x00,0x00,0x10,0x00,0x00,0x00,
+  0x01,0x00,0x00,0x00,0x80,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0x01,0x00,0x00,0x00,0x00,0x00,0x80,0x3b,0x1b,0x00,0x00,0x00,
+  0x53,0x74,0x61,0x74,0x65,0x66,0x75,0x6c,0x50,0x61,0x72,0x74,
+  0x69,0x74,0x69,0x6f,0x6e,0x65,0x64,0x43,0x61,0x6c,0x6c,0x5f,
+  0x31,0x3a,0x30,0x00,0x02,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+  0x06,0x00,0x00,0x00,0x7e,0xe8,0xff,0xff,0x00,0x00,0x00,0x01,
+  0x18,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x40,0x00,0x00,0x00,
+  0x1a,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0x78,0x00,0x00,0x00,
+  0x02,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x06,0x00,0x00,0x00,
+  0x64,0xe8,0xff,0xff,0x08,0x00,0x00,0x00,0x14,0x00,0x00,0x00,
+  0x01,0x00,0x00,0x00,0xf6,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x28,0x2c,0x77,0x3c,
+  0x3c,0x00,0x00,0x00,0x73,0x65,0x71,0x75,0x65,0x6e,0x74,0x69,
+  0x61,0x6c,0x5f,0x31,0x2f,0x64,0x65,0x6e,0x73,0x65,0x5f,0x31,
+  0x5f,0x32,0x2f,0x4d,0x61,0x74,0x4d,0x75,0x6c,0x3b,0x73,0x65,
+  0x71,0x75,0x65,0x6e,0x74,0x69,0x61,0x6c,0x5f,0x31,0x2f,0x64,
+  0x65,0x6e,0x73,0x65,0x5f,0x31,0x5f,0x32,0x2f,0x42,0x69,0x61,
+  0x73,0x41,0x64,0x64,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+  0x01,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x1e,0xe9,0xff,0xff,
+  0x00,0x00,0x00,0x01,0x18,0x00,0x00,0x00,0x20,0x00,0x00,0x00,
+  0x3c,0x00,0x00,0x00,0x19,0x00,0x00,0x00,0x00,0x00,0x00,0x09,
+  0x88,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0xff,0xff,0xff,0xff,
+  0x40,0x00,0x00,0x00,0x04,0xe9,0xff,0xff,0x08,0x00,0x00,0x00,
+  0x10,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x80,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0xa8,0x20,0x1f,0x3d,
+  0x52,0x00,0x00,0x00,0x73,0x65,0x71,0x75,0x65,0x6e,0x74,0x69,
+  0x61,0x6c,0x5f,0x31,0x2f,0x64,0x65,0x6e,0x73,0x65,0x5f,0x31,
+  0x2f,0x4d,0x61,0x74,0x4d,0x75,0x6c,0x3b,0x73,0x65,0x71,0x75,
+  0x65,0x6e,0x74,0x69,0x61,0x6c,0x5f,0x31,0x2f,0x64,0x65,0x6e,
+  0x73,0x65,0x5f,0x31,0x2f,0x52,0x65,0x6c,0x75,0x3b,0x73,0x65,
+  0x71,0x75,0x65,0x6e,0x74,0x69,0x61,0x6c,0x5f,0x31,0x2f,0x64,
+  0x65,0x6e,0x73,0x65,0x5f,0x31,0x2f,0x42,0x69,0x61,0x73,0x41,
+  0x64,0x64,0x00,0x00,0x02,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+  0x40,0x00,0x00,0x00,0xce,0xe9,0xff,0xff,0x00,0x00,0x00,0x01,
+  0x18,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x3c,0x00,0x00,0x00,
+  0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0x64,0x00,0x00,0x00,
+  0x02,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x20,0x00,0x00,0x00,
+  0xb4,0xe9,0xff,0xff,0x08,0x00,0x00,0x00,0x10,0x00,0x00,0x00,
+  0x01,0x00,0x00,0x00,0x80,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0x01,0x00,0x00,0x00,0x35,0xf1,0xdb,0x41,0x2c,0x00,0x00,0x00,
+  0x73,0x65,0x71,0x75,0x65,0x6e,0x74,0x69,0x61,0x6c,0x5f,0x31,
+  0x2f,0x67,0x6c,0x6f,0x62,0x61,0x6c,0x5f,0x61,0x76,0x65,0x72,
+  0x61,0x67,0x65,0x5f,0x70,0x6f,0x6f,0x6c,0x69,0x6e,0x67,0x31,
+  0x64,0x5f,0x31,0x2f,0x4d,0x65,0x61,0x6e,0x00,0x00,0x00,0x00,
+  0x02,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x20,0x00,0x00,0x00,
+  0x5a,0xea,0xff,0xff,0x00,0x00,0x00,0x01,0x18,0x00,0x00,0x00,
+  0x24,0x00,0x00,0x00,0x44,0x00,0x00,0x00,0x17,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x09,0xa8,0x00,0x00,0x00,0x03,0x00,0x00,0x00,
+  0xff,0xff,0xff,0xff,0x0c,0x00,0x00,0x00,0x20,0x00,0x00,0x00,
+  0x44,0xea,0xff,0xff,0x08,0x00,0x00,0x00,0x14,0x00,0x00,0x00,
+  0x01,0x00,0x00,0x00,0x80,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x7b,0xfd,0xf8,0x42,
+  0x69,0x00,0x00,0x00,0x73,0x65,0x71,0x75,0x65,0x6e,0x74,0x69,
+  0x61,0x6c,0x5f,0x31,0x2f,0x63,0x6f,0x6e,0x76,0x31,0x64,0x5f,
+  0x31,0x5f,0x32,0x2f,0x52,0x65,0x6c,0x75,0x3b,0x73,0x65,0x71,
+  0x75,0x65,0x6e,0x74,0x69,0x61,0x6c,0x5f,0x31,0x2f,0x63,0x6f,
+  0x6e,0x76,0x31,0x64,0x5f,0x31,0x5f,0x32,0x2f,0x42,0x69,0x61,
+  0x73,0x41,0x64,0x64,0x3b,0x73,0x65,0x71,0x75,0x65,0x6e,0x74,
+  0x69,0x61,0x6c,0x5f,0x31,0x2f,0x63,0x6f,0x6e,0x76,0x31,0x64,
+  0x5f,0x31,0x5f,0x32,0x2f,0x63,0x6f,0x6e,0x76,0x6f,0x6c,0x75,
+  0x74,0x69,0x6f,0x6e,0x2f,0x53,0x71,0x75,0x65,0x65,0x7a,0x65,
+  0x3b,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+  0x0c,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x2e,0xeb,0xff,0xff,
+  0x00,0x00,0x00,0x01,0x18,0x00,0x00,0x00,0x28,0x00,0x00,0x00,
+  0x48,0x00,0x00,0x00,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x09,
+  0xd0,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0xff,0xff,0xff,0xff,
+  0x01,0x00,0x00,0x00,0x0c,0x00,0x00,0x00,0x20,0x00,0x00,0x00,
+  0x1c,0xeb,0xff,0xff,0x08,0x00,0x00,0x00,0x14,0x00,0x00,0x00,
+  0x01,0x00,0x00,0x00,0x80,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x7b,0xfd,0xf8,0x42,
+  0x8d,0x00,0x00,0x00,0x73,0x65,0x71,0x75,0x65,0x6e,0x74,0x69,
+  0x61,0x6c,0x5f,0x31,0x2f,0x63,0x6f,0x6e,0x76,0x31,0x64,0x5f,
+  0x31,0x5f,0x32,0x2f,0x52,0x65,0x6c,0x75,0x3b,0x73,0x65,0x71,
+  0x75,0x65,0x6e,0x74,0x69,0x61,0x6c,0x5f,0x31,0x2f,0x63,0x6f,
+  0x6e,0x76,0x31,0x64,0x5f,0x31,0x5f,0x32,0x2f,0x42,0x69,0x61,
+  0x73,0x41,0x64,0x64,0x3b,0x73,0x65,0x71,0x75,0x65,0x6e,0x74,
+  0x69,0x61,0x6c,0x5f,0x31,0x2f,0x63,0x6f,0x6e,0x76,0x31,0x64,
+  0x5f,0x31,0x5f,0x32,0x2f,0x63,0x6f,0x6e,0x76,0x6f,0x6c,0x75,
+  0x74,0x69,0x6f,0x6e,0x2f,0x53,0x71,0x75,0x65,0x65,0x7a,0x65,
+  0x3b,0x3b,0x73,0x65,0x71,0x75,0x65,0x6e,0x74,0x69,0x61,0x6c,
+  0x5f,0x31,0x2f,0x63,0x6f,0x6e,0x76,0x31,0x64,0x5f,0x31,0x5f,
+  0x32,0x2f,0x63,0x6f,0x6e,0x76,0x6f,0x6c,0x75,0x74,0x69,0x6f,
+  0x6e,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+  0x01,0x00,0x00,0x00,0x0c,0x00,0x00,0x00,0x20,0x00,0x00,0x00,
+  0x2e,0xec,0xff,0xff,0x00,0x00,0x00,0x01,0x18,0x00,0x00,0x00,
+  0x28,0x00,0x00,0x00,0x44,0x00,0x00,0x00,0x15,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x09,0x6c,0x00,0x00,0x00,0x04,0x00,0x00,0x00,
+  0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,
+  0x10,0x00,0x00,0x00,0x1c,0xec,0xff,0xff,0x08,0x00,0x00,0x00,
+  0x10,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x80,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x07,0x2f,0x41,0x43,
+  0x2e,0x00,0x00,0x00,0x73,0x65,0x71,0x75,0x65,0x6e,0x74,0x69,
+  0x61,0x6c,0x5f,0x31,0x2f,0x63,0x6f,0x6e,0x76,0x31,0x64,0x5f,
+  0x31,0x5f,0x32,0x2f,0x63,0x6f,0x6e,0x76,0x6f,0x6c,0x75,0x74,
+  0x69,0x6f,0x6e,0x2f,0x45,0x78,0x70,0x61,0x6e,0x64,0x44,0x69,
+  0x6d,0x73,0x00,0x00,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+  0x01,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x10,0x00,0x00,0x00,
+  0xca,0xec,0xff,0xff,0x00,0x00,0x00,0x01,0x18,0x00,0x00,0x00,
+  0x24,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x14,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x09,0x68,0x00,0x00,0x00,0x03,0x00,0x00,0x00,
+  0xff,0xff,0xff,0xff,0x0e,0x00,0x00,0x00,0x10,0x00,0x00,0x00,
+  0xb4,0xec,0xff,0xff,0x08,0x00,0x00,0x00,0x10,0x00,0x00,0x00,
+  0x01,0x00,0x00,0x00,0x80,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0x01,0x00,0x00,0x00,0x07,0x2f,0x41,0x43,0x2e,0x00,0x00,0x00,
+  0x73,0x65,0x71,0x75,0x65,0x6e,0x74,0x69,0x61,0x6c,0x5f,0x31,
+  0x2f,0x6d,0x61,0x78,0x5f,0x70,0x6f,0x6f,0x6c,0x69,0x6e,0x67,
+  0x31,0x64,0x5f,0x31,0x2f,0x4d,0x61,0x78,0x50,0x6f,0x6f,0x6c,
+  0x31,0x64,0x2f,0x53,0x71,0x75,0x65,0x65,0x7a,0x65,0x00,0x00,
+  0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,
+  0x10,0x00,0x00,0x00,0x5e,0xed,0xff,0xff,0x00,0x00,0x00,0x01,
+  0x18,0x00,0x00,0x00,0x28,0x00,0x00,0x00,0x48,0x00,0x00,0x00,
+  0x13,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0x68,0x00,0x00,0x00,
+  0x04,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,
+  0x0e,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x4c,0xed,0xff,0xff,
+  0x08,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+  0x80,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,
+  0x01,0x00,0x00,0x00,0x07,0x2f,0x41,0x43,0x26,0x00,0x00,0x00,
+  0x73,0x65,0x71,0x75,0x65,0x6e,0x74,0x69,0x61,0x6c,0x5f,0x31,
+  0x2f,0x6d,0x61,0x78,0x5f,0x70,0x6f,0x6f,0x6c,0x69,0x6e,0x67,
+  0x31,0x64,0x5f,0x31,0x2f,0x4d,0x61,0x78,0x50,0x6f,0x6f,0x6c,
+  0x31,0x64,0x00,0x00,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+  0x01,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x10,0x00,0x00,0x00,
+  0xf6,0xed,0xff,0xff,0x00,0x00,0x00,0x01,0x18,0x00,0x00,0x00,
+  0x28,0x00,0x00,0x00,0x48,0x00,0x00,0x00,0x12,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x09,0x74,0x00,0x00,0x00,0x04,0x00,0x00,0x00,
+  0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x1c,0x00,0x00,0x00,
+  0x10,0x00,0x00,0x00,0xe4,0xed,0xff,0xff,0x08,0x00,0x00,0x00,
+  0x14,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x80,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+  0x07,0x2f,0x41,0x43,0x31,0x00,0x00,0x00,0x73,0x65,0x71,0x75,
+  0x65,0x6e,0x74,0x69,0x61,0x6c,0x5f,0x31,0x2f,0x6d,0x61,0x78,
+  0x5f,0x70,0x6f,0x6f,0x6c,0x69,0x6e,0x67,0x31,0x64,0x5f,0x31,
+  0x2f,0x4d,0x61,0x78,0x50,0x6f,0x6f,0x6c,0x31,0x64,0x2f,0x45,
+  0x78,0x70,0x61,0x6e,0x64,0x44,0x69,0x6d,0x73,0x00,0x00,0x00,
+  0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+  0x1c,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x9a,0xee,0xff,0xff,
+  0x00,0x00,0x00,0x01,0x18,0x00,0x00,0x00,0x24,0x00,0x00,0x00,
+  0x44,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0x09,
+  0xa0,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0xff,0xff,0xff,0xff,
+  0x1c,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x84,0xee,0xff,0xff,
+  0x08,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+  0x80,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,
+  0x01,0x00,0x00,0x00,0x07,0x2f,0x41,0x43,0x63,0x00,0x00,0x00,
+  0x73,0x65,0x71,0x75,0x65,0x6e,0x74,0x69,0x61,0x6c,0x5f,0x31,
+  0x2f,0x63,0x6f,0x6e,0x76,0x31,0x64,0x5f,0x31,0x2f,0x52,0x65,
+  0x6c,0x75,0x3b,0x73,0x65,0x71,0x75,0x65,0x6e,0x74,0x69,0x61,
+  0x6c,0x5f,0x31,0x2f,0x63,0x6f,0x6e,0x76,0x31,0x64,0x5f,0x31,
+  0x2f,0x42,0x69,0x61,0x73,0x41,0x64,0x64,0x3b,0x73,0x65,0x71,
+  0x75,0x65,0x6e,0x74,0x69,0x61,0x6c,0x5f,0x31,0x2f,0x63,0x6f,
+  0x6e,0x76,0x31,0x64,0x5f,0x31,0x2f,0x63,0x6f,0x6e,0x76,0x6f,
+  0x6c,0x75,0x74,0x69,0x6f,0x6e,0x2f,0x53,0x71,0x75,0x65,0x65,
+  0x7a,0x65,0x3b,0x00,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+  0x1c,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x66,0xef,0xff,0xff,
+  0x00,0x00,0x00,0x01,0x18,0x00,0x00,0x00,0x28,0x00,0x00,0x00,
+  0x48,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x09,
+  0xc8,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0xff,0xff,0xff,0xff,
+  0x01,0x00,0x00,0x00,0x1c,0x00,0x00,0x00,0x10,0x00,0x00,0x00,
+  0x54,0xef,0xff,0xff,0x08,0x00,0x00,0x00,0x14,0x00,0x00,0x00,
+  0x01,0x00,0x00,0x00,0x80,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x07,0x2f,0x41,0x43,
+  0x85,0x00,0x00,0x00,0x73,0x65,0x71,0x75,0x65,0x6e,0x74,0x69,
+  0x61,0x6c,0x5f,0x31,0x2f,0x63,0x6f,0x6e,0x76,0x31,0x64,0x5f,
+  0x31,0x2f,0x52,0x65,0x6c,0x75,0x3b,0x73,0x65,0x71,0x75,0x65,
+  0x6e,0x74,0x69,0x61,0x6c,0x5f,0x31,0x2f,0x63,0x6f,0x6e,0x76,
+  0x31,0x64,0x5f,0x31,0x2f,0x42,0x69,0x61,0x73,0x41,0x64,0x64,
+  0x3b,0x73,0x65,0x71,0x75,0x65,0x6e,0x74,0x69,0x61,0x6c,0x5f,
+  0x31,0x2f,0x63,0x6f,0x6e,0x76,0x31,0x64,0x5f,0x31,0x2f,0x63,
+  0x6f,0x6e,0x76,0x6f,0x6c,0x75,0x74,0x69,0x6f,0x6e,0x2f,0x53,
+  0x71,0x75,0x65,0x65,0x7a,0x65,0x3b,0x3b,0x73,0x65,0x71,0x75,
+  0x65,0x6e,0x74,0x69,0x61,0x6c,0x5f,0x31,0x2f,0x63,0x6f,0x6e,
+  0x76,0x31,0x64,0x5f,0x31,0x2f,0x63,0x6f,0x6e,0x76,0x6f,0x6c,
+  0x75,0x74,0x69,0x6f,0x6e,0x00,0x00,0x00,0x04,0x00,0x00,0x00,
+  0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x1c,0x00,0x00,0x00,
+  0x10,0x00,0x00,0x00,0x5e,0xf0,0xff,0xff,0x00,0x00,0x00,0x01,
+  0x18,0x00,0x00,0x00,0x28,0x00,0x00,0x00,0x48,0x00,0x00,0x00,
+  0x0f,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0x70,0x00,0x00,0x00,
+  0x04,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,
+  0x1e,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x4c,0xf0,0xff,0xff,
+  0x08,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+  0x80,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,
+  0x01,0x00,0x00,0x00,0x69,0x3e,0x0f,0x44,0x2c,0x00,0x00,0x00,
+  0x73,0x65,0x71,0x75,0x65,0x6e,0x74,0x69,0x61,0x6c,0x5f,0x31,
+  0x2f,0x63,0x6f,0x6e,0x76,0x31,0x64,0x5f,0x31,0x2f,0x63,0x6f,
+  0x6e,0x76,0x6f,0x6c,0x75,0x74,0x69,0x6f,0x6e,0x2f,0x45,0x78,
+  0x70,0x61,0x6e,0x64,0x44,0x69,0x6d,0x73,0x00,0x00,0x00,0x00,
+  0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+  0x1e,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x52,0xf1,0xff,0xff,
+  0x00,0x00,0x00,0x01,0x14,0x00,0x00,0x00,0xe8,0x00,0x00,0x00,
+  0x0e,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0xf4,0x00,0x00,0x00,
+  0xd4,0xf0,0xff,0xff,0x08,0x00,0x00,0x00,0x8c,0x00,0x00,0x00,
+  0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0xb7,0xfd,0xf2,0x3a,
+  0xb0,0x6a,0x11,0x3b,0xfc,0x92,0x04,0x3b,0x54,0xdf,0x1c,0x3b,
+  0xfd,0x0d,0x01,0x3b,0xf6,0x76,0x1f,0x3b,0x14,0xdf,0xd8,0x3a,
+  0x20,0xf4,0x17,0x3b,0xa7,0x9e,0x16,0x3b,0x11,0x4f,0x08,0x3b,
+  0x84,0x91,0x19,0x3b,0x27,0x84,0x24,0x3b,0xdf,0xba,0x21,0x3b,
+  0x64,0xa5,0x11,0x3b,0xea,0x5e,0x1f,0x3b,0x0f,0xd7,0x0d,0x3b,
+  0x12,0x00,0x00,0x00,0x74,0x66,0x6c,0x2e,0x70,0x73,0x65,0x75,
+  0x64,0x6f,0x5f,0x71,0x63,0x6f,0x6e,0x73,0x74,0x37,0x00,0x00,
+  0x04,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+  0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x72,0xf2,0xff,0xff,
+  0x00,0x00,0x00,0x01,0x14,0x00,0x00,0x00,0xe4,0x00,0x00,0x00,
+  0x0d,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xf0,0x00,0x00,0x00,
+  0xf4,0xf1,0xff,0xff,0x08,0x00,0x00,0x00,0x88,0x00,0x00,0x00,
+  0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x10,0x00,0x00,0x00,0xf6,0xf6,0x87,0x3f,0x18,0xbc,0xa2,0x3f,
+  0xd9,0x5c,0x94,0x3f,0xfd,0x8d,0xaf,0x3f,0x8d,0x6c,0x90,0x3f,
+  0xa7,0x74,0xb2,0x3f,0xf6,0xb2,0x72,0x3f,0xd3,0x0c,0xaa,0x3f,
+  0xaf,0x8e,0xa8,0x3f,0xcb,0x8a,0x98,0x3f,0x72,0xdb,0xab,0x3f,
+  0xdb,0x1b,0xb8,0x3f,0xa0,0xfd,0xb4,0x3f,0xc9,0xfd,0xa2,0x3f,
+  0xbe,0x59,0xb2,0x3f,0x6b,0xbb,0x9e,0x3f,0x12,0x00,0x00,0x00,
+  0x74,0x66,0x6c,0x2e,0x70,0x73,0x65,0x75,0x64,0x6f,0x5f,0x71,
+  0x63,0x6f,0x6e,0x73,0x74,0x36,0x00,0x00,0x01,0x00,0x00,0x00,
+  0x10,0x00,0x00,0x00,0x82,0xf3,0xff,0xff,0x00,0x00,0x00,0x01,
+  0x14,0x00,0x00,0x00,0xa8,0x01,0x00,0x00,0x0c,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x09,0xb4,0x01,0x00,0x00,0x04,0xf3,0xff,0xff,
+  0x08,0x00,0x00,0x00,0x0c,0x01,0x00,0x00,0x20,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,
+  0x6e,0xbd,0xd1,0x3a,0xc4,0x68,0xd9,0x3a,0x07,0xf1,0xd4,0x3a,
+  0xbc,0x8e,0xd9,0x3a,0x9b,0xad,0xe2,0x3a,0x14,0x0d,0xcf,0x3a,
+  0x38,0x7d,0xd7,0x3a,0x93,0x55,0xd6,0x3a,0xdc,0x10,0xe0,0x3a,
+  0x74,0x8a,0xd3,0x3a,0xa1,0xe8,0xc9,0x3a,0xd7,0x14,0xe7,0x3a,
+  0x79,0x14,0xd2,0x3a,0x27,0x28,0xdf,0x3a,0x13,0x6b,0xd5,0x3a,
+  0x3e,0xfa,0xc1,0x3a,0x38,0x7a,0xdd,0x3a,0x22,0xc4,0xde,0x3a,
+  0xfa,0x22,0xce,0x3a,0x25,0x73,0xce,0x3a,0x1d,0x13,0xf9,0x3a,
+  0xb2,0x81,0xde,0x3a,0xb4,0x6c,0xd2,0x3a,0x45,0x2a,0xc6,0x3a,
+  0xff,0x35,0xc8,0x3a,0xf2,0xaa,0xbb,0x3a,0x41,0xee,0xe1,0x3a,
+  0x28,0xb5,0xd7,0x3a,0xce,0x84,0xd4,0x3a,0x3a,0xa8,0xcd,0x3a,
+  0xe5,0x21,0xd4,0x3a,0x4b,0xac,0xcf,0x3a,0x12,0x00,0x00,0x00,
+  0x74,0x66,0x6c,0x2e,0x70,0x73,0x65,0x75,0x64,0x6f,0x5f,0x71,
+  0x63,0x6f,0x6e,0x73,0x74,0x35,0x00,0x00,0x04,0x00,0x00,0x00,
+  0x20,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x03,0x00,0x00,0x00,
+  0x10,0x00,0x00,0x00,0x62,0xf5,0xff,0xff,0x00,0x00,0x00,0x01,
+  0x14,0x00,0x00,0x00,0xa4,0x01,0x00,0x00,0x0b,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x02,0xb0,0x01,0x00,0x00,0xe4,0xf4,0xff,0xff,
+  0x08,0x00,0x00,0x00,0x08,0x01,0x00,0x00,0x20,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x57,0x46,0x9e,0x3e,
+  0xec,0x0f,0xa4,0x3e,0xd4,0xb0,0xa0,0x3e,0x93,0x2c,0xa4,0x3e,
+  0x86,0x0e,0xab,0x3e,0xe5,0x3e,0x9c,0x3e,0xfd,0x9c,0xa2,0x3e,
+  0xe3,0xbd,0xa1,0x3e,0xdf,0x15,0xa9,0x3e,0x3e,0xa2,0x9f,0x3e,
+  0x79,0x5d,0x98,0x3e,0x29,0x61,0xae,0x3e,0x07,0x88,0x9e,0x3e,
+  0x44,0x66,0xa8,0x3e,0xee,0x0c,0xa1,0x3e,0x4b,0x61,0x92,0x3e,
+  0xd4,0x21,0xa7,0x3e,0xca,0x1a,0xa8,0x3e,0x3d,0x8e,0x9b,0x3e,
+  0xbc,0xca,0x9b,0x3e,0x2a,0xf5,0xbb,0x3e,0xa7,0xe8,0xa7,0x3e,
+  0x9b,0xca,0x9e,0x3e,0x45,0x8a,0x95,0x3e,0x7d,0x15,0x97,0x3e,
+  0x5a,0x9e,0x8d,0x3e,0x20,0x7e,0xaa,0x3e,0x33,0xc7,0xa2,0x3e,
+  0x29,0x5f,0xa0,0x3e,0x9b,0x31,0x9b,0x3e,0x86,0x14,0xa0,0x3e,
+  0x0b,0xb7,0x9c,0x3e,0x12,0x00,0x00,0x00,0x74,0x66,0x6c,0x2e,
+  0x70,0x73,0x65,0x75,0x64,0x6f,0x5f,0x71,0x63,0x6f,0x6e,0x73,
+  0x74,0x34,0x00,0x00,0x01,0x00,0x00,0x00,0x20,0x00,0x00,0x00,
+  0x32,0xf7,0xff,0xff,0x00,0x00,0x00,0x01,0x14,0x00,0x00,0x00,
+  0x28,0x03,0x00,0x00,0x0a,0x00,0x00,0x00,0x00,0x00,0x00,0x09,
+  0x34,0x03,0x00,0x00,0xb4,0xf6,0xff,0xff,0x08,0x00,0x00,0x00,
+  0x0c,0x02,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,
+  0x8c,0x1c,0xf7,0x3a,0x22,0x1b,0x08,0x3b,0x00,0x2c,0xf0,0x3a,
+  0xd5,0xb1,0xfe,0x3a,0x20,0x2c,0xf0,0x3a,0xb2,0xfd,0x02,0x3b,
+  0x18,0x8a,0x07,0x3b,0xa3,0x71,0x00,0x3b,0x86,0xd5,0x14,0x3b,
+  0x7f,0x4b,0xfe,0x3a,0xd2,0x9f,0x08,0x3b,0x41,0x3e,0xf5,0x3a,
+  0x4b,0x7a,0x1b,0x3b,0x19,0x1b,0x04,0x3b,0x33,0xe6,0xe9,0x3a,
+  0x32,0x1b,0xf3,0x3a,0xdc,0x99,0xfe,0x3a,0x5b,0xe5,0xf4,0x3a,
+  0xe4,0x13,0x09,0x3b,0xb9,0xfa,0xf6,0x3a,0x5b,0x37,0x00,0x3b,
+  0x43,0xc3,0x07,0x3b,0x61,0x36,0xf8,0x3a,0x87,0x05,0xfc,0x3a,
+  0x3b,0xfa,0x06,0x3b,0xe2,0x49,0x02,0x3b,0x27,0x1b,0x09,0x3b,
+  0x8d,0xba,0xfb,0x3a,0xc2,0x4c,0xfa,0x3a,0xc6,0xb6,0xff,0x3a,
+  0x5b,0xbd,0xfb,0x3a,0x3c,0x6a,0xfd,0x3a,0x91,0xbc,0xec,0x3a,
+  0x4f,0x16,0x00,0x3b,0xee,0x23,0x00,0x3b,0x19,0xc1,0x0e,0x3b,
+  0x77,0x0f,0x00,0x3b,0x06,0x15,0xfd,0x3a,0xfe,0xb5,0x09,0x3b,
+  0x9a,0xd9,0x01,0x3b,0xc2,0xca,0x02,0x3b,0xe6,0xc0,0xf9,0x3a,
+  0xbf,0xa7,0x00,0x3b,0xd4,0x9c,0x00,0x3b,0x92,0xd3,0xf9,0x3a,
+  0x32,0x3c,0x00,0x3b,0x10,0xae,0xf2,0x3a,0xd8,0xaf,0xfb,0x3a,
+  0xf4,0x39,0x00,0x3b,0xb3,0xae,0xfe,0x3a,0x02,0x9b,0x00,0x3b,
+  0x0f,0xd0,0x07,0x3b,0x30,0xae,0x00,0x3b,0xb2,0x43,0x0b,0x3b,
+  0x12,0x2d,0xfb,0x3a,0x9c,0x68,0xf3,0x3a,0x0c,0x5e,0xfc,0x3a,
+  0x3e,0x71,0xf9,0x3a,0x00,0x42,0xf2,0x3a,0x37,0x1f,0x0b,0x3b,
+  0x1b,0xca,0xec,0x3a,0x45,0xca,0x00,0x3b,0x05,0x31,0xfc,0x3a,
+  0x8e,0x25,0xf8,0x3a,0x12,0x00,0x00,0x00,0x74,0x66,0x6c,0x2e,
+  0x70,0x73,0x65,0x75,0x64,0x6f,0x5f,0x71,0x63,0x6f,0x6e,0x73,
+  0x74,0x33,0x00,0x00,0x02,0x00,0x00,0x00,0x40,0x00,0x00,0x00,
+  0x20,0x00,0x00,0x00,0x8a,0xfa,0xff,0xff,0x00,0x00,0x00,0x01,
+  0x14,0x00,0x00,0x00,0x24,0x03,0x00,0x00,0x09,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x02,0x30,0x03,0x00,0x00,0x0c,0xfa,0xff,0xff,
+  0x08,0x00,0x00,0x00,0x08,0x02,0x00,0x00,0x40,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,
+  0x41,0x4e,0x54,0x3d,0xe8,0xde,0x69,0x3d,0xef,0x57,0x4e,0x3d,
+  0x1b,0xd2,0x5a,0x3d,0x0b,0x58,0x4e,0x3d,0xe6,0x14,0x61,0x3d,
+  0xaf,0xe5,0x68,0x3d,0x78,0xb4,0x5c,0x3d,0xcb,0xbd,0x7f,0x3d,
+  0x2f,0x7a,0x5a,0x3d,0xe7,0xc2,0x6a,0x3d,0x54,0xb3,0x52,0x3d,
+  0x1c,0x94,0x85,0x3d,0x4e,0xff,0x62,0x3d,0x50,0xf4,0x48,0x3d,
+  0x53,0xdd,0x50,0x3d,0x83,0xbd,0x5a,0x3d,0xf3,0x66,0x52,0x3d,
+  0x58,0x8a,0x6b,0x3d,0x31,0x31,0x54,0x3d,0x53,0x50,0x5c,0x3d,
+  0xea,0x47,0x69,0x3d,0x64,0x40,0x55,0x3d,0x30,0x86,0x58,0x3d,
+  0x7c,0xee,0x67,0x3d,0xee,0xdf,0x5f,0x3d,0xd3,0x96,0x6b,0x3d,
+  0xc5,0x45,0x58,0x3d,0x80,0x0b,0x57,0x3d,0x4b,0xb2,0x5b,0x3d,
+  0x2e,0x48,0x58,0x3d,0xa7,0xb8,0x59,0x3d,0x5f,0x64,0x4b,0x3d,
+  0x8a,0x17,0x5c,0x3d,0xf2,0x2e,0x5c,0x3d,0x63,0x4b,0x75,0x3d,
+  0xc8,0x0b,0x5c,0x3d,0x71,0x6f,0x59,0x3d,0xe2,0xa0,0x6c,0x3d,
+  0xff,0x1e,0x5f,0x3d,0x60,0xbd,0x60,0x3d,0x57,0x93,0x56,0x3d,
+  0x72,0x11,0x5d,0x3d,0xaf,0xfe,0x5c,0x3d,0x62,0xa3,0x56,0x3d,
+  0xa4,0x58,0x5c,0x3d,0x90,0x7f,0x50,0x3d,0x92,0x3c,0x58,0x3d,
+  0xca,0x54,0x5c,0x3d,0x6a,0xcf,0x5a,0x3d,0x8f,0xfb,0x5c,0x3d,
+  0xe8,0x5d,0x69,0x3d,0x83,0x1c,0x5d,0x3d,0x42,0x4c,0x6f,0x3d,
+  0x38,0xcc,0x57,0x3d,0xd5,0x1f,0x51,0x3d,0x3d,0xd2,0x58,0x3d,
+  0xe7,0x4e,0x56,0x3d,0xb8,0x22,0x50,0x3d,0x92,0x0d,0x6f,0x3d,
+  0x00,0x70,0x4b,0x3d,0xc4,0x4c,0x5d,0x3d,0x8e,0xab,0x58,0x3d,
+  0xef,0x31,0x55,0x3d,0x12,0x00,0x00,0x00,0x74,0x66,0x6c,0x2e,
+  0x70,0x73,0x65,0x75,0x64,0x6f,0x5f,0x71,0x63,0x6f,0x6e,0x73,
+  0x74,0x32,0x00,0x00,0x01,0x00,0x00,0x00,0x40,0x00,0x00,0x00,
+  0xda,0xfd,0xff,0xff,0x00,0x00,0x00,0x01,0x14,0x00,0x00,0x00,
+  0x70,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x09,
+  0x7c,0x00,0x00,0x00,0x5c,0xfd,0xff,0xff,0x08,0x00,0x00,0x00,
+  0x3c,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x06,0x00,0x00,0x00,0x9c,0x0c,0x14,0x3b,0xbe,0x0b,0x13,0x3b,
+  0x5a,0x92,0x14,0x3b,0xf4,0x24,0x13,0x3b,0xea,0x07,0x0c,0x3b,
+  0x52,0x49,0x14,0x3b,0x12,0x00,0x00,0x00,0x74,0x66,0x6c,0x2e,
+  0x70,0x73,0x65,0x75,0x64,0x6f,0x5f,0x71,0x63,0x6f,0x6e,0x73,
+  0x74,0x31,0x00,0x00,0x02,0x00,0x00,0x00,0x06,0x00,0x00,0x00,
+  0x40,0x00,0x00,0x00,0x7a,0xfe,0xff,0xff,0x00,0x00,0x00,0x01,
+  0x14,0x00,0x00,0x00,0x6c,0x00,0x00,0x00,0x07,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x02,0x78,0x00,0x00,0x00,0xfc,0xfd,0xff,0xff,
+  0x08,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x06,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x06,0x00,0x00,0x00,0x6f,0x0d,0xb8,0x38,0x1a,0xce,0xb6,0x38,
+  0xb3,0xb3,0xb8,0x38,0x71,0xed,0xb6,0x38,0x8e,0x15,0xae,0x38,
+  0xe9,0x58,0xb8,0x38,0x11,0x00,0x00,0x00,0x74,0x66,0x6c,0x2e,
+  0x70,0x73,0x65,0x75,0x64,0x6f,0x5f,0x71,0x63,0x6f,0x6e,0x73,
+  0x74,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x06,0x00,0x00,0x00,
+  0x12,0xff,0xff,0xff,0x00,0x00,0x00,0x01,0x14,0x00,0x00,0x00,
+  0x14,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x02,
+  0x1c,0x00,0x00,0x00,0xfc,0xfe,0xff,0xff,0x0f,0x00,0x00,0x00,
+  0x61,0x72,0x69,0x74,0x68,0x2e,0x63,0x6f,0x6e,0x73,0x74,0x61,
+  0x6e,0x74,0x34,0x00,0x01,0x00,0x00,0x00,0x03,0x00,0x00,0x00,
+  0x4e,0xff,0xff,0xff,0x00,0x00,0x00,0x01,0x14,0x00,0x00,0x00,
+  0x14,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x02,
+  0x1c,0x00,0x00,0x00,0x38,0xff,0xff,0xff,0x0f,0x00,0x00,0x00,
+  0x61,0x72,0x69,0x74,0x68,0x2e,0x63,0x6f,0x6e,0x73,0x74,0x61,
+  0x6e,0x74,0x33,0x00,0x01,0x00,0x00,0x00,0x03,0x00,0x00,0x00,
+  0x8a,0xff,0xff,0xff,0x00,0x00,0x00,0x01,0x14,0x00,0x00,0x00,
+  0x14,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x02,
+  0x1c,0x00,0x00,0x00,0x74,0xff,0xff,0xff,0x0f,0x00,0x00,0x00,
+  0x61,0x72,0x69,0x74,0x68,0x2e,0x63,0x6f,0x6e,0x73,0x74,0x61,
+  0x6e,0x74,0x32,0x00,0x00,0x00,0x00,0x00,0xc2,0xff,0xff,0xff,
+  0x00,0x00,0x00,0x01,0x14,0x00,0x00,0x00,0x14,0x00,0x00,0x00,
+  0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x1c,0x00,0x00,0x00,
+  0xac,0xff,0xff,0xff,0x0f,0x00,0x00,0x00,0x61,0x72,0x69,0x74,
+  0x68,0x2e,0x63,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x31,0x00,
+  0x01,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x16,0x00,
+  0x1c,0x00,0x18,0x00,0x17,0x00,0x10,0x00,0x0c,0x00,0x08,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x16,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x01,0x18,0x00,0x00,0x00,0x18,0x00,0x00,0x00,
+  0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x20,0x00,0x00,0x00,
+  0x04,0x00,0x04,0x00,0x04,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,
+  0x61,0x72,0x69,0x74,0x68,0x2e,0x63,0x6f,0x6e,0x73,0x74,0x61,
+  0x6e,0x74,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x16,0x00,
+  0x20,0x00,0x1c,0x00,0x1b,0x00,0x14,0x00,0x10,0x00,0x0c,0x00,
+  0x00,0x00,0x00,0x00,0x08,0x00,0x07,0x00,0x16,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x01,0x18,0x00,0x00,0x00,0x30,0x00,0x00,0x00,
+  0x50,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x09,
+  0x68,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0xff,0xff,0xff,0xff,
+  0x1e,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x0c,0x00,0x0c,0x00,
+  0x00,0x00,0x00,0x00,0x08,0x00,0x04,0x00,0x0c,0x00,0x00,0x00,
+  0x08,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+  0x80,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,
+  0x01,0x00,0x00,0x00,0x69,0x3e,0x0f,0x44,0x1d,0x00,0x00,0x00,
+  0x73,0x65,0x72,0x76,0x69,0x6e,0x67,0x5f,0x64,0x65,0x66,0x61,
+  0x75,0x6c,0x74,0x5f,0x69,0x6e,0x70,0x75,0x74,0x5f,0x6c,0x61,
+  0x79,0x65,0x72,0x3a,0x30,0x00,0x00,0x00,0x03,0x00,0x00,0x00,
+  0x01,0x00,0x00,0x00,0x1e,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+  0x07,0x00,0x00,0x00,0x90,0x00,0x00,0x00,0x70,0x00,0x00,0x00,
+  0x54,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x2c,0x00,0x00,0x00,
+  0x18,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0xb4,0xff,0xff,0xff,
+  0x19,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x19,
+  0xc4,0xff,0xff,0xff,0x09,0x00,0x00,0x00,0x04,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x09,0xd4,0xff,0xff,0xff,0x28,0x00,0x00,0x00,
+  0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0xe4,0xff,0xff,0xff,
+  0x11,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x11,
+  0xd8,0xff,0xff,0xff,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x16,
+  0x0c,0x00,0x10,0x00,0x0f,0x00,0x00,0x00,0x08,0x00,0x04,0x00,
+  0x0c,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x03,0x0c,0x00,0x0c,0x00,0x0b,0x00,0x00,0x00,
+  0x00,0x00,0x04,0x00,0x0c,0x00,0x00,0x00,0x46,0x00,0x00,0x00,
   0x00,0x00,0x00,0x46
 };
 
 const int model_data_len = 12736;
 
+// Windows per invoke: the input tensor is model_batch x 30 int8
+const int model_batch = 1;
+
+// The training StandardScaler folded into the input quantization: feature k
+// goes into the int8 input tensor as round(x * model_input_gain[k] +
+// model_input_bias[k]), clamped to [-128, 127]
+const float model_input_gain[] = {
+  0.00174527639f, 0.00174527639f, 0.00174527639f, 0.00174527639f, 0.00174527639f,
+  0.00174527639f, 0.00174527639f, 0.00174527639f, 0.00174527639f, 0.00174527639f,
+  0.00174527639f, 0.00174527639f, 0.00174527639f, 0.00174527639f, 0.00174527639f,
+  0.00174527639f, 0.00174527639f, 0.00174527639f, 0.00174527639f, 0.00174527639f,
+  0.00174527639f, 0.00174527639f, 0.00174527639f, 0.00174527639f, 0.00174527639f,
+  0.00174527639f, 0.00174527639f, 0.00174527639f, 0.00174527639f, 0.00174527639f
+};
+
+const float model_input_bias[] = {
+  -128.0f, -128.0f, -128.0f, -128.0f, -128.0f,
+  -128.0f, -128.0f, -128.0f, -128.0f, -128.0f,
+  -128.0f, -128.0f, -128.0f, -128.0f, -128.0f,
+  -128.0f, -128.0f, -128.0f, -128.0f, -128.0f,
+  -128.0f, -128.0f, -128.0f, -128.0f, -128.0f,
+  -128.0f, -128.0f, -128.0f, -128.0f, -128.0f
+};
+
 // Activity labels
 const char* activity_names[] = {
   "IDLE", "SOCIAL", "VIDEO", "MESSAGE", "BROWSE", "GAMING"
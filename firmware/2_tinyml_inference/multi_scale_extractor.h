@@ -0,0 +1,276 @@
+// Multi-resolution streaming features: nested windows of Short, Base and
+// Long samples, all ending at the newest sample, over one sample ring.
+// Features come out as one concatenated vector:
+//   [0, 30)   the 30 features of the Base window, as FeatureExtractor<Base>
+//   [30, 44)  the 14 time-domain features of the Short window
+//   [44, 58)  the 14 time-domain features of the Long window
+// so a model trained on the Base window alone reads the same indices.
+//
+// The per-sample update is shared across scales. One ring holds the Long
+// window, and each scale's running sums drop the sample leaving that scale
+// straight from it. One min, max and |diff| deque over the Long window
+// answers every scale with top_within(). One sorted view of the Long window,
+// keyed by value and sample index, gives each scale its median and quartiles
+// in a walk that skips samples older than the scale. Spectrum and wavelet
+// stay at the Base scale: the bins of one window length do not give another.
+
+#ifndef MULTI_SCALE_EXTRACTOR_H
+#define MULTI_SCALE_EXTRACTOR_H
+
+#include <stdint.h>
+#include <math.h>
+#include "feature_extractor.h"
+
+#define NUM_TIME_FEATURES SPECTRAL_FIRST
+#define MULTISCALE_NUM_FEATURES (NUM_FEATURES + 2 * NUM_TIME_FEATURES)
+
+enum { SCALE_BASE, SCALE_SHORT, SCALE_LONG, NUM_SCALES };
+
+template <int Short, int Base, int Long, int Hop>
+class MultiScaleExtractor {
+  static_assert(2 <= Short && Short < Base && Base < Long, "scales must nest, shortest first");
+  static_assert(Hop <= Short, "Hop must not exceed the shortest window");
+  static_assert(MULTISCALE_NUM_FEATURES <= 64, "computed_mask holds one bit per feature");
+
+public:
+  static constexpr int width(int scale) {
+    return scale == SCALE_SHORT ? Short : scale == SCALE_LONG ? Long : Base;
+  }
+
+  // Index of feature k (k < 14 for Short and Long) of a scale in the vector
+  static constexpr int feature_index(int scale, int k) {
+    return scale == SCALE_BASE ? k : NUM_FEATURES + (scale - 1) * NUM_TIME_FEATURES + k;
+  }
+
+  void add_sample(float voltage) {
+    int32_t x = to_fixed(voltage);
+    uint32_t t = sample_count;
+
+    // Each scale's oldest sample and first difference leave it
+    for (int s = 0; s < NUM_SCALES; s++) {
+      int w = width(s);
+      if (filled < w) continue;
+      int32_t oldest = ring[(ring_head + Long - w) % Long];
+      int32_t d_old = ring[(ring_head + Long - w + 1) % Long] - oldest;
+      scales[s].moments.remove(oldest);
+      scales[s].diff_moments.remove(d_old);
+      scales[s].abs_diff_sum -= abs_fixed(d_old);
+    }
+    int32_t base_oldest = filled >= Base ? ring[(ring_head + Long - Base) % Long] : 0;
+    if (filled == Long) sorted.erase(key(ring[ring_head], t - Long));
+
+    if (filled > 0) {
+      int32_t d = x - last_sample;
+      for (int s = 0; s < NUM_SCALES; s++) {
+        scales[s].diff_moments.add(d);
+        scales[s].abs_diff_sum += abs_fixed(d);
+      }
+      abs_diff_deque.push(t, abs_fixed(d));
+    }
+    for (int s = 0; s < NUM_SCALES; s++) scales[s].moments.add(x);
+    sorted.insert(key(x, t));
+    min_deque.push(t, x);
+    max_deque.push(t, x);
+    spectrum_source.update(x, base_oldest);
+
+    ring[ring_head] = x;
+    ring_head = (ring_head + 1) % Long;
+    if (filled < Long) filled++;
+
+    last_sample = x;
+    sample_count++;
+    if (--hop_countdown == 0) hop_countdown = Hop;
+
+    computed_mask = 0;
+    window_copied = false;
+  }
+
+  // Every scale is full from the first Long window on
+  bool is_window_ready() const {
+    return filled == Long && hop_countdown == Hop;
+  }
+
+  float operator[](int k) {
+    if (!(computed_mask & (1ULL << k))) compute(k);
+    return values[k];
+  }
+
+  int features_computed() const {
+    return __builtin_popcountll(computed_mask);
+  }
+
+  void extract_features(float* features) {
+    for (int k = 0; k < MULTISCALE_NUM_FEATURES; k++) {
+      features[k] = (*this)[k];
+    }
+  }
+
+private:
+  struct ScaleSums {
+    SlidingMoments moments;
+    SlidingMoments diff_moments;  // Signed first differences
+    int64_t abs_diff_sum = 0;
+  };
+
+  // Value-major, so the sorted view orders by value; the sample index makes
+  // every key unique, so erase() finds the sample that left
+  static int64_t key(int32_t x, uint32_t idx) {
+    return (int64_t)x * 4294967296LL + idx;
+  }
+  static int32_t key_value(int64_t k) { return (int32_t)(k >> 32); }
+  static uint32_t key_index(int64_t k) { return (uint32_t)k; }
+
+  void set(int k, float value) {
+    values[k] = value;
+    computed_mask |= 1ULL << k;
+  }
+
+  void compute(int k) {
+    if (k < SPECTRAL_FIRST) {
+      compute_time(SCALE_BASE, k);
+    } else if (k < WAVELET_FIRST) {
+      spectrum_source.magnitudes(spectrum);
+      extract_spectral_features(spectrum, Base/2, &values[SPECTRAL_FIRST]);
+      computed_mask |= feature_bits(SPECTRAL_FIRST, NUM_SPECTRAL_FEATURES);
+    } else if (k < NUM_FEATURES) {
+      wavelet.extract(base_window(), &values[WAVELET_FIRST]);
+      computed_mask |= feature_bits(WAVELET_FIRST, NUM_WAVELET_FEATURES);
+    } else {
+      int s = 1 + (k - NUM_FEATURES) / NUM_TIME_FEATURES;
+      compute_time(s, (k - NUM_FEATURES) % NUM_TIME_FEATURES);
+    }
+  }
+
+  // Feature j of FeatureExtractor's time-domain block, at one scale
+  void compute_time(int s, int j) {
+    int w = width(s);
+    const ScaleSums& sums = scales[s];
+    int k = feature_index(s, j);
+    switch (j) {
+      case 0: set(k, sums.moments.mean()); break;
+      case 1: set(k, sqrt(sums.moments.variance())); break;
+      case 2: set(k, sums.moments.variance()); break;
+      case 3: set(k, from_fixed(min_deque.top_within(w))); break;
+      case 4: set(k, from_fixed(max_deque.top_within(w))); break;
+      case 5:
+        set(k, from_fixed(max_deque.top_within(w)) - from_fixed(min_deque.top_within(w)));
+        break;
+      case 6:
+      case 9:
+      case 10: quartiles(s); break;
+      case 7:
+      case 8: shape_features(s); break;
+      case 11: set(k, sums.abs_diff_sum / ((float)(w - 1) * FIXED_ONE)); break;
+      case 12: set(k, sqrt(sums.diff_moments.variance())); break;
+      case 13: set(k, from_fixed(abs_diff_deque.top_within(w - 1))); break;
+    }
+  }
+
+  // Median, q25 and q75 of one scale, interpolated as np.percentile. The
+  // Long scale indexes the sorted view; the others walk it in value order,
+  // counting only samples young enough, up to the highest rank they need.
+  void quartiles(int s) {
+    static const float P[3] = {0.5f, 0.25f, 0.75f};
+    static const int FEATURE[3] = {6, 9, 10};
+    int w = width(s);
+    int lo[3];
+    float frac[3];
+    int32_t lo_val[3], hi_val[3];
+    for (int q = 0; q < 3; q++) {
+      float pos = P[q] * (w - 1);
+      lo[q] = (int)pos;
+      frac[q] = pos - lo[q];
+    }
+
+    if (s == SCALE_LONG) {
+      for (int q = 0; q < 3; q++) {
+        lo_val[q] = key_value(sorted.at(lo[q]));
+        hi_val[q] = key_value(sorted.at(lo[q] + 1 < w ? lo[q] + 1 : lo[q]));
+      }
+    } else {
+      int last = lo[2] + 1 < w ? lo[2] + 1 : lo[2];
+      uint32_t newest = sample_count - 1;
+      int rank = 0;
+      for (int i = 0; rank <= last; i++) {
+        int64_t entry = sorted.at(i);
+        if (newest - key_index(entry) >= (uint32_t)w) continue;
+        int32_t v = key_value(entry);
+        for (int q = 0; q < 3; q++) {
+          if (rank == lo[q]) lo_val[q] = v;
+          if (rank == lo[q] + 1) hi_val[q] = v;
+        }
+        rank++;
+      }
+      for (int q = 0; q < 3; q++) {
+        if (lo[q] + 1 >= w) hi_val[q] = lo_val[q];
+      }
+    }
+
+    for (int q = 0; q < 3; q++) {
+      float v = lo_val[q] + ((float)hi_val[q] - (float)lo_val[q]) * frac[q];
+      set(feature_index(s, FEATURE[q]), v / FIXED_ONE);
+    }
+  }
+
+  // Skewness and excess kurtosis in one pass over the scale's samples,
+  // oldest first, read from the ring
+  void shape_features(int s) {
+    int w = width(s);
+    int k = feature_index(s, 7);
+    float mean = scales[s].moments.mean();
+    float std = sqrt(scales[s].moments.variance());
+    if (std == 0) {
+      set(k, 0);
+      set(k + 1, 0);
+      return;
+    }
+
+    float sum_cubed = 0;
+    float sum_fourth = 0;
+    int first = ring_head + Long - w;
+    for (int i = 0; i < w; i++) {
+      float z = (from_fixed(ring[(first + i) % Long]) - mean) / std;
+      float z3 = z * z * z;
+      sum_cubed += z3;
+      sum_fourth += z3 * z;
+    }
+    set(k, sum_cubed / w);
+    set(k + 1, (sum_fourth / w) - 3.0);  // Excess kurtosis
+  }
+
+  const float* base_window() {
+    if (!window_copied) {
+      int first = ring_head + Long - Base;
+      for (int i = 0; i < Base; i++) {
+        window[i] = from_fixed(ring[(first + i) % Long]);
+      }
+      window_copied = true;
+    }
+    return window;
+  }
+
+  int32_t ring[Long];           // Fixed-point samples, oldest at ring_head once full
+  int ring_head = 0;
+  int filled = 0;
+  uint32_t sample_count = 0;
+  int32_t last_sample = 0;
+  bool window_copied = false;
+  int hop_countdown = Long;
+
+  ScaleSums scales[NUM_SCALES];
+  MonotonicDeque<Long, false> min_deque;
+  MonotonicDeque<Long, true> max_deque;
+  MonotonicDeque<Long - 1, true> abs_diff_deque;
+  SortedWindow<int64_t, Long> sorted;  // Keys of the Long window
+
+  // Base scale only
+  SlidingDFT<Base, Base/2> spectrum_source;
+  float spectrum[Base/2];
+  WaveletDb4<Base> wavelet;
+  float window[Base];           // Chronological copy for the wavelet
+
+  float values[MULTISCALE_NUM_FEATURES];
+  uint64_t computed_mask = 0;
+};
+
+#endif  // MULTI_SCALE_EXTRACTOR_H
@@ -0,0 +1,58 @@
+// Incrementally maintained sorted view of the sample window
+// One shared structure answers median, q25 and q75 (or any quantile) in O(1)
+// after each sample, instead of sorting a copy of the window per statistic.
+
+#ifndef ORDER_STATISTICS_H
+#define ORDER_STATISTICS_H
+
+#include <string.h>
+
+// Sorted array with binary-search insert/erase. The shift is a single
+// memmove, which for a few hundred samples is cheaper on the ESP32 than the
+// pointer chasing of a skiplist or balanced tree.
+template <typename T, int N>
+class SortedWindow {
+public:
+  void insert(T v) {
+    int pos = lower_bound(v);
+    memmove(&vals[pos + 1], &vals[pos], (count - pos) * sizeof(T));
+    vals[pos] = v;
+    count++;
+  }
+
+  // v must be a value previously inserted and not yet erased
+  void erase(T v) {
+    int pos = lower_bound(v);
+    memmove(&vals[pos], &vals[pos + 1], (count - pos - 1) * sizeof(T));
+    count--;
+  }
+
+  int size() const { return count; }
+
+  T at(int rank) const { return vals[rank]; }
+
+  // Same linear interpolation as np.percentile / np.median
+  float quantile(float p) const {
+    float pos = p * (count - 1);
+    int lo = (int)pos;
+    int hi = lo + 1 < count ? lo + 1 : lo;
+    float frac = pos - lo;
+    return vals[lo] + ((float)vals[hi] - (float)vals[lo]) * frac;
+  }
+
+private:
+  int lower_bound(T v) const {
+    int lo = 0, hi = count;
+    while (lo < hi) {
+      int mid = (lo + hi) / 2;
+      if (vals[mid] < v) lo = mid + 1;
+      else hi = mid;
+    }
+    return lo;
+  }
+
+  T vals[N];
+  int count = 0;
+};
+
+#endif  // ORDER_STATISTICS_H
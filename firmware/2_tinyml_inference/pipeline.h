@@ -0,0 +1,50 @@
+// Types shared by the RF detector's staged pipeline and its host stress test
+// The feature stage (core 0) turns samples into Detections; the act stage
+// (loop() on core 1) logs them, mitigates and draws. Everything the act
+// stage needs travels in the Detection, so the two cores share nothing but
+// the queues.
+
+#ifndef PIPELINE_H
+#define PIPELINE_H
+
+#include <stdint.h>
+#include "spsc_queue.h"
+
+#define DETECTION_QUEUE_SIZE 16   // 0.8 s of hops at 200 Hz / 10
+
+struct Detection {
+  uint32_t seq;            // Inference number, from 1
+  uint8_t cls;             // This window's vote
+  uint8_t activity;        // Decoded over recent windows (temporal_decoder.h)
+  uint8_t confidence;      // Percent of the decoder's windows voting for it
+  uint16_t lag;            // Windows from the start of activity to the decoder's switch
+  bool early_exit;         // The IDLE cascade settled it without the forest
+  uint8_t computed;        // Features the cascade and trees evaluated
+  uint16_t ring_backlog;   // Deepest sample backlog the feature stage has seen
+  uint32_t low_rate_ms;    // Time at the reduced sample rate since boot
+  uint16_t rate_drops;     // Rate controller: drops to the reduced rate,
+  uint16_t rate_trips;     // returns on its activity detector,
+  uint16_t rate_probes;    // and returns to probe
+  uint32_t sample_t_us;    // Newest sample in the window
+  uint32_t done_t_us;      // Feature stage finished
+  uint32_t classify_us;    // Extraction and vote
+  uint32_t cycles;
+  float dump[4];           // mean, std, range, fft_peak on every 10th; else 0
+};
+
+// Latency of one stage: count, mean and max. Owned by one thread.
+struct StageStats {
+  uint32_t count = 0;
+  uint32_t max_us = 0;
+  uint64_t sum_us = 0;
+
+  void add(uint32_t us) {
+    count++;
+    sum_us += us;
+    if (us > max_us) max_us = us;
+  }
+
+  uint32_t avg_us() const { return count ? (uint32_t)(sum_us / count) : 0; }
+};
+
+#endif  // PIPELINE_H
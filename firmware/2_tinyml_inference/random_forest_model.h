@@ -1,22 +1,27 @@
-// Auto-generated Random Forest Decision Tree for ESP32
+// Auto-generated Random Forest for ESP32
 // Generated from trained sklearn RandomForestClassifier
 // Accuracy: 80.61%
 // Model: data/models/random_forest.pkl
+// Trees: 1 of 1 | Nodes: 449 | Backend: nodes
+// Footprint: 3596 bytes flash, 12 bytes RAM
+// Latency: 33 ns/window on the build host (firmware/host/bench_forest)
 
 #ifndef RANDOM_FOREST_MODEL_H
 #define RANDOM_FOREST_MODEL_H
 
+#include "forest_runtime.h"
+
 // Feature indices (must match training order)
 // 0-13: Time domain features
-// 14-23: Frequency domain features  
+// 14-23: Frequency domain features
 // 24-29: Wavelet features
 
 const char* FEATURE_NAMES[30] = {
   "mean", "std", "var", "min", "max", "range", "median",
   "skewness", "kurtosis", "q25", "q75", "mean_abs_diff",
-  "std_diff", "max_diff", "fft_low", "fft_mid", "fft_high",
-  "fft_total", "fft_spread", "fft_range", "fft_dom", "fft_peak",
-  "fft_centroid", "fft_rolloff", "wav_approx_std", "wav_detail1_std",
+  "std_diff", "max_diff", "fft_dom", "fft_peak", "fft_mean",
+  "fft_std", "fft_low", "fft_mid", "fft_high", "fft_centroid",
+  "fft_rolloff", "fft_entropy", "wav_approx_std", "wav_detail1_std",
   "wav_detail2_std", "wav_detail3_std", "wav_detail1_energy",
   "wav_detail2_energy"
 };
@@ -26,906 +31,153 @@ const char* activity_names[6] = {
   "IDLE", "SOCIAL", "VIDEO", "MESSAGE", "BROWSE", "GAMING"
 };
 
-// Decision tree classifier (extracted from Random Forest)
-int classify_random_forest(float* features) {
-if (features[27] <= 24.434164f) {
-  if (features[18] <= 141557.484375f) {
-    return 2;  // VIDEO
-  } else {
-    if (features[23] <= 0.842603f) {
-      if (features[6] <= 1430.200012f) {
-        if (features[15] <= 141829.867188f) {
-          if (features[0] <= 1408.258057f) {
-            if (features[19] <= 6094.030518f) {
-              if (features[18] <= 144859.960938f) {
-                return 2;  // VIDEO
-              } else {
-                return 0;  // IDLE
-              }
-            } else {
-              if (features[21] <= 1.344099f) {
-                if (features[29] <= 519.533112f) {
-                  if (features[27] <= 13.154297f) {
-                    return 0;  // IDLE
-                  } else {
-                    if (features[10] <= 1430.906250f) {
-                      if (features[15] <= 140314.921875f) {
-                        return 1;  // SOCIAL
-                      } else {
-                        return 0;  // IDLE
-                      }
-                    } else {
-                      return 1;  // SOCIAL
-                    }
-                  }
-                } else {
-                  if (features[6] <= 1428.387512f) {
-                    if (features[23] <= 0.834019f) {
-                      if (features[28] <= 340.791794f) {
-                        return 0;  // IDLE
-                      } else {
-                        return 0;  // IDLE
-                      }
-                    } else {
-                      return 1;  // SOCIAL
-                    }
-                  } else {
-                    return 1;  // SOCIAL
-                  }
-                }
-              } else {
-                if (features[9] <= 1358.179993f) {
-                  if (features[10] <= 1431.609985f) {
-                    return 1;  // SOCIAL
-                  } else {
-                    return 3;  // MESSAGE
-                  }
-                } else {
-                  if (features[0] <= 1406.747131f) {
-                    if (features[26] <= 23.035474f) {
-                      if (features[11] <= 15.241717f) {
-                        return 0;  // IDLE
-                      } else {
-                        return 3;  // MESSAGE
-                      }
-                    } else {
-                      return 1;  // SOCIAL
-                    }
-                  } else {
-                    return 1;  // SOCIAL
-                  }
-                }
-              }
-            }
-          } else {
-            if (features[21] <= 1.280524f) {
-              if (features[26] <= 21.206798f) {
-                if (features[25] <= 27.639824f) {
-                  if (features[29] <= 315.393967f) {
-                    return 1;  // SOCIAL
-                  } else {
-                    if (features[17] <= 19810.951172f) {
-                      return 0;  // IDLE
-                    } else {
-                      return 0;  // IDLE
-                    }
-                  }
-                } else {
-                  if (features[29] <= 390.263702f) {
-                    return 3;  // MESSAGE
-                  } else {
-                    return 1;  // SOCIAL
-                  }
-                }
-              } else {
-                if (features[18] <= 145894.625000f) {
-                  return 3;  // MESSAGE
-                } else {
-                  return 4;  // BROWSE
-                }
-              }
-            } else {
-              if (features[28] <= 572.704407f) {
-                if (features[6] <= 1427.784973f) {
-                  if (features[13] <= 94.684998f) {
-                    if (features[0] <= 1408.910645f) {
-                      return 1;  // SOCIAL
-                    } else {
-                      if (features[12] <= 27.996636f) {
-                        return 0;  // IDLE
-                      } else {
-                        return 0;  // IDLE
-                      }
-                    }
-                  } else {
-                    if (features[18] <= 145788.140625f) {
-                      return 0;  // IDLE
-                    } else {
-                      if (features[23] <= 0.799597f) {
-                        return 0;  // IDLE
-                      } else {
-                        if (features[25] <= 32.044001f) {
-                          return 3;  // MESSAGE
-                        } else {
-                          return 3;  // MESSAGE
-                        }
-                      }
-                    }
-                  }
-                } else {
-                  if (features[1] <= 35.534641f) {
-                    if (features[26] <= 31.693027f) {
-                      if (features[15] <= 140851.992188f) {
-                        return 0;  // IDLE
-                      } else {
-                        if (features[23] <= 0.808017f) {
-                          if (features[11] <= 17.265252f) {
-                            if (features[28] <= 505.807785f) {
-                              return 3;  // MESSAGE
-                            } else {
-                              return 4;  // BROWSE
-                            }
-                          } else {
-                            return 4;  // BROWSE
-                          }
-                        } else {
-                          if (features[16] <= 3072.484863f) {
-                            if (features[13] <= 87.434998f) {
-                              return 3;  // MESSAGE
-                            } else {
-                              return 4;  // BROWSE
-                            }
-                          } else {
-                            if (features[8] <= 0.306338f) {
-                              return 3;  // MESSAGE
-                            } else {
-                              return 3;  // MESSAGE
-                            }
-                          }
-                        }
-                      }
-                    } else {
-                      return 4;  // BROWSE
-                    }
-                  } else {
-                    return 1;  // SOCIAL
-                  }
-                }
-              } else {
-                return 1;  // SOCIAL
-              }
-            }
-          }
-        } else {
-          if (features[6] <= 1428.994995f) {
-            if (features[10] <= 1431.710022f) {
-              if (features[15] <= 142224.367188f) {
-                if (features[25] <= 33.699631f) {
-                  if (features[23] <= 0.665362f) {
-                    return 0;  // IDLE
-                  } else {
-                    if (features[25] <= 17.376893f) {
-                      return 0;  // IDLE
-                    } else {
-                      return 0;  // IDLE
-                    }
-                  }
-                } else {
-                  if (features[28] <= 441.889221f) {
-                    return 4;  // BROWSE
-                  } else {
-                    return 0;  // IDLE
-                  }
-                }
-              } else {
-                if (features[17] <= 19888.104492f) {
-                  return 3;  // MESSAGE
-                } else {
-                  if (features[9] <= 1421.033752f) {
-                    if (features[23] <= 0.560840f) {
-                      return 3;  // MESSAGE
-                    } else {
-                      if (features[13] <= 87.035000f) {
-                        return 3;  // MESSAGE
-                      } else {
-                        return 0;  // IDLE
-                      }
-                    }
-                  } else {
-                    if (features[29] <= 476.867279f) {
-                      return 0;  // IDLE
-                    } else {
-                      if (features[27] <= 17.322894f) {
-                        return 3;  // MESSAGE
-                      } else {
-                        return 0;  // IDLE
-                      }
-                    }
-                  }
-                }
-              }
-            } else {
-              if (features[8] <= 2.584355f) {
-                return 3;  // MESSAGE
-              } else {
-                if (features[1] <= 22.565515f) {
-                  if (features[16] <= 3032.662231f) {
-                    if (features[24] <= 32.231001f) {
-                      if (features[12] <= 24.398915f) {
-                        return 3;  // MESSAGE
-                      } else {
-                        return 0;  // IDLE
-                      }
-                    } else {
-                      return 4;  // BROWSE
-                    }
-                  } else {
-                    return 4;  // BROWSE
-                  }
-                } else {
-                  return 0;  // IDLE
-                }
-              }
-            }
-          } else {
-            if (features[10] <= 1431.710022f) {
-              if (features[15] <= 142545.125000f) {
-                if (features[18] <= 144362.617188f) {
-                  if (features[13] <= 78.974998f) {
-                    return 3;  // MESSAGE
-                  } else {
-                    if (features[13] <= 83.404999f) {
-                      if (features[27] <= 16.734881f) {
-                        return 0;  // IDLE
-                      } else {
-                        return 1;  // SOCIAL
-                      }
-                    } else {
-                      if (features[28] <= 394.659805f) {
-                        if (features[4] <= 1469.484985f) {
-                          return 0;  // IDLE
-                        } else {
-                          if (features[24] <= 16.305929f) {
-                            return 4;  // BROWSE
-                          } else {
-                            return 0;  // IDLE
-                          }
-                        }
-                      } else {
-                        return 0;  // IDLE
-                      }
-                    }
-                  }
-                } else {
-                  if (features[17] <= 19881.489258f) {
-                    return 3;  // MESSAGE
-                  } else {
-                    if (features[13] <= 126.520004f) {
-                      return 0;  // IDLE
-                    } else {
-                      return 3;  // MESSAGE
-                    }
-                  }
-                }
-              } else {
-                return 3;  // MESSAGE
-              }
-            } else {
-              if (features[0] <= 1423.545044f) {
-                if (features[17] <= 19851.070312f) {
-                  return 3;  // MESSAGE
-                } else {
-                  if (features[11] <= 17.008738f) {
-                    if (features[28] <= 277.134651f) {
-                      return 3;  // MESSAGE
-                    } else {
-                      if (features[12] <= 25.237809f) {
-                        return 0;  // IDLE
-                      } else {
-                        return 0;  // IDLE
-                      }
-                    }
-                  } else {
-                    if (features[9] <= 1422.648743f) {
-                      return 0;  // IDLE
-                    } else {
-                      return 3;  // MESSAGE
-                    }
-                  }
-                }
-              } else {
-                if (features[4] <= 1451.354980f) {
-                  return 4;  // BROWSE
-                } else {
-                  if (features[21] <= 1.211864f) {
-                    return 3;  // MESSAGE
-                  } else {
-                    return 3;  // MESSAGE
-                  }
-                }
-              }
-            }
-          }
-        }
-      } else {
-        if (features[16] <= 3025.962280f) {
-          if (features[6] <= 1431.007507f) {
-            if (features[1] <= 19.747495f) {
-              if (features[2] <= 277.269821f) {
-                return 1;  // SOCIAL
-              } else {
-                if (features[19] <= 6164.587402f) {
-                  if (features[7] <= -3.148034f) {
-                    return 4;  // BROWSE
-                  } else {
-                    if (features[27] <= 14.904777f) {
-                      return 4;  // BROWSE
-                    } else {
-                      if (features[26] <= 14.974384f) {
-                        return 4;  // BROWSE
-                      } else {
-                        return 3;  // MESSAGE
-                      }
-                    }
-                  }
-                } else {
-                  if (features[2] <= 379.786621f) {
-                    if (features[12] <= 25.915152f) {
-                      return 3;  // MESSAGE
-                    } else {
-                      return 3;  // MESSAGE
-                    }
-                  } else {
-                    return 4;  // BROWSE
-                  }
-                }
-              }
-            } else {
-              if (features[23] <= 0.609337f) {
-                if (features[3] <= 1347.804993f) {
-                  if (features[4] <= 1442.085022f) {
-                    return 3;  // MESSAGE
-                  } else {
-                    if (features[27] <= 18.117161f) {
-                      return 0;  // IDLE
-                    } else {
-                      return 0;  // IDLE
-                    }
-                  }
-                } else {
-                  if (features[25] <= 23.977507f) {
-                    return 4;  // BROWSE
-                  } else {
-                    return 3;  // MESSAGE
-                  }
-                }
-              } else {
-                if (features[10] <= 1431.609985f) {
-                  return 0;  // IDLE
-                } else {
-                  if (features[15] <= 142547.117188f) {
-                    if (features[3] <= 1351.429993f) {
-                      return 3;  // MESSAGE
-                    } else {
-                      return 4;  // BROWSE
-                    }
-                  } else {
-                    return 0;  // IDLE
-                  }
-                }
-              }
-            }
-          } else {
-            if (features[9] <= 1427.078796f) {
-              if (features[11] <= 13.333131f) {
-                if (features[17] <= 19911.621094f) {
-                  return 0;  // IDLE
-                } else {
-                  if (features[19] <= 5846.133789f) {
-                    return 3;  // MESSAGE
-                  } else {
-                    if (features[7] <= -3.518493f) {
-                      return 3;  // MESSAGE
-                    } else {
-                      return 3;  // MESSAGE
-                    }
-                  }
-                }
-              } else {
-                if (features[0] <= 1425.245544f) {
-                  if (features[0] <= 1424.911133f) {
-                    if (features[25] <= 22.034439f) {
-                      if (features[24] <= 23.646178f) {
-                        if (features[0] <= 1424.717468f) {
-                          if (features[1] <= 21.137201f) {
-                            if (features[26] <= 27.978153f) {
-                              return 3;  // MESSAGE
-                            } else {
-                              return 4;  // BROWSE
-                            }
-                          } else {
-                            return 0;  // IDLE
-                          }
-                        } else {
-                          return 4;  // BROWSE
-                        }
-                      } else {
-                        return 4;  // BROWSE
-                      }
-                    } else {
-                      if (features[18] <= 144432.476562f) {
-                        if (features[1] <= 21.025502f) {
-                          return 4;  // BROWSE
-                        } else {
-                          return 3;  // MESSAGE
-                        }
-                      } else {
-                        return 3;  // MESSAGE
-                      }
-                    }
-                  } else {
-                    if (features[10] <= 1434.130005f) {
-                      if (features[13] <= 107.985001f) {
-                        if (features[28] <= 296.011887f) {
-                          return 3;  // MESSAGE
-                        } else {
-                          return 3;  // MESSAGE
-                        }
-                      } else {
-                        return 3;  // MESSAGE
-                      }
-                    } else {
-                      return 4;  // BROWSE
-                    }
-                  }
-                } else {
-                  if (features[8] <= 10.736091f) {
-                    if (features[12] <= 26.068702f) {
-                      if (features[21] <= 1.307265f) {
-                        if (features[12] <= 22.406758f) {
-                          return 4;  // BROWSE
-                        } else {
-                          return 4;  // BROWSE
-                        }
-                      } else {
-                        return 4;  // BROWSE
-                      }
-                    } else {
-                      if (features[10] <= 1433.326233f) {
-                        if (features[26] <= 18.521375f) {
-                          return 4;  // BROWSE
-                        } else {
-                          return 3;  // MESSAGE
-                        }
-                      } else {
-                        if (features[26] <= 16.413188f) {
-                          return 4;  // BROWSE
-                        } else {
-                          return 4;  // BROWSE
-                        }
-                      }
-                    }
-                  } else {
-                    if (features[24] <= 16.384473f) {
-                      return 3;  // MESSAGE
-                    } else {
-                      return 4;  // BROWSE
-                    }
-                  }
-                }
-              }
-            } else {
-              if (features[21] <= 1.364628f) {
-                if (features[10] <= 1432.516235f) {
-                  if (features[16] <= 3008.763550f) {
-                    return 3;  // MESSAGE
-                  } else {
-                    if (features[18] <= 144077.156250f) {
-                      return 0;  // IDLE
-                    } else {
-                      return 4;  // BROWSE
-                    }
-                  }
-                } else {
-                  if (features[3] <= 1330.474976f) {
-                    return 1;  // SOCIAL
-                  } else {
-                    if (features[8] <= 10.274560f) {
-                      if (features[17] <= 19962.890625f) {
-                        return 4;  // BROWSE
-                      } else {
-                        return 4;  // BROWSE
-                      }
-                    } else {
-                      if (features[18] <= 144144.414062f) {
-                        return 4;  // BROWSE
-                      } else {
-                        return 3;  // MESSAGE
-                      }
-                    }
-                  }
-                }
-              } else {
-                return 3;  // MESSAGE
-              }
-            }
-          }
-        } else {
-          if (features[16] <= 3064.272583f) {
-            if (features[27] <= 19.196944f) {
-              if (features[25] <= 25.334064f) {
-                if (features[15] <= 142437.484375f) {
-                  if (features[10] <= 1432.921204f) {
-                    if (features[9] <= 1416.501221f) {
-                      if (features[4] <= 1442.085022f) {
-                        return 3;  // MESSAGE
-                      } else {
-                        return 4;  // BROWSE
-                      }
-                    } else {
-                      if (features[12] <= 26.450023f) {
-                        if (features[19] <= 6493.085449f) {
-                          if (features[15] <= 141885.906250f) {
-                            return 3;  // MESSAGE
-                          } else {
-                            return 0;  // IDLE
-                          }
-                        } else {
-                          return 3;  // MESSAGE
-                        }
-                      } else {
-                        if (features[4] <= 1444.505005f) {
-                          return 4;  // BROWSE
-                        } else {
-                          if (features[11] <= 13.992222f) {
-                            return 4;  // BROWSE
-                          } else {
-                            if (features[13] <= 91.470001f) {
-                              return 3;  // MESSAGE
-                            } else {
-                              return 3;  // MESSAGE
-                            }
-                          }
-                        }
-                      }
-                    }
-                  } else {
-                    if (features[12] <= 28.930621f) {
-                      if (features[15] <= 141221.062500f) {
-                        return 3;  // MESSAGE
-                      } else {
-                        return 4;  // BROWSE
-                      }
-                    } else {
-                      return 3;  // MESSAGE
-                    }
-                  }
-                } else {
-                  if (features[28] <= 192.647408f) {
-                    return 3;  // MESSAGE
-                  } else {
-                    if (features[6] <= 1430.602539f) {
-                      return 3;  // MESSAGE
-                    } else {
-                      if (features[27] <= 16.238756f) {
-                        if (features[2] <= 424.317825f) {
-                          return 3;  // MESSAGE
-                        } else {
-                          return 4;  // BROWSE
-                        }
-                      } else {
-                        return 4;  // BROWSE
-                      }
-                    }
-                  }
-                }
-              } else {
-                if (features[4] <= 1472.710022f) {
-                  if (features[24] <= 90.593163f) {
-                    if (features[12] <= 27.553678f) {
-                      return 4;  // BROWSE
-                    } else {
-                      if (features[26] <= 20.819643f) {
-                        return 3;  // MESSAGE
-                      } else {
-                        return 4;  // BROWSE
-                      }
-                    }
-                  } else {
-                    return 3;  // MESSAGE
-                  }
-                } else {
-                  if (features[10] <= 1433.326233f) {
-                    if (features[17] <= 19912.654297f) {
-                      return 4;  // BROWSE
-                    } else {
-                      if (features[21] <= 1.328151f) {
-                        return 4;  // BROWSE
-                      } else {
-                        return 3;  // MESSAGE
-                      }
-                    }
-                  } else {
-                    return 4;  // BROWSE
-                  }
-                }
-              }
-            } else {
-              if (features[5] <= 120.480000f) {
-                if (features[9] <= 1418.919983f) {
-                  return 4;  // BROWSE
-                } else {
-                  if (features[23] <= 0.642382f) {
-                    return 4;  // BROWSE
-                  } else {
-                    return 3;  // MESSAGE
-                  }
-                }
-              } else {
-                if (features[15] <= 142207.492188f) {
-                  return 3;  // MESSAGE
-                } else {
-                  if (features[18] <= 144045.296875f) {
-                    if (features[5] <= 139.010002f) {
-                      return 3;  // MESSAGE
-                    } else {
-                      return 0;  // IDLE
-                    }
-                  } else {
-                    if (features[26] <= 19.808696f) {
-                      if (features[2] <= 446.027252f) {
-                        return 0;  // IDLE
-                      } else {
-                        return 3;  // MESSAGE
-                      }
-                    } else {
-                      if (features[5] <= 143.445000f) {
-                        if (features[17] <= 19894.701172f) {
-                          return 4;  // BROWSE
-                        } else {
-                          if (features[13] <= 82.195000f) {
-                            return 3;  // MESSAGE
-                          } else {
-                            return 4;  // BROWSE
-                          }
-                        }
-                      } else {
-                        if (features[19] <= 8397.511230f) {
-                          if (features[10] <= 1433.224976f) {
-                            return 3;  // MESSAGE
-                          } else {
-                            if (features[26] <= 28.419750f) {
-                              return 4;  // BROWSE
-                            } else {
-                              return 3;  // MESSAGE
-                            }
-                          }
-                        } else {
-                          return 3;  // MESSAGE
-                        }
-                      }
-                    }
-                  }
-                }
-              }
-            }
-          } else {
-            if (features[12] <= 35.218632f) {
-              if (features[9] <= 1418.116211f) {
-                if (features[23] <= 0.816277f) {
-                  if (features[29] <= 436.501190f) {
-                    if (features[2] <= 962.787109f) {
-                      return 4;  // BROWSE
-                    } else {
-                      return 3;  // MESSAGE
-                    }
-                  } else {
-                    if (features[0] <= 1413.734131f) {
-                      if (features[0] <= 1411.268127f) {
-                        return 1;  // SOCIAL
-                      } else {
-                        return 4;  // BROWSE
-                      }
-                    } else {
-                      return 3;  // MESSAGE
-                    }
-                  }
-                } else {
-                  if (features[21] <= 1.391896f) {
-                    return 4;  // BROWSE
-                  } else {
-                    return 3;  // MESSAGE
-                  }
-                }
-              } else {
-                if (features[2] <= 691.318512f) {
-                  return 3;  // MESSAGE
-                } else {
-                  if (features[26] <= 22.807362f) {
-                    if (features[24] <= 61.646021f) {
-                      if (features[11] <= 14.216616f) {
-                        return 1;  // SOCIAL
-                      } else {
-                        if (features[18] <= 146369.125000f) {
-                          return 4;  // BROWSE
-                        } else {
-                          return 3;  // MESSAGE
-                        }
-                      }
-                    } else {
-                      return 3;  // MESSAGE
-                    }
-                  } else {
-                    if (features[11] <= 15.070909f) {
-                      if (features[21] <= 1.382891f) {
-                        return 4;  // BROWSE
-                      } else {
-                        return 3;  // MESSAGE
-                      }
-                    } else {
-                      return 4;  // BROWSE
-                    }
-                  }
-                }
-              }
-            } else {
-              return 5;  // GAMING
-            }
-          }
-        }
-      }
-    } else {
-      if (features[17] <= 19652.078125f) {
-        if (features[24] <= 60.240459f) {
-          return 4;  // BROWSE
-        } else {
-          if (features[18] <= 146469.750000f) {
-            if (features[28] <= 272.339767f) {
-              return 0;  // IDLE
-            } else {
-              if (features[5] <= 172.854996f) {
-                if (features[13] <= 91.865002f) {
-                  if (features[21] <= 1.579678f) {
-                    return 1;  // SOCIAL
-                  } else {
-                    if (features[6] <= 1427.179993f) {
-                      if (features[9] <= 1355.355042f) {
-                        return 1;  // SOCIAL
-                      } else {
-                        return 1;  // SOCIAL
-                      }
-                    } else {
-                      return 4;  // BROWSE
-                    }
-                  }
-                } else {
-                  if (features[21] <= 1.540912f) {
-                    if (features[9] <= 1355.760010f) {
-                      return 1;  // SOCIAL
-                    } else {
-                      if (features[1] <= 37.232479f) {
-                        return 1;  // SOCIAL
-                      } else {
-                        return 3;  // MESSAGE
-                      }
-                    }
-                  } else {
-                    if (features[18] <= 142896.054688f) {
-                      return 1;  // SOCIAL
-                    } else {
-                      return 1;  // SOCIAL
-                    }
-                  }
-                }
-              } else {
-                if (features[5] <= 173.659996f) {
-                  return 0;  // IDLE
-                } else {
-                  return 1;  // SOCIAL
-                }
-              }
-            }
-          } else {
-            return 1;  // SOCIAL
-          }
-        }
-      } else {
-        if (features[17] <= 19697.824219f) {
-          if (features[18] <= 146260.195312f) {
-            if (features[19] <= 7605.632812f) {
-              return 3;  // MESSAGE
-            } else {
-              if (features[18] <= 145732.976562f) {
-                return 3;  // MESSAGE
-              } else {
-                if (features[11] <= 17.866818f) {
-                  return 1;  // SOCIAL
-                } else {
-                  if (features[5] <= 138.205002f) {
-                    return 4;  // BROWSE
-                  } else {
-                    return 1;  // SOCIAL
-                  }
-                }
-              }
-            }
-          } else {
-            if (features[26] <= 28.396122f) {
-              return 4;  // BROWSE
-            } else {
-              return 3;  // MESSAGE
-            }
-          }
-        } else {
-          if (features[18] <= 146036.093750f) {
-            if (features[23] <= 0.873915f) {
-              if (features[25] <= 33.815174f) {
-                if (features[27] <= 20.673238f) {
-                  if (features[13] <= 94.285000f) {
-                    return 3;  // MESSAGE
-                  } else {
-                    return 4;  // BROWSE
-                  }
-                } else {
-                  return 3;  // MESSAGE
-                }
-              } else {
-                return 3;  // MESSAGE
-              }
-            } else {
-              return 1;  // SOCIAL
-            }
-          } else {
-            if (features[1] <= 35.456854f) {
-              if (features[3] <= 1344.575012f) {
-                if (features[28] <= 266.384132f) {
-                  return 3;  // MESSAGE
-                } else {
-                  if (features[11] <= 20.268182f) {
-                    if (features[26] <= 20.690195f) {
-                      return 3;  // MESSAGE
-                    } else {
-                      if (features[2] <= 1121.666077f) {
-                        if (features[9] <= 1404.717468f) {
-                          return 1;  // SOCIAL
-                        } else {
-                          return 4;  // BROWSE
-                        }
-                      } else {
-                        return 4;  // BROWSE
-                      }
-                    }
-                  } else {
-                    return 3;  // MESSAGE
-                  }
-                }
-              } else {
-                return 3;  // MESSAGE
-              }
-            } else {
-              return 3;  // MESSAGE
-            }
-          }
-        }
-      }
-    }
-  }
-} else {
-  if (features[10] <= 1434.534973f) {
-    if (features[19] <= 8459.102783f) {
-      return 4;  // BROWSE
-    } else {
-      return 1;  // SOCIAL
-    }
-  } else {
-    if (features[21] <= 1.857897f) {
-      return 4;  // BROWSE
-    } else {
-      return 5;  // GAMING
-    }
-  }
+#define FOREST_BACKEND "nodes"
+#define FOREST_NUM_FEATURES 30
+#define FOREST_NUM_TREES 1
+#define FOREST_NUM_NODES 449
+#define FOREST_NUM_CLASSES 6
+#define FOREST_FLASH_BYTES 3596
+#define FOREST_RAM_BYTES 12
+
+// Features the trees test (27 of 30); FeatureExtractor<..., FOREST_FEATURE_MASK>
+// compiles out the code and buffers of the rest
+static constexpr uint32_t FOREST_FEATURE_MASK = 0x3FAFBFFF;
+
+static const ForestNode FOREST_NODES[449] = {
+  // Tree 0: 449 nodes, depth 15
+  {24.434164f, 442, 27, 0}, {141557.484f, 3, 18, 0}, {0.0f, 2, 255, 0}, {0.842603028f, 375, 23, 0},
+  {1430.19995f, 162, 6, 0}, {141829.875f, 87, 15, 0}, {1408.25806f, 38, 0, 0}, {6094.03076f, 11, 19, 0},
+  {144859.969f, 10, 18, 0}, {0.0f, 2, 255, 0}, {0.0f, 0, 255, 0}, {1.34409904f, 27, 21, 0},
+  {519.533142f, 20, 29, 0}, {13.1542969f, 15, 27, 0}, {0.0f, 0, 255, 0}, {1430.90625f, 19, 10, 0},
+  {140314.922f, 18, 15, 0}, {0.0f, 1, 255, 0}, {0.0f, 0, 255, 0}, {0.0f, 1, 255, 0},
+  {1428.38745f, 26, 6, 0}, {0.834019005f, 25, 23, 0}, {340.791809f, 24, 28, 0}, {0.0f, 0, 255, 0},
+  {0.0f, 0, 255, 0}, {0.0f, 1, 255, 0}, {0.0f, 1, 255, 0}, {1358.18005f, 31, 9, 0},
+  {1431.60999f, 30, 10, 0}, {0.0f, 1, 255, 0}, {0.0f, 3, 255, 0}, {1406.74707f, 37, 0, 0},
+  {23.0354748f, 36, 26, 0}, {15.2417173f, 35, 11, 0}, {0.0f, 0, 255, 0}, {0.0f, 3, 255, 0},
+  {0.0f, 1, 255, 0}, {0.0f, 1, 255, 0}, {1.28052402f, 52, 21, 0}, {21.2067986f, 49, 26, 0},
+  {27.6398239f, 46, 25, 0}, {315.393982f, 43, 29, 0}, {0.0f, 1, 255, 0}, {19810.9512f, 45, 17, 0},
+  {0.0f, 0, 255, 0}, {0.0f, 0, 255, 0}, {390.263702f, 48, 29, 0}, {0.0f, 3, 255, 0},
+  {0.0f, 1, 255, 0}, {145894.625f, 51, 18, 0}, {0.0f, 3, 255, 0}, {0.0f, 4, 255, 0},
+  {572.704407f, 86, 28, 0}, {1427.78491f, 67, 6, 0}, {94.6849976f, 60, 13, 0}, {1408.91064f, 57, 0, 0},
+  {0.0f, 1, 255, 0}, {27.9966354f, 59, 12, 0}, {0.0f, 0, 255, 0}, {0.0f, 0, 255, 0},
+  {145788.141f, 62, 18, 0}, {0.0f, 0, 255, 0}, {0.799597025f, 64, 23, 0}, {0.0f, 0, 255, 0},
+  {32.0440025f, 66, 25, 0}, {0.0f, 3, 255, 0}, {0.0f, 3, 255, 0}, {35.5346413f, 85, 1, 0},
+  {31.6930275f, 84, 26, 0}, {140852.0f, 71, 15, 0}, {0.0f, 0, 255, 0}, {0.808017015f, 77, 23, 0},
+  {17.2652512f, 76, 11, 0}, {505.80777f, 75, 28, 0}, {0.0f, 3, 255, 0}, {0.0f, 4, 255, 0},
+  {0.0f, 4, 255, 0}, {3072.48486f, 81, 16, 0}, {87.4349976f, 80, 13, 0}, {0.0f, 3, 255, 0},
+  {0.0f, 4, 255, 0}, {0.306338012f, 83, 8, 0}, {0.0f, 3, 255, 0}, {0.0f, 3, 255, 0},
+  {0.0f, 4, 255, 0}, {0.0f, 1, 255, 0}, {0.0f, 1, 255, 0}, {1428.995f, 123, 6, 0},
+  {1431.71008f, 112, 10, 0}, {142224.375f, 99, 15, 0}, {33.6996307f, 96, 25, 0}, {0.665362f, 93, 23, 0},
+  {0.0f, 0, 255, 0}, {17.3768921f, 95, 25, 0}, {0.0f, 0, 255, 0}, {0.0f, 0, 255, 0},
+  {441.889221f, 98, 28, 0}, {0.0f, 4, 255, 0}, {0.0f, 0, 255, 0}, {19888.1035f, 101, 17, 0},
+  {0.0f, 3, 255, 0}, {1421.03369f, 107, 9, 0}, {0.560840011f, 104, 23, 0}, {0.0f, 3, 255, 0},
+  {87.0350037f, 106, 13, 0}, {0.0f, 3, 255, 0}, {0.0f, 0, 255, 0}, {476.867279f, 109, 29, 0},
+  {0.0f, 0, 255, 0}, {17.3228931f, 111, 27, 0}, {0.0f, 3, 255, 0}, {0.0f, 0, 255, 0},
+  {2.58435512f, 114, 8, 0}, {0.0f, 3, 255, 0}, {22.5655155f, 122, 1, 0}, {3032.66211f, 121, 16, 0},
+  {32.2310028f, 120, 24, 0}, {24.3989143f, 119, 12, 0}, {0.0f, 3, 255, 0}, {0.0f, 0, 255, 0},
+  {0.0f, 4, 255, 0}, {0.0f, 4, 255, 0}, {0.0f, 0, 255, 0}, {1431.71008f, 145, 10, 0},
+  {142545.125f, 144, 15, 0}, {144362.625f, 139, 18, 0}, {78.9749985f, 128, 13, 0}, {0.0f, 3, 255, 0},
+  {83.4049988f, 132, 13, 0}, {16.7348804f, 131, 27, 0}, {0.0f, 0, 255, 0}, {0.0f, 1, 255, 0},
+  {394.65979f, 138, 28, 0}, {1469.48499f, 135, 4, 0}, {0.0f, 0, 255, 0}, {16.3059292f, 137, 24, 0},
+  {0.0f, 4, 255, 0}, {0.0f, 0, 255, 0}, {0.0f, 0, 255, 0}, {19881.4902f, 141, 17, 0},
+  {0.0f, 3, 255, 0}, {126.520004f, 143, 13, 0}, {0.0f, 0, 255, 0}, {0.0f, 3, 255, 0},
+  {0.0f, 3, 255, 0}, {1423.54504f, 157, 0, 0}, {19851.0703f, 148, 17, 0}, {0.0f, 3, 255, 0},
+  {17.0087376f, 154, 11, 0}, {277.134644f, 151, 28, 0}, {0.0f, 3, 255, 0}, {25.2378082f, 153, 12, 0},
+  {0.0f, 0, 255, 0}, {0.0f, 0, 255, 0}, {1422.6488f, 156, 9, 0}, {0.0f, 0, 255, 0},
+  {0.0f, 3, 255, 0}, {1451.35498f, 159, 4, 0}, {0.0f, 4, 255, 0}, {1.21186399f, 161, 21, 0},
+  {0.0f, 3, 255, 0}, {0.0f, 3, 255, 0}, {3025.96216f, 264, 16, 0}, {1431.00745f, 197, 6, 0},
+  {19.7474957f, 180, 1, 0}, {277.269806f, 167, 2, 0}, {0.0f, 1, 255, 0}, {6164.5874f, 175, 19, 0},
+  {-3.1480341f, 170, 7, 0}, {0.0f, 4, 255, 0}, {14.9047766f, 172, 27, 0}, {0.0f, 4, 255, 0},
+  {14.9743843f, 174, 26, 0}, {0.0f, 4, 255, 0}, {0.0f, 3, 255, 0}, {379.786621f, 179, 2, 0},
+  {25.9151516f, 178, 12, 0}, {0.0f, 3, 255, 0}, {0.0f, 3, 255, 0}, {0.0f, 4, 255, 0},
+  {0.609336972f, 190, 23, 0}, {1347.80505f, 187, 3, 0}, {1442.08508f, 184, 4, 0}, {0.0f, 3, 255, 0},
+  {18.1171608f, 186, 27, 0}, {0.0f, 0, 255, 0}, {0.0f, 0, 255, 0}, {23.9775066f, 189, 25, 0},
+  {0.0f, 4, 255, 0}, {0.0f, 3, 255, 0}, {1431.60999f, 192, 10, 0}, {0.0f, 0, 255, 0},
+  {142547.125f, 196, 15, 0}, {1351.43005f, 195, 3, 0}, {0.0f, 3, 255, 0}, {0.0f, 4, 255, 0},
+  {0.0f, 0, 255, 0}, {1427.07874f, 247, 9, 0}, {13.3331308f, 206, 11, 0}, {19911.6211f, 201, 17, 0},
+  {0.0f, 0, 255, 0}, {5846.13379f, 203, 19, 0}, {0.0f, 3, 255, 0}, {-3.51849294f, 205, 7, 0},
+  {0.0f, 3, 255, 0}, {0.0f, 3, 255, 0}, {1425.24548f, 230, 0, 0}, {1424.91113f, 223, 0, 0},
+  {22.0344391f, 218, 25, 0}, {23.6461773f, 217, 24, 0}, {1424.71741f, 216, 0, 0}, {21.1372013f, 215, 1, 0},
+  {27.9781532f, 214, 26, 0}, {0.0f, 3, 255, 0}, {0.0f, 4, 255, 0}, {0.0f, 0, 255, 0},
+  {0.0f, 4, 255, 0}, {0.0f, 4, 255, 0}, {144432.469f, 222, 18, 0}, {21.0255013f, 221, 1, 0},
+  {0.0f, 4, 255, 0}, {0.0f, 3, 255, 0}, {0.0f, 3, 255, 0}, {1434.13f, 229, 10, 0},
+  {107.985001f, 228, 13, 0}, {296.011902f, 227, 28, 0}, {0.0f, 3, 255, 0}, {0.0f, 3, 255, 0},
+  {0.0f, 3, 255, 0}, {0.0f, 4, 255, 0}, {10.7360907f, 244, 8, 0}, {26.0687027f, 237, 12, 0},
+  {1.30726504f, 236, 21, 0}, {22.4067574f, 235, 12, 0}, {0.0f, 4, 255, 0}, {0.0f, 4, 255, 0},
+  {0.0f, 4, 255, 0}, {1433.32629f, 241, 10, 0}, {18.5213757f, 240, 26, 0}, {0.0f, 4, 255, 0},
+  {0.0f, 3, 255, 0}, {16.4131889f, 243, 26, 0}, {0.0f, 4, 255, 0}, {0.0f, 4, 255, 0},
+  {16.3844738f, 246, 24, 0}, {0.0f, 3, 255, 0}, {0.0f, 4, 255, 0}, {1.36462796f, 263, 21, 0},
+  {1432.51624f, 254, 10, 0}, {3008.76367f, 251, 16, 0}, {0.0f, 3, 255, 0}, {144077.156f, 253, 18, 0},
+  {0.0f, 0, 255, 0}, {0.0f, 4, 255, 0}, {1330.47498f, 256, 3, 0}, {0.0f, 1, 255, 0},
+  {10.27456f, 260, 8, 0}, {19962.8906f, 259, 17, 0}, {0.0f, 4, 255, 0}, {0.0f, 4, 255, 0},
+  {144144.406f, 262, 18, 0}, {0.0f, 4, 255, 0}, {0.0f, 3, 255, 0}, {0.0f, 3, 255, 0},
+  {3064.27246f, 344, 16, 0}, {19.1969433f, 315, 27, 0}, {25.3340645f, 300, 25, 0}, {142437.484f, 291, 15, 0},
+  {1432.92126f, 286, 10, 0}, {1416.50122f, 273, 9, 0}, {1442.08508f, 272, 4, 0}, {0.0f, 3, 255, 0},
+  {0.0f, 4, 255, 0}, {26.4500237f, 279, 12, 0}, {6493.08545f, 278, 19, 0}, {141885.906f, 277, 15, 0},
+  {0.0f, 3, 255, 0}, {0.0f, 0, 255, 0}, {0.0f, 3, 255, 0}, {1444.505f, 281, 4, 0},
+  {0.0f, 4, 255, 0}, {13.9922218f, 283, 11, 0}, {0.0f, 4, 255, 0}, {91.4700012f, 285, 13, 0},
+  {0.0f, 3, 255, 0}, {0.0f, 3, 255, 0}, {28.9306202f, 290, 12, 0}, {141221.062f, 289, 15, 0},
+  {0.0f, 3, 255, 0}, {0.0f, 4, 255, 0}, {0.0f, 3, 255, 0}, {192.647415f, 293, 28, 0},
+  {0.0f, 3, 255, 0}, {1430.60254f, 295, 6, 0}, {0.0f, 3, 255, 0}, {16.2387562f, 299, 27, 0},
+  {424.31781f, 298, 2, 0}, {0.0f, 3, 255, 0}, {0.0f, 4, 255, 0}, {0.0f, 4, 255, 0},
+  {1472.71008f, 308, 4, 0}, {90.5931625f, 307, 24, 0}, {27.5536785f, 304, 12, 0}, {0.0f, 4, 255, 0},
+  {20.819643f, 306, 26, 0}, {0.0f, 3, 255, 0}, {0.0f, 4, 255, 0}, {0.0f, 3, 255, 0},
+  {1433.32629f, 314, 10, 0}, {19912.6543f, 311, 17, 0}, {0.0f, 4, 255, 0}, {1.32815099f, 313, 21, 0},
+  {0.0f, 4, 255, 0}, {0.0f, 3, 255, 0}, {0.0f, 4, 255, 0}, {120.480003f, 321, 5, 0},
+  {1418.92004f, 318, 9, 0}, {0.0f, 4, 255, 0}, {0.642382026f, 320, 23, 0}, {0.0f, 4, 255, 0},
+  {0.0f, 3, 255, 0}, {142207.5f, 323, 15, 0}, {0.0f, 3, 255, 0}, {144045.297f, 327, 18, 0},
+  {139.009995f, 326, 5, 0}, {0.0f, 3, 255, 0}, {0.0f, 0, 255, 0}, {19.8086967f, 331, 26, 0},
+  {446.027252f, 330, 2, 0}, {0.0f, 0, 255, 0}, {0.0f, 3, 255, 0}, {143.445007f, 337, 5, 0},
+  {19894.7012f, 334, 17, 0}, {0.0f, 4, 255, 0}, {82.1949997f, 336, 13, 0}, {0.0f, 3, 255, 0},
+  {0.0f, 4, 255, 0}, {8397.51074f, 343, 19, 0}, {1433.22498f, 340, 10, 0}, {0.0f, 3, 255, 0},
+  {28.4197502f, 342, 26, 0}, {0.0f, 4, 255, 0}, {0.0f, 3, 255, 0}, {0.0f, 3, 255, 0},
+  {35.2186317f, 374, 12, 0}, {1418.11621f, 359, 9, 0}, {0.816277027f, 356, 23, 0}, {436.50119f, 351, 29, 0},
+  {962.787109f, 350, 2, 0}, {0.0f, 4, 255, 0}, {0.0f, 3, 255, 0}, {1413.73413f, 355, 0, 0},
+  {1411.26807f, 354, 0, 0}, {0.0f, 1, 255, 0}, {0.0f, 4, 255, 0}, {0.0f, 3, 255, 0},
+  {1.39189601f, 358, 21, 0}, {0.0f, 4, 255, 0}, {0.0f, 3, 255, 0}, {691.318542f, 361, 2, 0},
+  {0.0f, 3, 255, 0}, {22.8073616f, 369, 26, 0}, {61.6460228f, 368, 24, 0}, {14.2166157f, 365, 11, 0},
+  {0.0f, 1, 255, 0}, {146369.125f, 367, 18, 0}, {0.0f, 4, 255, 0}, {0.0f, 3, 255, 0},
+  {0.0f, 3, 255, 0}, {15.0709085f, 373, 11, 0}, {1.38289106f, 372, 21, 0}, {0.0f, 4, 255, 0},
+  {0.0f, 3, 255, 0}, {0.0f, 4, 255, 0}, {0.0f, 5, 255, 0}, {19652.0781f, 403, 17, 0},
+  {60.2404594f, 378, 24, 0}, {0.0f, 4, 255, 0}, {146469.75f, 402, 18, 0}, {272.339752f, 381, 28, 0},
+  {0.0f, 0, 255, 0}, {172.854996f, 399, 5, 0}, {91.8650055f, 390, 13, 0}, {1.57967806f, 385, 21, 0},
+  {0.0f, 1, 255, 0}, {1427.18005f, 389, 6, 0}, {1355.3551f, 388, 9, 0}, {0.0f, 1, 255, 0},
+  {0.0f, 1, 255, 0}, {0.0f, 4, 255, 0}, {1.54091203f, 396, 21, 0}, {1355.76001f, 393, 9, 0},
+  {0.0f, 1, 255, 0}, {37.2324791f, 395, 1, 0}, {0.0f, 1, 255, 0}, {0.0f, 3, 255, 0},
+  {142896.062f, 398, 18, 0}, {0.0f, 1, 255, 0}, {0.0f, 1, 255, 0}, {173.659988f, 401, 5, 0},
+  {0.0f, 0, 255, 0}, {0.0f, 1, 255, 0}, {0.0f, 1, 255, 0}, {19697.8242f, 417, 17, 0},
+  {146260.188f, 414, 18, 0}, {7605.63281f, 407, 19, 0}, {0.0f, 3, 255, 0}, {145732.969f, 409, 18, 0},
+  {0.0f, 3, 255, 0}, {17.8668175f, 411, 11, 0}, {0.0f, 1, 255, 0}, {138.205002f, 413, 5, 0},
+  {0.0f, 4, 255, 0}, {0.0f, 1, 255, 0}, {28.396122f, 416, 26, 0}, {0.0f, 4, 255, 0},
+  {0.0f, 3, 255, 0}, {146036.094f, 427, 18, 0}, {0.873915017f, 426, 23, 0}, {33.8151741f, 425, 25, 0},
+  {20.6732388f, 424, 27, 0}, {94.2850037f, 423, 13, 0}, {0.0f, 3, 255, 0}, {0.0f, 4, 255, 0},
+  {0.0f, 3, 255, 0}, {0.0f, 3, 255, 0}, {0.0f, 1, 255, 0}, {35.4568558f, 441, 1, 0},
+  {1344.57495f, 440, 3, 0}, {266.384125f, 431, 28, 0}, {0.0f, 3, 255, 0}, {20.2681828f, 439, 11, 0},
+  {20.6901951f, 434, 26, 0}, {0.0f, 3, 255, 0}, {1121.66614f, 438, 2, 0}, {1404.71741f, 437, 9, 0},
+  {0.0f, 1, 255, 0}, {0.0f, 4, 255, 0}, {0.0f, 4, 255, 0}, {0.0f, 3, 255, 0},
+  {0.0f, 3, 255, 0}, {0.0f, 3, 255, 0}, {1434.53491f, 446, 10, 0}, {8459.10254f, 445, 19, 0},
+  {0.0f, 4, 255, 0}, {0.0f, 1, 255, 0}, {1.85789704f, 448, 21, 0}, {0.0f, 4, 255, 0},
+  {0.0f, 5, 255, 0},
+};
+
+static const uint32_t FOREST_TREE_OFFSETS[1] = {
+  0,
+};
+
+static const Forest RANDOM_FOREST = {
+  FOREST_NODES, FOREST_TREE_OFFSETS, FOREST_NUM_TREES, FOREST_NUM_CLASSES
+};
+
+// Majority vote over all exported trees
+int classify_random_forest(const float* features) {
+  return forest_predict(RANDOM_FOREST, features);
 }
 
+// Same vote, reading features[k] only when a split needs it, so a provider
+// with operator[] can compute features on first use
+template <typename Features>
+int classify_random_forest_lazy(Features& features) {
+  return forest_predict(RANDOM_FOREST, features);
 }
 
 #endif  // RANDOM_FOREST_MODEL_H
@@ -0,0 +1,195 @@
+// Adaptive sample and inference rate for the detectors
+// Once the classifier has reported IDLE for settle_ms, the sample timer drops
+// to full_hz / divider and nothing is classified: only a cheap activity
+// detector runs, over blocks of samples. A block whose variance or
+// first-difference energy rises past RATE_TRIP_RATIO times the IDLE
+// baseline, or whose mean moves, puts the timer back to full rate at once.
+// So does probe_ms at the low rate, so an activity the detector cannot see
+// is still classified within a probe.
+//
+// The detector always sees the same series: every divider-th sample at full
+// rate, every sample at the low rate, chosen by timestamp. Its IDLE baseline
+// is learned at full rate from blocks the classifier called IDLE, so it
+// compares like with like. The classifier only ever sees full-rate samples:
+// add_sample() says which samples to extract, and full_samples() how many
+// have gone in since the rate came back up, so the sketch classifies only
+// windows with no low-rate or missing samples in them.
+
+#ifndef RATE_CONTROLLER_H
+#define RATE_CONTROLLER_H
+
+#include <math.h>
+#include <stdint.h>
+#include "sample_source.h"
+
+#define RATE_BLOCK 48           // Detector samples per block (0.96 s at 50 Hz)
+#define RATE_BASELINE_BLOCKS 8  // IDLE blocks learned before the first drop
+#define RATE_TRIP_RATIO 1.7f    // Block variance or diff energy over baseline
+#define RATE_TRIP_SIGMAS 5.0f   // Block mean shift, in standard errors
+
+class RateController {
+public:
+  RateController(uint32_t full_hz, uint8_t divider, uint32_t settle_ms, uint32_t probe_ms)
+    : full_hz(full_hz), divider(divider), settle_us(settle_ms * 1000), probe_us(probe_ms * 1000),
+      full_period_us(1000000 / full_hz), low_period_us(1000000 / full_hz * divider) {}
+
+  // Every sample the source delivers, at either rate. True if it was taken
+  // at full rate and belongs to the classifier.
+  bool add_sample(const Sample& s) {
+    now_us = s.t_us;
+    if (!viewed || s.t_us - view_last_us >= low_period_us - full_period_us / 2) {
+      viewed = true;
+      view_last_us = s.t_us;
+      observe(s.adc);
+    }
+    if (low) {
+      if (s.t_us - low_since_us >= probe_us) resume(false);
+      return false;
+    }
+    // Samples the timer took before it sped back up are still low rate
+    if (speeding_up || (int32_t)(s.t_us - full_from_us) < 0) return false;
+    full_samples_++;
+    if (idle && s.t_us - idle_since_us >= settle_us && baseline_blocks >= RATE_BASELINE_BLOCKS) drop();
+    return true;
+  }
+
+  // The decoded activity after each classified window
+  void add_window(uint8_t activity) {
+    if (activity) {
+      idle = false;
+    } else if (!idle) {
+      idle = true;
+      idle_since_us = now_us;
+    }
+  }
+
+  // A rate change for the sample source, once: set the timer to rate_hz(),
+  // then call rate_applied()
+  bool take_change() {
+    bool c = changed;
+    changed = false;
+    return c;
+  }
+
+  void rate_applied(uint32_t t_us) {
+    if (!speeding_up) return;
+    speeding_up = false;
+    full_from_us = t_us;
+  }
+
+  bool is_low() const { return low; }
+  uint32_t rate_hz() const { return low ? full_hz / divider : full_hz; }
+  uint32_t full_samples() const { return full_samples_; }
+  bool tripped() const { return last_tripped; }  // The last return was a trip
+
+  // Time at the low rate since boot, as of the last sample
+  uint32_t low_ms() const { return (low_us + (low ? now_us - low_since_us : 0)) / 1000; }
+
+  uint32_t drops = 0;    // Full to low
+  uint32_t trips = 0;    // Back to full on the detector
+  uint32_t probes = 0;   // ... or on probe_ms
+
+private:
+  void observe(uint16_t adc) {
+    uint32_t x = adc;
+    if (block_n) {
+      int32_t d = (int32_t)x - (int32_t)block_last;
+      diff_sq += (uint32_t)(d * d);
+    }
+    block_last = x;
+    sum += x;
+    sum_sq += x * x;
+    if (++block_n < RATE_BLOCK) return;
+
+    float mean = (float)sum / block_n;
+    float var = (float)((int64_t)block_n * sum_sq - (int64_t)sum * sum) / (block_n * (block_n - 1));
+    float diff = (float)diff_sq / (block_n - 1);
+    block_n = 0;
+    sum = sum_sq = diff_sq = 0;
+
+    bool active = baseline_blocks >= RATE_BASELINE_BLOCKS && exceeds(mean, var, diff);
+    if (low) {
+      if (active) {
+        trips++;
+        resume(true);
+      }
+      return;
+    }
+    // The decoder lags the activity: a block that would trip restarts the
+    // settle time and is not learned as IDLE
+    if (active) idle_since_us = now_us;
+    if (!idle || active) return;
+    // At least one ADC step of noise, so a flat line can still trip
+    if (var < 1) var = 1;
+    if (diff < 1) diff = 1;
+    if (!baseline_blocks++) {
+      base_mean = mean;
+      base_var = var;
+      base_diff = diff;
+      return;
+    }
+    base_mean += (mean - base_mean) / 8;
+    base_var += (var - base_var) / 8;
+    base_diff += (diff - base_diff) / 8;
+  }
+
+  bool exceeds(float mean, float var, float diff) const {
+    float shift = fabsf(mean - base_mean);
+    return var > RATE_TRIP_RATIO * base_var || diff > RATE_TRIP_RATIO * base_diff ||
+           shift * shift > RATE_TRIP_SIGMAS * RATE_TRIP_SIGMAS * base_var / RATE_BLOCK;
+  }
+
+  void drop() {
+    low = true;
+    changed = true;
+    drops++;
+    low_since_us = now_us;
+  }
+
+  void resume(bool tripped) {
+    low = false;
+    changed = true;
+    probes += !tripped;
+    last_tripped = tripped;
+    low_us += now_us - low_since_us;
+    full_samples_ = 0;
+    idle_since_us = now_us;
+    speeding_up = true;  // Until rate_applied()
+  }
+
+  uint32_t full_hz;
+  uint8_t divider;
+  uint32_t settle_us;
+  uint32_t probe_us;
+  uint32_t full_period_us;
+  uint32_t low_period_us;
+
+  bool low = false;
+  bool changed = false;
+  bool speeding_up = false;
+  bool last_tripped = false;
+  bool idle = false;
+  uint32_t now_us = 0;
+  uint32_t idle_since_us = 0;
+  uint32_t low_since_us = 0;
+  uint32_t full_from_us = 0;
+  uint32_t full_samples_ = 0;
+  uint64_t low_us = 0;
+
+  // Detector series and the block being filled
+  bool viewed = false;
+  uint32_t view_last_us = 0;
+  uint32_t block_n = 0;
+  uint32_t block_last = 0;
+  uint32_t sum = 0;
+  uint32_t sum_sq = 0;
+  uint32_t diff_sq = 0;
+
+  // IDLE baseline: slow averages over IDLE blocks at full rate
+  uint32_t baseline_blocks = 0;
+  float base_mean = 0;
+  float base_var = 0;
+  float base_diff = 0;
+};
+
+#endif  // RATE_CONTROLLER_H
@@ -0,0 +1,82 @@
+// Retained-mode layer over U8g2's full-buffer SH1106 driver
+// The sketch still clears and redraws its whole layout into u8g2's buffer,
+// which costs only RAM. flush() compares each 8-row page with a copy of what
+// the panel already shows and sends only the runs of dirty 8-column tiles in
+// each, so new latency digits cost a few dozen bytes on the I2C bus instead
+// of a 1 KB frame. due() paces frames on their own clock, whatever the
+// inference rate.
+
+#ifndef RETAINED_DISPLAY_H
+#define RETAINED_DISPLAY_H
+
+#include <Arduino.h>
+#include <U8g2lib.h>
+#include <string.h>
+
+#define OLED_WIDTH 128
+#define OLED_PAGES 8
+#define OLED_TILES (OLED_WIDTH / 8)
+#define OLED_PAGE_OVERHEAD 8   // I2C address, control bytes, page and column commands
+#define OLED_FRAME_BYTES (OLED_PAGES * (OLED_WIDTH + OLED_PAGE_OVERHEAD))
+
+class RetainedDisplay {
+public:
+  RetainedDisplay(U8G2& u8g2, uint16_t frame_ms) : u8g2(u8g2), frame_ms(frame_ms) {}
+
+  // At least frame_ms since the last flush: redraw and flush now
+  bool due(unsigned long now_ms) const {
+    return !frames || now_ms - last_frame_ms >= frame_ms;
+  }
+
+  // Sends what changed since the last flush; returns the bytes on the wire
+  uint32_t flush(unsigned long now_ms) {
+    const uint8_t* buf = u8g2.getBufferPtr();
+    uint32_t bytes = 0;
+    for (int page = 0; page < OLED_PAGES; page++) {
+      const uint8_t* row = buf + page * OLED_WIDTH;
+      uint8_t* old = shown + page * OLED_WIDTH;
+      bool dirty[OLED_TILES];
+      for (int t = 0; t < OLED_TILES; t++) dirty[t] = !valid || memcmp(row + t * 8, old + t * 8, 8);
+      // One transfer per run of dirty tiles; a single clean tile between two
+      // runs costs no more to resend than a second transfer's overhead
+      for (int t = 0; t < OLED_TILES;) {
+        if (!dirty[t]) {
+          t++;
+          continue;
+        }
+        int end = t + 1;
+        while (end < OLED_TILES && (dirty[end] || (end + 1 < OLED_TILES && dirty[end + 1]))) end++;
+        u8g2.updateDisplayArea(t, page, end - t, 1);
+        memcpy(old + t * 8, row + t * 8, (end - t) * 8);
+        bytes += OLED_PAGE_OVERHEAD + (end - t) * 8;
+        transfers++;
+        t = end;
+      }
+    }
+    valid = true;
+    last_frame_ms = now_ms;
+    frames++;
+    last_bytes = bytes;
+    total_bytes += bytes;
+    return bytes;
+  }
+
+  // The next flush sends every page, e.g. after something else drew
+  void invalidate() { valid = false; }
+
+  uint32_t frames = 0;
+  uint32_t transfers = 0;    // Runs of tiles sent
+  uint32_t last_bytes = 0;
+  uint64_t total_bytes = 0;
+
+  uint32_t avg_bytes() const { return frames ? (uint32_t)(total_bytes / frames) : 0; }
+
+private:
+  U8G2& u8g2;
+  uint16_t frame_ms;
+  unsigned long last_frame_ms = 0;
+  bool valid = false;
+  uint8_t shown[OLED_PAGES * OLED_WIDTH];
+};
+
+#endif  // RETAINED_DISPLAY_H
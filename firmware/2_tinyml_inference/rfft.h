@@ -0,0 +1,156 @@
+// Real-input FFT for non-power-of-two windows (N = 100 at 200 Hz)
+// The N-point real transform runs as one N/2-point complex mixed-radix FFT
+// plus a split step. Twiddles are computed at compile time and all buffers
+// live in the object, so a transform never allocates.
+
+#ifndef RFFT_H
+#define RFFT_H
+
+#include <math.h>
+
+namespace rfft_detail {
+
+constexpr double kPi = 3.14159265358979323846;
+
+// Taylor series after reduction to [-pi, pi]; exact to double precision
+constexpr double const_sin(double x) {
+  while (x > kPi) x -= 2 * kPi;
+  while (x < -kPi) x += 2 * kPi;
+  double term = x, sum = x;
+  for (int i = 1; i < 20; i++) {
+    term *= -x * x / ((2 * i) * (2 * i + 1));
+    sum += term;
+  }
+  return sum;
+}
+
+constexpr double const_cos(double x) {
+  return const_sin(x + kPi / 2);
+}
+
+// e^(-2*pi*i*k/N) for k in [0, N)
+template <int N>
+struct Twiddles {
+  float re[N];
+  float im[N];
+  constexpr Twiddles() : re(), im() {
+    for (int k = 0; k < N; k++) {
+      re[k] = (float)const_cos(2 * kPi * k / N);
+      im[k] = (float)-const_sin(2 * kPi * k / N);
+    }
+  }
+};
+
+// Radix schedule for the complex stage, preferring 4, then small primes
+template <int M>
+struct Factors {
+  int radix[32];
+  int count;
+  constexpr Factors() : radix(), count(0) {
+    int n = M;
+    while (n % 4 == 0) { radix[count++] = 4; n /= 4; }
+    for (int p = 2; n > 1; p++) {
+      while (n % p == 0) { radix[count++] = p; n /= p; }
+    }
+  }
+};
+
+}  // namespace rfft_detail
+
+template <int N>
+class RealFFT {
+  static_assert(N % 2 == 0, "RealFFT needs an even length");
+  static constexpr int M = N / 2;  // Complex FFT length
+
+public:
+  // |X[k]| for k in [0, N/2), matching np.abs(np.fft.fft(x)[:N//2])
+  void magnitudes(const float* x, float* mag) {
+    transform(x);
+    for (int k = 0; k < M; k++) {
+      mag[k] = sqrtf(out_re[k] * out_re[k] + out_im[k] * out_im[k]);
+    }
+  }
+
+  // Full half spectrum, for callers that need phase as well
+  void transform(const float* x) {
+    // Pack even/odd samples as one complex sequence of length N/2
+    for (int n = 0; n < M; n++) {
+      a_re[n] = x[2 * n];
+      a_im[n] = x[2 * n + 1];
+    }
+    float* re = complex_fft();
+    float* im = re == a_re ? a_im : b_im;
+
+    // Split step: separate the spectra of the even and odd samples
+    for (int k = 0; k < M; k++) {
+      int j = k == 0 ? 0 : M - k;
+      float er = 0.5f * (re[k] + re[j]);
+      float ei = 0.5f * (im[k] - im[j]);
+      float orr = 0.5f * (im[k] + im[j]);
+      float oi = -0.5f * (re[k] - re[j]);
+      float wr = kTwiddles.re[k], wi = kTwiddles.im[k];
+      out_re[k] = er + wr * orr - wi * oi;
+      out_im[k] = ei + wr * oi + wi * orr;
+    }
+  }
+
+  const float* real() const { return out_re; }
+  const float* imag() const { return out_im; }
+
+private:
+  // Stockham autosort, decimation in frequency: natural order in and out,
+  // ping-ponging between the a/b buffers. Returns the buffer holding the result.
+  float* complex_fft() {
+    float *src_re = a_re, *src_im = a_im, *dst_re = b_re, *dst_im = b_im;
+    int n = M, s = 1;
+
+    for (int f = 0; f < kFactors.count; f++) {
+      int p = kFactors.radix[f];
+      int m = n / p;
+      int tw_step = N / n;  // Twiddle table is over N, this stage is over n
+      int dft_step = N / p;
+
+      for (int j = 0; j < m; j++) {
+        for (int k = 0; k < s; k++) {
+          const float* in_re = &src_re[k + s * j];
+          const float* in_im = &src_im[k + s * j];
+          int widx = 0;
+          for (int r = 0; r < p; r++) {
+            // r-th output of the p-point DFT over the strided inputs
+            float acc_re = 0, acc_im = 0;
+            int idx = 0, idx_step = r * dft_step;
+            for (int q = 0; q < p; q++) {
+              float xr = in_re[s * m * q];
+              float xi = in_im[s * m * q];
+              acc_re += xr * kTwiddles.re[idx] - xi * kTwiddles.im[idx];
+              acc_im += xr * kTwiddles.im[idx] + xi * kTwiddles.re[idx];
+              idx += idx_step;
+              if (idx >= N) idx -= N;
+            }
+            float wr = kTwiddles.re[widx], wi = kTwiddles.im[widx];
+            dst_re[k + s * (p * j + r)] = acc_re * wr - acc_im * wi;
+            dst_im[k + s * (p * j + r)] = acc_re * wi + acc_im * wr;
+            widx += j * tw_step;
+            if (widx >= N) widx -= N;
+          }
+        }
+      }
+
+      float* t;
+      t = src_re; src_re = dst_re; dst_re = t;
+      t = src_im; src_im = dst_im; dst_im = t;
+      n = m;
+      s *= p;
+    }
+    return src_re;
+  }
+
+  static constexpr rfft_detail::Twiddles<N> kTwiddles{};
+  static constexpr rfft_detail::Factors<M> kFactors{};
+
+  float a_re[M], a_im[M];
+  float b_re[M], b_im[M];
+  float out_re[M], out_im[M];
+};
+
+#endif  // RFFT_H
@@ -0,0 +1,48 @@
+// Acquisition layer between the ADC and the detector's consumer loop
+// A producer (timer-driven task on the board, replay thread on the host) pushes
+// timestamped samples into a lock-free ring at a fixed rate; loop() drains
+// it whenever it gets round to it, so a slow inference, display refresh or
+// mitigation burst delays samples instead of dropping them.
+
+#ifndef SAMPLE_SOURCE_H
+#define SAMPLE_SOURCE_H
+
+#include <stdint.h>
+#include "spsc_queue.h"
+
+struct Sample {
+  uint32_t t_us;   // micros() at the sample tick
+  uint16_t adc;    // Raw 12-bit count
+};
+
+// The ISR-to-loop ring: N samples, a power of two. A full ring refuses the
+// sample and counts an overrun.
+template <int N>
+using SampleRing = SpscQueue<Sample, N>;
+
+// Where the detector's samples come from. begin() starts acquisition at
+// rate_hz; read() returns the oldest pending sample, false when none is.
+class SampleSource {
+public:
+  virtual ~SampleSource() {}
+  virtual bool begin(uint32_t rate_hz) = 0;
+  virtual void end() {}
+  virtual bool read(Sample& s) = 0;
+  virtual int pending() const = 0;
+  virtual uint32_t dropped() const = 0;   // Lost to a full ring since boot
+};
+
+// A source whose producer fills a SampleRing<N>
+template <int N>
+class RingSampleSource : public SampleSource {
+public:
+  bool read(Sample& s) override { return ring.pop(s); }
+  int pending() const override { return ring.size(); }
+  uint32_t dropped() const override { return ring.dropped(); }
+  int max_pending() const { return ring.max_size(); }   // Deepest backlog read() saw
+
+protected:
+  SampleRing<N> ring;
+};
+
+#endif  // SAMPLE_SOURCE_H
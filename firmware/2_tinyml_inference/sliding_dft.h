@@ -0,0 +1,78 @@
+// Streaming spectrum: a sliding DFT updated on every sample
+// Spreads the spectral work evenly over the 5 ms sample slots instead of
+// running a whole FFT in the slot where the window (or hop) completes.
+
+#ifndef SLIDING_DFT_H
+#define SLIDING_DFT_H
+
+#include <stdint.h>
+#include <math.h>
+#include "rfft.h"
+#include "streaming_stats.h"
+
+namespace sdft_detail {
+
+// cos/-sin of 2*pi*k/N in Q30
+template <int N>
+struct FixedTwiddles {
+  int32_t re[N];
+  int32_t im[N];
+  constexpr FixedTwiddles() : re(), im() {
+    for (int k = 0; k < N; k++) {
+      double angle = 2 * rfft_detail::kPi * k / N;
+      re[k] = (int32_t)(rfft_detail::const_cos(angle) * (1 << 30));
+      im[k] = (int32_t)(-rfft_detail::const_sin(angle) * (1 << 30));
+    }
+  }
+};
+
+}  // namespace sdft_detail
+
+// Tracks bins [0, BINS) of an N-sample window of fixed-point samples.
+//
+// Each bin accumulates x[m] * e^(-2*pi*i*k*(m mod N)/N) over the absolute
+// sample index m rather than the position in the window. A new sample and
+// the one it evicts share (m mod N), so an update is a single multiply-add
+// of their difference per bin, and |A_k| equals the window's |X_k| because
+// re-anchoring the phase only rotates it. Accumulators are 64-bit integers,
+// so evictions cancel exactly and the state never drifts, unlike the usual
+// recursive SDFT that multiplies the state by a rounded twiddle each step.
+template <int N, int BINS>
+class SlidingDFT {
+  static_assert(BINS <= N, "SlidingDFT tracks at most N bins");
+
+public:
+  // x_old is the sample leaving the window (0 while it is still filling)
+  void update(int32_t x_new, int32_t x_old) {
+    int32_t delta = x_new - x_old;
+    if (delta != 0) {
+      int idx = 0;
+      for (int k = 0; k < BINS; k++) {
+        acc_re[k] += (int64_t)delta * kTwiddles.re[idx];
+        acc_im[k] += (int64_t)delta * kTwiddles.im[idx];
+        idx += phase;
+        if (idx >= N) idx -= N;
+      }
+    }
+    if (++phase == N) phase = 0;
+  }
+
+  // |X[k]| in millivolts, matching np.abs(np.fft.fft(window))[:BINS]
+  void magnitudes(float* mag) const {
+    const float scale = 1.0f / ((float)(1 << 30) * FIXED_ONE);
+    for (int k = 0; k < BINS; k++) {
+      float re = acc_re[k] * scale;
+      float im = acc_im[k] * scale;
+      mag[k] = sqrtf(re * re + im * im);
+    }
+  }
+
+private:
+  static constexpr sdft_detail::FixedTwiddles<N> kTwiddles{};
+
+  int64_t acc_re[BINS] = {};
+  int64_t acc_im[BINS] = {};
+  int phase = 0;  // Absolute sample index mod N
+};
+
+#endif  // SLIDING_DFT_H
@@ -0,0 +1,63 @@
+// Frequency-domain features 14-23 from a magnitude spectrum
+// Order and definitions follow FeatureExtractor.extract_frequency_domain()
+// in ml_training_pipeline.py, which the shipped models were trained on.
+
+#ifndef SPECTRAL_FEATURES_H
+#define SPECTRAL_FEATURES_H
+
+#include <math.h>
+
+#define NUM_SPECTRAL_FEATURES 10
+#define SPECTRAL_LOW_BINS 10   // fft_mag[:10]
+#define SPECTRAL_MID_BINS 50   // fft_mag[10:50], the rest is "high"
+#define SPECTRAL_ROLLOFF 0.85f
+
+// mag holds |X[k]| for k in [0, bins); out receives 10 features:
+// dominant bin, peak, mean, std, low/mid/high band sums, centroid,
+// 85% rolloff bin and spectral entropy (bits)
+inline void extract_spectral_features(const float* mag, int bins, float* out) {
+  int dominant = 0;
+  float total = 0, weighted = 0, sum_sq = 0;
+  float low = 0, mid = 0, high = 0;
+
+  for (int k = 0; k < bins; k++) {
+    float m = mag[k];
+    if (m > mag[dominant]) dominant = k;
+    total += m;
+    weighted += k * m;
+    sum_sq += m * m;
+    if (k < SPECTRAL_LOW_BINS) low += m;
+    else if (k < SPECTRAL_MID_BINS) mid += m;
+    else high += m;
+  }
+
+  float mean = total / bins;
+  float var = sum_sq / bins - mean * mean;
+
+  int rolloff = 0;
+  float entropy = 0;
+  if (total > 0) {
+    float cumulative = 0;
+    rolloff = -1;
+    for (int k = 0; k < bins; k++) {
+      cumulative += mag[k];
+      if (rolloff < 0 && cumulative >= SPECTRAL_ROLLOFF * total) rolloff = k;
+      float p = mag[k] / total;
+      entropy -= p * log2f(p + 1e-10f);
+    }
+    if (rolloff < 0) rolloff = bins - 1;
+  }
+
+  out[0] = dominant;
+  out[1] = mag[dominant];
+  out[2] = mean;
+  out[3] = var > 0 ? sqrtf(var) : 0;
+  out[4] = low;
+  out[5] = mid;
+  out[6] = high;
+  out[7] = total > 0 ? weighted / total : 0;
+  out[8] = rolloff;
+  out[9] = entropy;
+}
+
+#endif  // SPECTRAL_FEATURES_H
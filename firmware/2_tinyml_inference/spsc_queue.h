@@ -0,0 +1,68 @@
+// Lock-free single-producer single-consumer queue for handing work between
+// an ISR, the two ESP32 cores, or host threads
+// head and tail are free-running counters: the producer owns head, the
+// consumer tail, and each publishes with release and reads the other's with
+// acquire, so neither side ever takes a lock or disables interrupts.
+
+#ifndef SPSC_QUEUE_H
+#define SPSC_QUEUE_H
+
+#include <stdint.h>
+#include <atomic>
+
+// N entries, a power of two. A full queue refuses the push and counts it.
+template <typename T, int N>
+class SpscQueue {
+  static_assert(N > 1 && (N & (N - 1)) == 0, "SpscQueue size must be a power of two");
+
+public:
+  // Producer side
+  bool push(const T& item) {
+    uint32_t h = head.load(std::memory_order_relaxed);
+    if (h - tail.load(std::memory_order_acquire) == (uint32_t)N) {
+      drop();
+      return false;
+    }
+    buf[h & (N - 1)] = item;
+    head.store(h + 1, std::memory_order_release);
+    return true;
+  }
+
+  bool full() const {
+    return head.load(std::memory_order_relaxed) - tail.load(std::memory_order_acquire) == (uint32_t)N;
+  }
+
+  // Producer side: an item the producer gave up on before pushing
+  void drop() {
+    overruns.store(overruns.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+  }
+
+  // Consumer side
+  bool pop(T& item) {
+    uint32_t t = tail.load(std::memory_order_relaxed);
+    uint32_t h = head.load(std::memory_order_acquire);
+    if (h == t) return false;
+    if (h - t > high_water) high_water = h - t;
+    item = buf[t & (N - 1)];
+    tail.store(t + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Items waiting; exact from the consumer, a snapshot from anywhere else
+  int size() const {
+    return (int)(head.load(std::memory_order_acquire) - tail.load(std::memory_order_relaxed));
+  }
+
+  static constexpr int capacity() { return N; }
+  uint32_t dropped() const { return overruns.load(std::memory_order_relaxed); }
+  int max_size() const { return (int)high_water; }  // Deepest queue pop() saw; consumer side
+
+private:
+  T buf[N];
+  std::atomic<uint32_t> head{0};
+  std::atomic<uint32_t> tail{0};
+  std::atomic<uint32_t> overruns{0};
+  uint32_t high_water = 0;
+};
+
+#endif  // SPSC_QUEUE_H
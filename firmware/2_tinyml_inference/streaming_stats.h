@@ -0,0 +1,112 @@
+// Incremental sliding-window statistics for the streaming feature extractor
+// Every accumulator is an integer, so removing a sample undoes adding it
+// exactly and the running state never drifts however long the device runs.
+
+#ifndef STREAMING_STATS_H
+#define STREAMING_STATS_H
+
+#include <stdint.h>
+#include <math.h>
+
+// Samples are held as fixed-point millivolts (1/256 mV per LSB). The 12-bit
+// ADC resolves ~0.8 mV, so nothing is lost and sums of squares stay exact.
+#define FIXED_SHIFT 8
+#define FIXED_ONE (1 << FIXED_SHIFT)
+
+inline int32_t to_fixed(float mv) {
+  return (int32_t)lroundf(mv * FIXED_ONE);
+}
+
+inline float from_fixed(int32_t q) {
+  return q / (float)FIXED_ONE;
+}
+
+inline int32_t abs_fixed(int32_t q) {
+  return q < 0 ? -q : q;
+}
+
+// Running count, sum and sum of squares. n*S2 - S1^2 is exact in 64 bits for
+// windows up to ~3000 samples, so the variance has no cancellation error.
+class SlidingMoments {
+public:
+  void add(int32_t x) {
+    n++;
+    sum += x;
+    sum_sq += (int64_t)x * x;
+  }
+
+  void remove(int32_t x) {
+    n--;
+    sum -= x;
+    sum_sq -= (int64_t)x * x;
+  }
+
+  int count() const { return n; }
+
+  float mean() const {
+    if (n == 0) return 0;
+    return (float)sum / ((float)n * FIXED_ONE);
+  }
+
+  float variance() const {
+    if (n == 0) return 0;
+    int64_t num = (int64_t)n * sum_sq - sum * sum;
+    return (float)num / ((float)n * n * FIXED_ONE * FIXED_ONE);
+  }
+
+private:
+  int n = 0;
+  int64_t sum = 0;
+  int64_t sum_sq = 0;
+};
+
+// Sliding maximum (kMax) or minimum over the last N pushes. A monotonic deque
+// gives amortised O(1) per sample instead of rescanning the window.
+// Indices are absolute sample counters; unsigned wrap-around is harmless.
+template <int N, bool kMax>
+class MonotonicDeque {
+public:
+  void push(uint32_t idx, int32_t v) {
+    // Expire first so the ring never holds more than N entries
+    while (size > 0 && idx - idxs[head] >= (uint32_t)N) {
+      head = (head + 1) % N;
+      size--;
+    }
+    while (size > 0 && !keeps(vals[slot(size - 1)], v)) size--;
+
+    idxs[slot(size)] = idx;
+    vals[slot(size)] = v;
+    size++;
+  }
+
+  int32_t top() const { return vals[head]; }
+
+  // Top of the last `span` pushes only (span <= N). Entries run oldest to
+  // newest and the newest is always kept, so it is the first entry young
+  // enough: every later sample that evicted an older winner is in the span.
+  int32_t top_within(int span) const {
+    uint32_t newest = idxs[slot(size - 1)];
+    int lo = 0, hi = size - 1;
+    while (lo < hi) {
+      int mid = (lo + hi) / 2;
+      if (newest - idxs[slot(mid)] >= (uint32_t)span) lo = mid + 1;
+      else hi = mid;
+    }
+    return vals[slot(lo)];
+  }
+
+private:
+  int slot(int i) const { return (head + i) % N; }
+
+  // An older entry survives only if it beats the newcomer strictly
+  static bool keeps(int32_t older, int32_t newer) {
+    return kMax ? older > newer : older < newer;
+  }
+
+  uint32_t idxs[N];
+  int32_t vals[N];
+  int head = 0;
+  int size = 0;
+};
+
+#endif  // STREAMING_STATS_H
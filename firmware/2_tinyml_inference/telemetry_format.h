@@ -0,0 +1,272 @@
+// Binary inference telemetry: record layouts, framing and text rendering,
+// shared by the RF detector (telemetry_log.h) and the host decoder
+// (firmware/host/telemetry_decode.cpp).
+//
+// Frames are as in 1_data_collection/capture_protocol.h: the payload and its
+// CRC-32, COBS-encoded between 0x00 delimiters, so the host resynchronizes
+// after corruption and skips text printed between frames. Sketch folders
+// cannot share headers, hence the framing helpers are repeated here.
+//
+// Payloads, little-endian; every type but LOG_INFO has a fixed size:
+//   LOG_INFO        type, version, features u8, classes u8, NUL-terminated names
+//   LOG_INFERENCE   type, seq u32, class u8, activity u8, confidence u8,
+//                   computed u8, latency_us u32, avg_latency_us u32,
+//                   avg_computed_x10 u16
+//   LOG_STATS       type, seq u32, mean f32, std f32, range f32, fft_peak f32,
+//                   avg_cycles u32, sample_backlog u16, sample_ring u16,
+//                   samples_dropped u32, detection_backlog u16,
+//                   detection_queue u16, detections_dropped u32,
+//                   avg_us u32 and max_us u32 for each of the ring, classify,
+//                   queue, act and display stages, display_frames u32,
+//                   display_last u16, display_avg u16, display_full u16,
+//                   mitigation_patterns u32, mitigation_pulses u32,
+//                   log_dropped u32, class_changes u32, activity_changes u32,
+//                   decoder_votes u8, decoder_windows u8, early_exits u32,
+//                   full_hz u16, low_hz u16, low_rate_ms u32, rate_drops u16,
+//                   rate_trips u16, rate_probes u16
+//   LOG_MITIGATION  type, seq u32, activity u8, confidence u8, lag_ms u16
+// seq is the inference the record belongs to. class is the forest's vote for
+// that window, activity what the temporal decoder makes of recent votes,
+// with the percent of them that agree. lag_ms is how long after the activity
+// began the decoder settled on it. log_dropped counts records the ring had no
+// room for since boot. low_rate_ms is the time spent sampling at low_hz
+// (rate_controller.h); full_hz == low_hz when the rate is fixed.
+
+#ifndef TELEMETRY_FORMAT_H
+#define TELEMETRY_FORMAT_H
+
+#include <stdarg.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+
+#define TELEMETRY_VERSION 4
+
+#define LOG_INFO 0x11
+#define LOG_INFERENCE 0x12
+#define LOG_STATS 0x13
+#define LOG_MITIGATION 0x14
+
+#define LOG_INFERENCE_BYTES 19
+#define LOG_STATS_BYTES 131
+#define LOG_MITIGATION_BYTES 9
+#define LOG_STAGES 5
+#define LOG_STATS_LOG_DROPPED 99   // Offset of log_dropped
+
+#define LOG_MAX_PAYLOAD 136
+#define LOG_CRC_BYTES 4
+#define LOG_MAX_WIRE (LOG_MAX_PAYLOAD + LOG_CRC_BYTES + (LOG_MAX_PAYLOAD + LOG_CRC_BYTES) / 254 + 3)
+#define LOG_TEXT_MAX 640
+
+// Levels, each including the ones below
+enum LogLevel : uint8_t {
+  LEVEL_OFF,
+  LEVEL_EVENTS,       // Mitigation
+  LEVEL_INFERENCES,   // A line per inference
+  LEVEL_STATS,        // Features, queues, latencies every 10th inference
+};
+
+static const char* const LOG_STAGE_NAMES[LOG_STAGES] = {"ring", "classify", "queue", "act", "display"};
+
+// ============ RECORDS ============
+// A payload being built, appended field by field
+struct LogRecord {
+  uint8_t len = 0;
+  uint8_t payload[LOG_MAX_PAYLOAD + LOG_CRC_BYTES];
+
+  explicit LogRecord(uint8_t type = 0) {
+    if (type) u8(type);
+  }
+
+  LogRecord& u8(uint8_t v) {
+    if (len < LOG_MAX_PAYLOAD) payload[len++] = v;
+    return *this;
+  }
+  LogRecord& u16(uint16_t v) { return u8(v).u8(v >> 8); }
+  LogRecord& u32(uint32_t v) { return u16(v).u16(v >> 16); }
+  LogRecord& f32(float v) {
+    uint32_t bits;
+    memcpy(&bits, &v, 4);
+    return u32(bits);
+  }
+  LogRecord& str(const char* s) {
+    do u8(*s); while (*s++);
+    return *this;
+  }
+};
+
+// Reads fields back in the order they were appended
+struct LogReader {
+  const uint8_t* p;
+  size_t n;
+  size_t at = 0;
+
+  LogReader(const uint8_t* p, size_t n) : p(p), n(n) {}
+
+  uint8_t u8() { return at < n ? p[at++] : 0; }
+  uint16_t u16() {
+    uint16_t lo = u8();
+    return lo | (u8() << 8);
+  }
+  uint32_t u32() {
+    uint32_t lo = u16();
+    return lo | ((uint32_t)u16() << 16);
+  }
+  float f32() {
+    uint32_t bits = u32();
+    float v;
+    memcpy(&v, &bits, 4);
+    return v;
+  }
+};
+
+// ============ FRAMING ============
+// CRC-32 as zlib.crc32(), a nibble at a time
+inline uint32_t log_crc32(const uint8_t* p, size_t n) {
+  static const uint32_t kTable[16] = {
+    0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4,
+    0x4DB26158, 0x5005713C, 0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C,
+    0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C
+  };
+  uint32_t crc = 0xFFFFFFFF;
+  for (size_t i = 0; i < n; i++) {
+    crc ^= p[i];
+    crc = (crc >> 4) ^ kTable[crc & 15];
+    crc = (crc >> 4) ^ kTable[crc & 15];
+  }
+  return ~crc;
+}
+
+// Appends the CRC to the record, then writes the delimited COBS frame to
+// out (LOG_MAX_WIRE bytes); returns its length
+inline size_t log_frame(LogRecord& r, uint8_t* out) {
+  uint32_t crc = log_crc32(r.payload, r.len);
+  uint8_t n = r.len;
+  for (int i = 0; i < LOG_CRC_BYTES; i++) r.payload[n++] = crc >> (8 * i);
+
+  size_t code_at = 1, o = 2;
+  uint8_t code = 1;
+  out[0] = 0;
+  for (size_t i = 0; i < n; i++) {
+    if (r.payload[i]) {
+      out[o++] = r.payload[i];
+      code++;
+    }
+    if (!r.payload[i] || code == 0xFF) {
+      out[code_at] = code;
+      code_at = o++;
+      code = 1;
+    }
+  }
+  out[code_at] = code;
+  out[o++] = 0;
+  return o;
+}
+
+// Decodes the bytes between two delimiters into payload (n bytes); returns
+// the payload length without the CRC, or 0 if malformed or the CRC fails
+inline size_t log_unframe(const uint8_t* in, size_t n, uint8_t* payload) {
+  size_t i = 0, o = 0;
+  while (i < n) {
+    uint8_t code = in[i++];
+    if (!code || i + code - 1 > n) return 0;
+    for (int k = 1; k < code; k++) {
+      if (!in[i]) return 0;
+      payload[o++] = in[i++];
+    }
+    if (code != 0xFF && i < n) payload[o++] = 0;
+  }
+  if (o <= LOG_CRC_BYTES) return 0;
+  o -= LOG_CRC_BYTES;
+  uint32_t crc = payload[o] | (payload[o + 1] << 8) | (payload[o + 2] << 16) | ((uint32_t)payload[o + 3] << 24);
+  return crc == log_crc32(payload, o) ? o : 0;
+}
+
+// ============ TEXT ============
+// Appends to out (LOG_TEXT_MAX bytes), truncating
+inline void log_printf(char* out, size_t& len, const char* fmt, ...) {
+  if (len >= LOG_TEXT_MAX - 1) return;
+  va_list args;
+  va_start(args, fmt);
+  int n = vsnprintf(out + len, LOG_TEXT_MAX - len, fmt, args);
+  va_end(args);
+  if (n > 0) len = len + n < LOG_TEXT_MAX - 1 ? len + n : LOG_TEXT_MAX - 1;
+}
+
+// The detector's human-readable log for one record, into out (LOG_TEXT_MAX
+// bytes). names may be null until a LOG_INFO arrives. Returns the length,
+// or 0 for LOG_INFO and unknown or short records.
+inline size_t format_log_record(const uint8_t* p, size_t n, const char* const* names, int classes,
+                                int features, char* out) {
+  LogReader r(p, n);
+  size_t len = 0;
+  out[0] = 0;
+
+  switch (r.u8()) {
+    case LOG_INFERENCE: {
+      if (n != LOG_INFERENCE_BYTES) return 0;
+      uint32_t seq = r.u32();
+      int cls = r.u8(), activity = r.u8(), confidence = r.u8();
+      int computed = r.u8();
+      const char* name = names && cls < classes ? names[cls] : "?";
+      const char* activity_name = names && activity < classes ? names[activity] : "?";
+      uint32_t latency = r.u32(), avg = r.u32();
+      uint16_t avg_computed = r.u16();
+      log_printf(out, len, "#%u | %s %d%% (window: %s) | Latency: %.2f ms | Avg: %.2f ms | "
+                 "Features: %d/%d (avg %.1f)\n", (unsigned)seq, activity_name, confidence, name,
+                 latency / 1000.0, avg / 1000.0, computed, features, avg_computed / 10.0);
+      break;
+    }
+    case LOG_STATS: {
+      if (n != LOG_STATS_BYTES) return 0;
+      uint32_t seq = r.u32();
+      float mean = r.f32(), std = r.f32(), range = r.f32(), peak = r.f32();
+      log_printf(out, len, "   [Features] mean=%.1f std=%.1f range=%.1f fft_peak=%.1f\n",
+                 mean, std, range, peak);
+      log_printf(out, len, "   [Cycles] %u per window (avg)\n", (unsigned)r.u32());
+      unsigned backlog = r.u16(), ring = r.u16(), dropped = r.u32();
+      unsigned det_backlog = r.u16(), queue = r.u16(), det_dropped = r.u32();
+      log_printf(out, len, "   [Pipeline] samples backlog max %u/%u, dropped %u | "
+                 "detections backlog max %u/%u, dropped %u\n",
+                 backlog, ring, dropped, det_backlog, queue, det_dropped);
+      log_printf(out, len, "   [Latency ms avg/max]");
+      for (int s = 0; s < LOG_STAGES; s++) {
+        uint32_t avg = r.u32(), max = r.u32();
+        log_printf(out, len, " %s %.2f/%.2f", LOG_STAGE_NAMES[s], avg / 1000.0, max / 1000.0);
+      }
+      log_printf(out, len, "\n");
+      unsigned frames = r.u32(), last = r.u16(), avg = r.u16(), full = r.u16();
+      log_printf(out, len, "   [Display] %u frames, last %u B, avg %u B of %u B full frame\n",
+                 frames, last, avg, full);
+      unsigned patterns = r.u32(), pulses = r.u32();
+      log_printf(out, len, "   [Mitigation] %u patterns, %u pulses\n", patterns, pulses);
+      log_printf(out, len, "   [Log] %u records dropped\n", (unsigned)r.u32());
+      unsigned class_changes = r.u32(), activity_changes = r.u32();
+      unsigned votes = r.u8(), windows = r.u8();
+      log_printf(out, len, "   [Decoder] %u of %u class changes kept (%u of %u windows)\n",
+                 activity_changes, class_changes, votes, windows);
+      log_printf(out, len, "   [Cascade] %u of %u windows exited early\n", (unsigned)r.u32(), (unsigned)seq);
+      unsigned full_hz = r.u16(), low_hz = r.u16(), low_ms = r.u32();
+      unsigned drops = r.u16(), trips = r.u16(), probes = r.u16();
+      log_printf(out, len, "   [Rate] %u/%u Hz: %.1f s at %u Hz, %u drops, %u trips, %u probes\n",
+                 full_hz, low_hz, low_ms / 1000.0, low_hz, drops, trips, probes);
+      break;
+    }
+    case LOG_MITIGATION: {
+      if (n != LOG_MITIGATION_BYTES) return 0;
+      r.u32();
+      int activity = r.u8(), confidence = r.u8();
+      unsigned lag_ms = r.u16();
+      const char* name = names && activity < classes ? names[activity] : "?";
+      log_printf(out, len, "⚠️  MITIGATION: %s side-channel detected! (%d%%, %u ms after onset)\n",
+                 name, confidence, lag_ms);
+      break;
+    }
+    default:
+      return 0;
+  }
+  return len;
+}
+
+#endif  // TELEMETRY_FORMAT_H
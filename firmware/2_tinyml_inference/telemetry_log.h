@@ -0,0 +1,68 @@
+// Asynchronous telemetry log for the RF detector
+// The act stage appends a few fields to a LogRecord and pushes it onto a
+// lock-free ring: no formatting and no waiting on the UART. A drainer task
+// frames records onto Serial only while the TX buffer has room for a whole
+// one, so it never blocks either. A full ring drops the record and counts it.
+// With binary off the drainer renders the records as the text the host
+// decoder prints, so both read the same (telemetry_format.h).
+
+#ifndef TELEMETRY_LOG_H
+#define TELEMETRY_LOG_H
+
+#include <Arduino.h>
+#include "spsc_queue.h"
+#include "telemetry_format.h"
+
+template <int N>
+class TelemetryLog {
+public:
+  TelemetryLog(const char* const* names, int classes, int features)
+    : names(names), classes(classes), features(features) {}
+
+  // Producer side
+  bool wants(uint8_t l) const { return level >= l; }
+
+  bool log(uint8_t l, const LogRecord& r) { return wants(l) && ring.push(r); }
+
+  // Also re-announces the class names, so a decoder that attached late
+  // picks them up
+  void set_level(uint8_t l) {
+    level = l;
+    LogRecord info(LOG_INFO);
+    info.u8(TELEMETRY_VERSION).u8(features).u8(classes);
+    for (int c = 0; c < classes; c++) info.str(names[c]);
+    ring.push(info);
+  }
+
+  uint32_t dropped() const { return ring.dropped(); }
+
+  // Consumer side: writes what fits in the TX buffer, whole records only
+  void drain(HardwareSerial& out, bool binary) {
+    for (;;) {
+      if (!pending) {
+        LogRecord r;
+        if (!ring.pop(r)) return;
+        if (binary) {
+          pending = log_frame(r, wire);
+        } else {
+          pending = format_log_record(r.payload, r.len, names, classes, features, (char*)wire);
+          if (!pending) continue;
+        }
+      }
+      if (out.availableForWrite() < (int)pending) return;
+      out.write(wire, pending);
+      pending = 0;
+    }
+  }
+
+private:
+  SpscQueue<LogRecord, N> ring;
+  volatile uint8_t level = LEVEL_STATS;
+  const char* const* names;
+  int classes;
+  int features;
+  uint8_t wire[LOG_TEXT_MAX > LOG_MAX_WIRE ? LOG_TEXT_MAX : LOG_MAX_WIRE];
+  size_t pending = 0;
+};
+
+#endif  // TELEMETRY_LOG_H
@@ -0,0 +1,72 @@
+// Temporal decoder over the classifier's per-window classes
+// One misclassified window used to be enough to fire a mitigation burst and
+// an alert. The decoder keeps the last N classes and moves to a new activity
+// only once it holds `votes` of them and more than the current activity
+// does, so a stray window is outvoted and a tie keeps what is shown
+// (hysteresis). Memory is N bytes plus a count per class, whatever the
+// uptime. host/decoder_replay picks N and votes from labelled windows.
+
+#ifndef TEMPORAL_DECODER_H
+#define TEMPORAL_DECODER_H
+
+#include <stdint.h>
+#include <string.h>
+
+#define DECODER_MAX_CLASSES 8
+
+template <int N>
+class TemporalDecoder {
+public:
+  // initial is the activity assumed at boot (IDLE)
+  explicit TemporalDecoder(uint8_t votes, uint8_t initial = 0) : votes(votes), activity(initial) {
+    memset(counts, 0, sizeof(counts));
+  }
+
+  // Feeds the next window's class; true when the decoded activity changes
+  bool update(uint8_t cls) {
+    if (cls >= DECODER_MAX_CLASSES) return false;
+    if (filled == N) counts[ring[at]]--;
+    else filled++;
+    ring[at] = cls;
+    at = (at + 1) % N;
+    counts[cls]++;
+    windows++;
+    raw_changes += windows > 1 && cls != last_cls;
+    last_cls = cls;
+
+    if (cls == activity || counts[cls] < votes || counts[cls] <= counts[activity]) return false;
+    activity = cls;
+    changes++;
+    // The new segment began at the oldest window in the ring voting for it
+    int oldest = 0;
+    while (ring[(at + oldest + N - filled) % N] != cls) oldest++;
+    lag = filled - 1 - oldest;
+    segment_start = windows - lag;
+    return true;
+  }
+
+  uint8_t current() const { return activity; }
+
+  // Share of the last N windows that voted for the current activity
+  uint8_t confidence_pct() const { return filled ? counts[activity] * 100 / filled : 0; }
+
+  uint8_t window_size() const { return N; }
+  uint8_t min_votes() const { return votes; }
+
+  uint32_t windows = 0;        // Classes fed
+  uint32_t raw_changes = 0;    // Window-to-window class changes fed
+  uint32_t changes = 0;        // Decoded activity changes
+  uint32_t segment_start = 0;  // Window (from 1) the current segment began at
+  uint16_t lag = 0;            // Windows between that and the change
+
+private:
+  uint8_t votes;
+  uint8_t activity;
+  uint8_t last_cls = 0;
+  uint8_t ring[N];
+  uint8_t counts[DECODER_MAX_CLASSES];
+  int at = 0;
+  int filled = 0;
+};
+
+#endif  // TEMPORAL_DECODER_H
@@ -0,0 +1,114 @@
+// ESP32 hardware-timer SampleSource for the detector sketches
+// A 1 MHz hardware timer fires at the sample rate, so the sample clock no
+// longer depends on how long loop() takes. analogRead() is not ISR-safe (it
+// takes the ADC lock and runs from flash), so the ISR only stamps micros()
+// and wakes a top-priority sampling task, which converts the pin into the
+// ring. When the ring is full the conversion is skipped and counted: loop()
+// has fallen a full ring behind and could not use it anyway. Ticks the task
+// could not get to before the next one are counted the same way.
+
+#ifndef TIMER_SAMPLE_SOURCE_H
+#define TIMER_SAMPLE_SOURCE_H
+
+#include <Arduino.h>
+#include "sample_source.h"
+
+#define SAMPLE_TIMER 0
+#define SAMPLE_TASK_PRIORITY (configMAX_PRIORITIES - 1)
+#define SAMPLE_TASK_CORE 1   // loop()'s, where the timer ISR is attached
+
+template <int N>
+class TimerSampleSource : public RingSampleSource<N> {
+public:
+  explicit TimerSampleSource(uint8_t pin) : pin(pin) {}
+
+  bool begin(uint32_t rate_hz) override {
+    instance = this;
+    if (!sample_task &&
+        xTaskCreatePinnedToCore(sample_loop, "sample", 2048, this, SAMPLE_TASK_PRIORITY,
+                                &sample_task, SAMPLE_TASK_CORE) != pdPASS) {
+      sample_task = nullptr;
+      return false;
+    }
+#if ESP_ARDUINO_VERSION_MAJOR >= 3
+    timer = timerBegin(1000000);
+    if (!timer) return false;
+    timerAttachInterrupt(timer, on_timer);
+    timerAlarm(timer, 1000000 / rate_hz, true, 0);
+#else
+    timer = timerBegin(SAMPLE_TIMER, 80, true);  // 80 MHz APB / 80
+    if (!timer) return false;
+    timerAttachInterrupt(timer, on_timer, true);
+    timerAlarmWrite(timer, 1000000 / rate_hz, true);
+    timerAlarmEnable(timer);
+#endif
+    return true;
+  }
+
+  // Changes the sample rate while running. The count restarts, so the next
+  // sample is one new period away even when the alarm moves below it.
+  void set_rate(uint32_t rate_hz) {
+    if (!timer) return;
+    timerWrite(timer, 0);
+#if ESP_ARDUINO_VERSION_MAJOR >= 3
+    timerAlarm(timer, 1000000 / rate_hz, true, 0);
+#else
+    timerAlarmWrite(timer, 1000000 / rate_hz, true);
+#endif
+  }
+
+  void end() override {
+    if (!timer) return;
+    timerEnd(timer);
+    timer = nullptr;
+  }
+
+  // Wake a task every `every` samples, e.g. once per hop, so a consumer on
+  // the other core can block instead of polling. Call before begin().
+  void notify(TaskHandle_t task, int every) {
+    notify_task = task;
+    notify_every = every;
+  }
+
+private:
+  // Nothing here touches the ADC or flash
+  static void IRAM_ATTR on_timer() {
+    TimerSampleSource* self = instance;
+    self->tick_us = micros();
+    BaseType_t woken = pdFALSE;
+    vTaskNotifyGiveFromISR(self->sample_task, &woken);
+    if (woken) portYIELD_FROM_ISR();
+  }
+
+  static void sample_loop(void* arg) {
+    TimerSampleSource* self = (TimerSampleSource*)arg;
+    for (;;) {
+      uint32_t ticks = ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+      uint32_t t_us = self->tick_us;
+      for (uint32_t i = 1; i < ticks; i++) self->ring.drop();
+      if (self->ring.full()) {
+        self->ring.drop();
+        continue;
+      }
+      self->ring.push({t_us, (uint16_t)analogRead(self->pin)});
+      if (self->notify_task && ++self->since_notify >= self->notify_every) {
+        self->since_notify = 0;
+        xTaskNotifyGive(self->notify_task);
+      }
+    }
+  }
+
+  static TimerSampleSource* instance;
+  hw_timer_t* timer = nullptr;
+  TaskHandle_t sample_task = nullptr;
+  volatile uint32_t tick_us = 0;
+  uint8_t pin;
+  TaskHandle_t notify_task = nullptr;
+  int notify_every = 1;
+  int since_notify = 0;
+};
+
+template <int N>
+TimerSampleSource<N>* TimerSampleSource<N>::instance = nullptr;
+
+#endif  // TIMER_SAMPLE_SOURCE_H
@@ -0,0 +1,109 @@
+// Three-level Daubechies-4 wavelet features (24-29)
+// Reproduces pywt.wavedec(window, 'db4', level=3) with pywt's default
+// 'symmetric' boundary mode, which the shipped models were trained on.
+// All buffers are sized at compile time: no heap, no VLAs on the stack.
+
+#ifndef WAVELET_DB4_H
+#define WAVELET_DB4_H
+
+#include <math.h>
+
+#define DB4_TAPS 8
+#define NUM_WAVELET_FEATURES 6
+
+// pywt.Wavelet('db4').dec_lo; dec_hi is its quadrature mirror
+static const float kDb4Lo[DB4_TAPS] = {
+  -0.010597401784997278f, 0.032883011666982945f, 0.030841381835986965f,
+  -0.18703481171888114f, -0.02798376941698385f, 0.6308807679295904f,
+  0.7148465705525415f, 0.23037781330885523f
+};
+static const float kDb4Hi[DB4_TAPS] = {
+  -0.23037781330885523f, 0.7148465705525415f, -0.6308807679295904f,
+  -0.02798376941698385f, 0.18703481171888114f, 0.030841381835986965f,
+  -0.032883011666982945f, -0.010597401784997278f
+};
+
+// Coefficients per level in symmetric mode: floor((n + taps - 1) / 2)
+constexpr int dwt_len(int n) { return (n + DB4_TAPS - 1) / 2; }
+
+template <int N>
+class WaveletDb4 {
+  static constexpr int L1 = dwt_len(N);
+  static constexpr int L2 = dwt_len(L1);
+  static constexpr int L3 = dwt_len(L2);
+  static_assert(L2 >= DB4_TAPS, "Window too short for a level-3 db4 decomposition");
+
+public:
+  // out: std(cA3), std(cD3), std(cD2), std(cD1), sum|cD3|, sum|cD2|
+  // (the order of pywt's [cA3, cD3, cD2, cD1] coefficient list)
+  void extract(const float* x, float* out) {
+    DetailStats d1, d2, d3;
+    level(x, N, a1, d1);
+    level(a1, L1, a2, d2);
+    level(a2, L2, a3, d3);
+
+    float mean = 0;
+    for (int i = 0; i < L3; i++) mean += a3[i];
+    mean /= L3;
+    float var = 0;
+    for (int i = 0; i < L3; i++) var += (a3[i] - mean) * (a3[i] - mean);
+
+    out[0] = sqrtf(var / L3);
+    out[1] = d3.std();
+    out[2] = d2.std();
+    out[3] = d1.std();
+    out[4] = d3.sum_abs;
+    out[5] = d2.sum_abs;
+  }
+
+private:
+  // Detail coefficients are only ever reduced, so they are never stored
+  struct DetailStats {
+    int n = 0;
+    float sum = 0, sum_sq = 0, sum_abs = 0;
+    void add(float d) {
+      n++;
+      sum += d;
+      sum_sq += d * d;
+      sum_abs += fabsf(d);
+    }
+    float std() const {
+      float mean = sum / n;
+      float var = sum_sq / n - mean * mean;
+      return var > 0 ? sqrtf(var) : 0;
+    }
+  };
+
+  // One level of pywt.dwt(x, 'db4', mode='symmetric'): every second output
+  // of the full convolution over the half-sample symmetric extension
+  static void level(const float* x, int n, float* approx, DetailStats& detail) {
+    int out = dwt_len(n);
+    for (int o = 0; o < out; o++) {
+      int i = 2 * o + 1;
+      float a = 0, d = 0;
+      if (i >= DB4_TAPS - 1 && i < n) {
+        // Interior: no boundary handling needed
+        for (int j = 0; j < DB4_TAPS; j++) {
+          a += kDb4Lo[j] * x[i - j];
+          d += kDb4Hi[j] * x[i - j];
+        }
+      } else {
+        for (int j = 0; j < DB4_TAPS; j++) {
+          int idx = i - j;
+          if (idx < 0) idx = -idx - 1;
+          else if (idx >= n) idx = 2 * n - idx - 1;
+          a += kDb4Lo[j] * x[idx];
+          d += kDb4Hi[j] * x[idx];
+        }
+      }
+      approx[o] = a;
+      detail.add(d);
+    }
+  }
+
+  float a1[L1];
+  float a2[L2];
+  float a3[L3];
+};
+
+#endif  // WAVELET_DB4_H
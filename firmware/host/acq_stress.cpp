@@ -0,0 +1,176 @@
+// Stress test for the acquisition layer (sample_source.h): a replay thread
+// plays the timer ISR into a SampleRing while this thread runs the RF
+// detector's consumer loop (streaming extractor, lazy forest vote) with
+// injected stalls, then checks that every sample arrived in order with the
+// right value and that consumed + dropped accounts for every tick.
+//
+// Usage: acq_stress [--trace capture.csv|.rfcap] [--rate HZ] [--seconds S]
+//                   [--speed X] [--ring N] [--jitter-us US] [--stall-prob P]
+//                   [--stall-us US] [--consumer-stall-prob P]
+//                   [--consumer-stall-us US] [--seed N]
+// Times are in sample-clock us; --speed (50) runs the sample clock X times
+// faster than real time (0: producer flat out). By default stamps jitter by
+// +-200 us, 0.1% of interrupts are held off up to 2 ms, and 10% of windows
+// stall the consumer for the sketch's worst case, a 24.5 ms OLED frame. Exits
+// non-zero if any sample is lost without being counted, reordered or
+// corrupted.
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include "replay_source.h"
+#include "random_forest_model.h"
+#include "feature_extractor.h"
+
+#define WINDOW_SIZE 100
+#define HOP_SIZE 10
+
+struct Options {
+  const char* trace = nullptr;
+  uint32_t rate = 200;
+  double seconds = 300;
+  double speed = 50;
+  int ring = 64;
+  ReplayJitter jitter;
+  double consumer_stall_prob = 0.1;
+  uint32_t consumer_stall_us = 24500;
+};
+
+static double percentile(std::vector<double>& v, double p) {
+  if (v.empty()) return 0;
+  size_t k = std::min(v.size() - 1, (size_t)(p * v.size()));
+  std::nth_element(v.begin(), v.begin() + k, v.end());
+  return v[k];
+}
+
+template <int N>
+static int run(const Options& opt, const std::vector<uint16_t>& adc) {
+  uint64_t ticks = (uint64_t)(opt.seconds * opt.rate);
+  ReplaySampleSource<N> source(adc, ticks, opt.speed, opt.jitter);
+  static FeatureExtractor<WINDOW_SIZE, HOP_SIZE, FOREST_FEATURE_MASK> extractor;
+  extractor = FeatureExtractor<WINDOW_SIZE, HOP_SIZE, FOREST_FEATURE_MASK>();
+
+  uint64_t consumed = 0, gaps = 0, errors = 0, windows = 0, stalls = 0;
+  uint64_t classes[6] = {0};
+  int64_t last_k = -1;
+  std::vector<double> ages_ms;
+  uint32_t rng = opt.jitter.seed * 747796405u + 1;
+  auto start = std::chrono::steady_clock::now();
+  auto sample_clock_us = [&] {
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() * opt.speed;
+  };
+
+  if (!source.begin(opt.rate)) return 1;
+  for (;;) {
+    Sample s;
+    if (!source.read(s)) {
+      if (source.finished() && !source.pending()) break;
+      // loop() would spin here; on the host, give the producer the CPU
+      if (opt.speed > 0) {
+        std::this_thread::sleep_for(std::chrono::duration<double, std::micro>(source.period() / opt.speed / 2));
+      } else {
+        std::this_thread::yield();
+      }
+      continue;
+    }
+    // Which tick this is: the first at or after the last one whose stamp matches
+    int64_t k = last_k + 1;
+    while ((uint64_t)k < ticks && source.timestamp(k) != s.t_us) k++;
+    if ((uint64_t)k >= ticks || source.adc_at(k) != s.adc) {
+      errors++;
+      k = last_k + 1;
+    }
+    gaps += k - last_k - 1;
+    last_k = k;
+    consumed++;
+    if (opt.speed > 0) ages_ms.push_back((sample_clock_us() - k * source.period()) / 1000.0);
+
+    extractor.add_sample((s.adc / 4095.0f) * 3300.0f);
+    if (extractor.is_window_ready()) {
+      classes[classify_random_forest_lazy(extractor)]++;
+      windows++;
+      rng = rng * 1664525u + 1013904223u;
+      if ((rng >> 8) * (1.0 / 16777216.0) < opt.consumer_stall_prob) {
+        stalls++;
+        double wall_us = opt.speed > 0 ? opt.consumer_stall_us / opt.speed : opt.consumer_stall_us / 1000.0;
+        std::this_thread::sleep_for(std::chrono::duration<double, std::micro>(wall_us));
+      }
+    }
+  }
+  source.end();
+  uint64_t produced = source.produced();
+  gaps += produced - 1 - last_k;  // Dropped after the last sample read
+  double wall = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  bool ok = !errors && consumed + source.dropped() == produced && gaps == source.dropped();
+  printf("acq_stress: %llu ticks at %u Hz (%.1f s of samples) in %.2f s wall, ring %d\n",
+         (unsigned long long)produced, opt.rate, produced / (double)opt.rate, wall, N);
+  printf("  consumed:   %llu, dropped %u (ring full), max backlog %d/%d\n",
+         (unsigned long long)consumed, source.dropped(), source.max_pending(), N);
+  if (!ages_ms.empty()) {
+    double p50 = percentile(ages_ms, 0.5), p99 = percentile(ages_ms, 0.99);
+    printf("  age at read: p50 %.2f ms, p99 %.2f ms, max %.2f ms\n", p50, p99,
+           *std::max_element(ages_ms.begin(), ages_ms.end()));
+  }
+  printf("  windows:    %llu classified, %llu consumer stalls of %.1f ms\n", (unsigned long long)windows,
+         (unsigned long long)stalls, opt.consumer_stall_us / 1000.0);
+  printf("  classes:   ");
+  for (int c = 0; c < 6; c++) printf(" %s %.1f%%", activity_names[c], windows ? 100.0 * classes[c] / windows : 0.0);
+  printf("\n");
+  printf("  integrity:  %s (%llu mismatched, %llu gaps vs %u counted drops)\n", ok ? "OK" : "FAILED",
+         (unsigned long long)errors, (unsigned long long)gaps, source.dropped());
+  return ok ? 0 : 1;
+}
+
+int main(int argc, char** argv) {
+  Options opt;
+  opt.jitter.timestamp_us = 200;
+  opt.jitter.stall_prob = 0.001;
+  opt.jitter.stall_us = 2000;
+  for (int i = 1; i < argc; i++) {
+    const char* arg = argv[i];
+    const char* value = i + 1 < argc ? argv[++i] : nullptr;
+    if (!value) {
+      fprintf(stderr, "unknown or incomplete option %s\n", arg);
+      return 2;
+    }
+    else if (!strcmp(arg, "--trace")) opt.trace = value;
+    else if (!strcmp(arg, "--rate")) opt.rate = atoi(value);
+    else if (!strcmp(arg, "--seconds")) opt.seconds = atof(value);
+    else if (!strcmp(arg, "--speed")) opt.speed = atof(value);
+    else if (!strcmp(arg, "--ring")) opt.ring = atoi(value);
+    else if (!strcmp(arg, "--jitter-us")) opt.jitter.timestamp_us = atoi(value);
+    else if (!strcmp(arg, "--stall-prob")) opt.jitter.stall_prob = atof(value);
+    else if (!strcmp(arg, "--stall-us")) opt.jitter.stall_us = atoi(value);
+    else if (!strcmp(arg, "--consumer-stall-prob")) opt.consumer_stall_prob = atof(value);
+    else if (!strcmp(arg, "--consumer-stall-us")) opt.consumer_stall_us = atoi(value);
+    else if (!strcmp(arg, "--seed")) opt.jitter.seed = atoi(value);
+    else {
+      fprintf(stderr, "unknown option %s\n", arg);
+      return 2;
+    }
+  }
+  if (!opt.rate || opt.speed < 0 || 2 * opt.jitter.timestamp_us >= 1000000 / opt.rate) {
+    fprintf(stderr, "--rate must be positive, --speed not negative, --jitter-us under half a period\n");
+    return 2;
+  }
+
+  std::vector<uint16_t> adc;
+  if (opt.trace ? !load_replay_adc(opt.trace, adc) : (adc = synthetic_replay_adc(opt.jitter.seed)).empty()) return 1;
+  switch (opt.ring) {
+    case 16: return run<16>(opt, adc);
+    case 32: return run<32>(opt, adc);
+    case 64: return run<64>(opt, adc);
+    case 128: return run<128>(opt, adc);
+    case 256: return run<256>(opt, adc);
+    case 1024: return run<1024>(opt, adc);
+  }
+  fprintf(stderr, "--ring must be 16, 32, 64, 128, 256 or 1024\n");
+  return 2;
+}
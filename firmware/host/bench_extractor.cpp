@@ -0,0 +1,142 @@
+// Feature extractor benchmark: FeatureExtractor specialized on the mask of
+// features the generated random_forest_model.h tests, vs all 30 features,
+// on a seeded synthetic sample stream shaped like ADC captures. Reports
+// extractor RAM and time per window (HOP_SIZE samples, then either every
+// feature in the mask or, for masks that cover the model, the lazy vote).
+//
+// Usage: bench_extractor [--windows N]
+// Exits non-zero if a masked extractor disagrees with the full one on any
+// feature it keeps, or the lazy forest vote differs from the eager one.
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include "random_forest_model.h"
+#include "feature_extractor.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define HAVE_TSC 1
+#endif
+
+#define WINDOW_SIZE 100
+#define HOP_SIZE 10
+
+// Quantised to 12-bit ADC steps, with bursts like the collector's activities
+static std::vector<float> make_stream(int count, unsigned seed) {
+  std::mt19937 rng(seed);
+  std::normal_distribution<float> noise(0, 15);
+  std::uniform_int_distribution<int> burst(0, 4);
+  std::vector<float> out(count);
+  int period = 5;
+  for (int i = 0; i < count; i++) {
+    if (i % WINDOW_SIZE == 0) period = 5 + burst(rng) * 7;
+    float mv = 1420 + noise(rng) + ((i % period) < 2 ? 60 : 0);
+    int adc = (int)(mv / 3300.0f * 4095.0f);
+    out[i] = (adc / 4095.0f) * 3300.0f;
+  }
+  return out;
+}
+
+struct Timing {
+  double ns;
+  double cycles;  // TSC ticks, 0 where there is no TSC
+};
+
+static uint64_t ticks() {
+#ifdef HAVE_TSC
+  return __rdtsc();
+#else
+  return 0;
+#endif
+}
+
+// Sample loop as run on the device: add every sample, and at each hop
+// either read every feature or classify lazily
+template <typename Extractor, bool Lazy>
+static Timing time_windows(const std::vector<float>& stream) {
+  static Extractor extractor;
+  extractor = Extractor();
+  int windows = 0;
+  volatile float sink = 0;
+  uint64_t t0 = ticks();
+  auto start = std::chrono::steady_clock::now();
+  for (float v : stream) {
+    extractor.add_sample(v);
+    if (!extractor.is_window_ready()) continue;
+    if (Lazy) {
+      sink = sink + classify_random_forest_lazy(extractor);
+    } else {
+      float features[NUM_FEATURES];
+      extractor.extract_features(features);
+      sink = sink + features[0];
+    }
+    windows++;
+  }
+  auto end = std::chrono::steady_clock::now();
+  uint64_t t1 = ticks();
+  return {std::chrono::duration<double, std::nano>(end - start).count() / windows,
+          (double)(t1 - t0) / windows};
+}
+
+static void print_timing(const char* what, Timing t) {
+  printf("  %8.0f ns", t.ns);
+  if (t.cycles > 0) printf(" %7.0f cycles", t.cycles);
+  printf(" %s", what);
+}
+
+template <uint32_t Mask>
+static bool report(const char* name, const std::vector<float>& stream) {
+  typedef FeatureExtractor<WINDOW_SIZE, HOP_SIZE, Mask> Masked;
+  typedef FeatureExtractor<WINDOW_SIZE, HOP_SIZE> Full;
+
+  // Cross-check against the full extractor, eager, window by window
+  static Masked masked;
+  static Full full;
+  masked = Masked();
+  full = Full();
+  bool covers_model = (Mask & FOREST_FEATURE_MASK) == FOREST_FEATURE_MASK;
+  int mismatches = 0;
+  int vote_mismatches = 0;
+  for (float v : stream) {
+    masked.add_sample(v);
+    full.add_sample(v);
+    if (!masked.is_window_ready()) continue;
+    int lazy = classify_random_forest_lazy(masked);
+    float a[NUM_FEATURES], b[NUM_FEATURES];
+    masked.extract_features(a);
+    full.extract_features(b);
+    for (int k = 0; k < NUM_FEATURES; k++) {
+      if ((Mask & (1UL << k)) && memcmp(&a[k], &b[k], sizeof(float))) mismatches++;
+    }
+    if (covers_model && lazy != classify_random_forest(b)) vote_mismatches++;
+  }
+
+  time_windows<Masked, false>(stream);  // Warm up
+  printf("  %-17s %2d features %5zu B RAM", name, __builtin_popcount(Mask), sizeof(Masked));
+  print_timing("eager", time_windows<Masked, false>(stream));
+  if (covers_model) print_timing("lazy vote", time_windows<Masked, true>(stream));
+  printf("\n");
+  if (mismatches) printf("    %d features differ from the full extractor\n", mismatches);
+  if (vote_mismatches) printf("    %d windows vote differently from the eager path\n", vote_mismatches);
+  return mismatches == 0 && vote_mismatches == 0;
+}
+
+int main(int argc, char** argv) {
+  int windows = 20000;
+  for (int i = 1; i + 1 < argc; i++) {
+    if (!strcmp(argv[i], "--windows")) windows = atoi(argv[i + 1]);
+  }
+  std::vector<float> stream = make_stream(WINDOW_SIZE + windows * HOP_SIZE, 42);
+
+  printf("Feature extractor, window %d, hop %d, %d windows (per window)\n", WINDOW_SIZE,
+         HOP_SIZE, windows);
+  bool ok = report<FEATURE_MASK_ALL>("all features", stream);
+  ok = report<FOREST_FEATURE_MASK>("model mask", stream) && ok;
+  ok = report<feature_bits(0, 14)>("time domain only", stream) && ok;
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,82 @@
+// Random forest benchmark: the generated random_forest_model.h evaluated
+// over every row of the training feature matrix.
+//
+// Usage: bench_forest [X.npy] [--predictions FILE] [--budget-us US]
+// Prints ns/window and the model footprint; --predictions writes one class
+// id per row so extract_rf_to_cpp.py can check agreement with sklearn.
+// Exits non-zero if the forest misses the per-window budget.
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "npy.h"
+#include "random_forest_model.h"
+
+#ifndef DEFAULT_FEATURES
+#define DEFAULT_FEATURES "data/processed/X.npy"
+#endif
+
+int main(int argc, char** argv) {
+  const char* features_path = DEFAULT_FEATURES;
+  const char* predictions_path = nullptr;
+  double budget_us = 0;
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "--predictions") && i + 1 < argc) predictions_path = argv[++i];
+    else if (!strcmp(argv[i], "--budget-us") && i + 1 < argc) budget_us = atof(argv[++i]);
+    else features_path = argv[i];
+  }
+
+  NpyMatrix X;
+  if (!npy_load(features_path, X)) return 1;
+  if (X.cols != 30) {
+    fprintf(stderr, "expected 30 features per row, got %d\n", X.cols);
+    return 1;
+  }
+
+  // Warm the caches once, keeping the predictions for --predictions
+  std::vector<int> predictions(X.rows);
+  for (int r = 0; r < X.rows; r++) {
+    predictions[r] = classify_random_forest(X.row(r));
+  }
+
+  int repeats = 1 + 200000 / (X.rows * FOREST_NUM_TREES);
+  volatile int sink = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (int k = 0; k < repeats; k++) {
+    for (int r = 0; r < X.rows; r++) sink = sink + classify_random_forest(X.row(r));
+  }
+  auto end = std::chrono::steady_clock::now();
+  double ns = std::chrono::duration<double, std::nano>(end - start).count() /
+              ((double)repeats * X.rows);
+
+  int counts[FOREST_NUM_CLASSES] = {0};
+  for (int p : predictions) counts[p]++;
+
+  printf("Random forest (%s), %d trees, %d nodes, %d windows\n", FOREST_BACKEND, FOREST_NUM_TREES,
+         FOREST_NUM_NODES, X.rows);
+  printf("  ns_per_window: %.1f\n", ns);
+  printf("  flash:         %8d bytes\n", FOREST_FLASH_BYTES);
+  printf("  ram:           %8d bytes\n", FOREST_RAM_BYTES);
+  printf("  predictions:  ");
+  for (int c = 0; c < FOREST_NUM_CLASSES; c++) printf(" %s=%d", activity_names[c], counts[c]);
+  printf("\n");
+
+  if (predictions_path) {
+    FILE* f = fopen(predictions_path, "w");
+    if (!f) {
+      fprintf(stderr, "cannot write %s\n", predictions_path);
+      return 1;
+    }
+    for (int p : predictions) fprintf(f, "%d\n", p);
+    fclose(f);
+  }
+
+  if (budget_us > 0 && ns / 1000.0 > budget_us) {
+    printf("  over budget: %.2f us > %.2f us\n", ns / 1000.0, budget_us);
+    return 1;
+  }
+  return 0;
+}
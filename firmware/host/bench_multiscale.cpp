@@ -0,0 +1,200 @@
+// Multi-resolution extraction benchmark: one MultiScaleExtractor (50, 100
+// and 200-sample windows over a shared ring, 2_tinyml_inference/
+// multi_scale_extractor.h) against three independent FeatureExtractors of
+// the same lengths, the 100-sample one with all 30 features and the others
+// with the 14 time-domain ones. Reports RAM, ns and cycles per sample for
+// the update alone, and per window (HOP_SIZE samples, then every feature
+// of the 58, or the lazy forest vote on the 100-sample window).
+//
+// Usage: bench_multiscale [--trace CSV|RFCAP] [--repeat N]
+// The stream is a collector trace or the simulator's synthetic pattern (20 s
+// of each activity in turn, 120 s), looped --repeat (5) times.
+// Exits non-zero if any feature differs from the independent extractors'.
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "random_forest_model.h"
+#include "multi_scale_extractor.h"
+#include "replay_source.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define HAVE_TSC 1
+#endif
+
+#define SHORT_WINDOW 50
+#define WINDOW_SIZE 100
+#define LONG_WINDOW 200
+#define HOP_SIZE 10
+
+constexpr uint32_t TIME_MASK = feature_bits(0, NUM_TIME_FEATURES);
+
+typedef MultiScaleExtractor<SHORT_WINDOW, WINDOW_SIZE, LONG_WINDOW, HOP_SIZE> Multi;
+typedef FeatureExtractor<SHORT_WINDOW, HOP_SIZE, TIME_MASK> ShortExtractor;
+typedef FeatureExtractor<WINDOW_SIZE, HOP_SIZE> BaseExtractor;
+typedef FeatureExtractor<LONG_WINDOW, HOP_SIZE, TIME_MASK> LongExtractor;
+
+// Three extractors behind the multi-scale interface
+struct Independent {
+  ShortExtractor short_scale;
+  BaseExtractor base;
+  LongExtractor long_scale;
+
+  void add_sample(float v) {
+    short_scale.add_sample(v);
+    base.add_sample(v);
+    long_scale.add_sample(v);
+  }
+
+  bool is_window_ready() const { return long_scale.is_window_ready(); }
+
+  float operator[](int k) { return k < NUM_FEATURES ? base[k] : 0; }
+
+  void extract_features(float* features) {
+    base.extract_features(features);
+    for (int k = 0; k < NUM_TIME_FEATURES; k++) {
+      features[Multi::feature_index(SCALE_SHORT, k)] = short_scale[k];
+      features[Multi::feature_index(SCALE_LONG, k)] = long_scale[k];
+    }
+  }
+};
+
+struct Timing {
+  double ns;
+  double cycles;  // TSC ticks, 0 where there is no TSC
+};
+
+static uint64_t ticks() {
+#ifdef HAVE_TSC
+  return __rdtsc();
+#else
+  return 0;
+#endif
+}
+
+enum Mode { UPDATE, EAGER, LAZY };
+
+// Sample loop as run on the device. Per sample for UPDATE, else per window.
+template <typename Extractor, Mode M>
+static Timing time_loop(const std::vector<float>& stream) {
+  static Extractor extractor;
+  extractor = Extractor();
+  long windows = 0;
+  volatile float sink = 0;
+  uint64_t t0 = ticks();
+  auto start = std::chrono::steady_clock::now();
+  for (float v : stream) {
+    extractor.add_sample(v);
+    if (M == UPDATE || !extractor.is_window_ready()) continue;
+    if (M == LAZY) {
+      sink = sink + classify_random_forest_lazy(extractor);
+    } else {
+      float features[MULTISCALE_NUM_FEATURES];
+      extractor.extract_features(features);
+      sink = sink + features[0];
+    }
+    windows++;
+  }
+  auto end = std::chrono::steady_clock::now();
+  uint64_t t1 = ticks();
+  double per = M == UPDATE ? (double)stream.size() : (double)windows;
+  return {std::chrono::duration<double, std::nano>(end - start).count() / per,
+          (double)(t1 - t0) / per};
+}
+
+static void print_row(const char* name, size_t ram, const Timing* t) {
+  printf("%-18s %6zu", name, ram);
+  for (int i = 0; i < 3; i++) {
+    if (t[i].ns > 0) printf(" %9.0f %9.0f", t[i].ns, t[i].cycles);
+    else printf(" %9s %9s", "-", "-");
+  }
+  printf("\n");
+}
+
+// Every window, every feature, bit for bit; and the forest's lazy vote on
+// the multi-scale extractor against the eager vote on the Base features
+static bool cross_check(const std::vector<float>& stream) {
+  static Multi multi;
+  static Independent three;
+  multi = Multi();
+  three = Independent();
+  long windows = 0, mismatches = 0, vote_mismatches = 0;
+  for (float v : stream) {
+    multi.add_sample(v);
+    three.add_sample(v);
+    if (multi.is_window_ready() != three.is_window_ready()) {
+      printf("  window boundaries differ\n");
+      return false;
+    }
+    if (!multi.is_window_ready()) continue;
+    windows++;
+    int lazy = classify_random_forest_lazy(multi);
+    float a[MULTISCALE_NUM_FEATURES], b[MULTISCALE_NUM_FEATURES];
+    multi.extract_features(a);
+    three.extract_features(b);
+    for (int k = 0; k < MULTISCALE_NUM_FEATURES; k++) {
+      mismatches += memcmp(&a[k], &b[k], sizeof(float)) != 0;
+    }
+    vote_mismatches += lazy != classify_random_forest(b);
+  }
+  printf("%ld windows cross-checked", windows);
+  if (mismatches) printf(", %ld features differ from the independent extractors", mismatches);
+  if (vote_mismatches) printf(", %ld lazy votes differ", vote_mismatches);
+  printf("\n");
+  return mismatches == 0 && vote_mismatches == 0;
+}
+
+int main(int argc, char** argv) {
+  const char* trace = nullptr;
+  int repeat = 5;
+  for (int i = 1; i < argc; i++) {
+    const char* arg = argv[i];
+    bool has_value = i + 1 < argc;
+    if (!strcmp(arg, "--trace") && has_value) trace = argv[++i];
+    else if (!strcmp(arg, "--repeat") && has_value) repeat = atoi(argv[++i]);
+    else {
+      fprintf(stderr, "usage: bench_multiscale [--trace CSV|RFCAP] [--repeat N]\n");
+      return 2;
+    }
+  }
+  if (repeat < 1) repeat = 1;
+
+  std::vector<uint16_t> adc;
+  if (trace && !load_replay_adc(trace, adc)) return 1;
+  if (!trace) adc = activity_replay_adc(120, 1);
+  std::vector<float> stream;
+  for (int i = 0; i < repeat; i++) {
+    for (uint16_t a : adc) stream.push_back((a / 4095.0f) * 3300.0f);
+  }
+  if ((int)stream.size() < LONG_WINDOW) {
+    fprintf(stderr, "trace shorter than one window\n");
+    return 1;
+  }
+
+  printf("Windows %d/%d/%d, hop %d, %zu samples of %s\n", SHORT_WINDOW, WINDOW_SIZE, LONG_WINDOW,
+         HOP_SIZE, stream.size(), trace ? trace : "synthetic");
+  bool ok = cross_check(stream);
+
+  time_loop<Independent, EAGER>(stream);  // Warm up
+  Timing three[3] = {time_loop<Independent, UPDATE>(stream), time_loop<Independent, EAGER>(stream),
+                     time_loop<Independent, LAZY>(stream)};
+  Timing multi[3] = {time_loop<Multi, UPDATE>(stream), time_loop<Multi, EAGER>(stream),
+                     time_loop<Multi, LAZY>(stream)};
+  Timing base[3] = {time_loop<BaseExtractor, UPDATE>(stream), {0, 0},
+                    time_loop<BaseExtractor, LAZY>(stream)};
+
+  printf("%-18s %6s %19s %19s %19s\n", "", "RAM", "update per sample", "58 features/window",
+         "lazy vote/window");
+  printf("%-18s %6s %9s %9s %9s %9s %9s %9s\n", "", "B", "ns", "cycles", "ns", "cycles", "ns", "cycles");
+  print_row("three extractors", sizeof(Independent), three);
+  print_row("multi-scale", sizeof(Multi), multi);
+  print_row("100 samples alone", sizeof(BaseExtractor), base);
+  printf("multi-scale / three: %.2fx RAM, %.2fx update, %.2fx 58 features, %.2fx lazy vote\n",
+         (double)sizeof(Multi) / sizeof(Independent), multi[0].ns / three[0].ns, multi[1].ns / three[1].ns,
+         multi[2].ns / three[2].ns);
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,89 @@
+// Forest backend benchmark: nested if/else, node-array traversal (float
+// and quantized integer thresholds) and QuickScorer bitvectors on the same
+// 1, 10 and 100 trees, over every row of the training feature matrix.
+// Forests come from forest_bench_models.h, generated at build time by
+// ml_training/forest_bench_models.py.
+//
+// Usage: bench_quickscorer [X.npy]
+// Exits non-zero if the backends disagree on any row, or on any of its
+// copies with one feature NaN (every NaN must go right, as in the if/else).
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+#include "npy.h"
+#include "forest_bench_models.h"
+
+#ifndef DEFAULT_FEATURES
+#define DEFAULT_FEATURES "data/processed/X.npy"
+#endif
+
+template <typename F>
+static double ns_per_window(const NpyMatrix& X, int trees, F predict) {
+  int repeats = 1 + 200000 / (X.rows * trees);
+  volatile int sink = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (int k = 0; k < repeats; k++) {
+    for (int r = 0; r < X.rows; r++) sink = sink + predict(X.row(r));
+  }
+  auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::nano>(end - start).count() /
+         ((double)repeats * X.rows);
+}
+
+template <typename IfElse, typename Quantized>
+static bool run(const NpyMatrix& X, int trees, IfElse ifelse, const Forest& nodes,
+                int nodes_flash, Quantized by_int, int int_bits, int int_flash,
+                const QuickScorer& qs, uint32_t* bitvectors, int qs_flash) {
+  auto by_nodes = [&](const float* x) { return forest_predict(nodes, x); };
+  auto by_qs = [&](const float* x) { return quickscorer_predict(qs, x, bitvectors); };
+
+  auto agree = [&](const float* x) {
+    int expected = ifelse(x);
+    return by_nodes(x) == expected && by_int(x) == expected && by_qs(x) == expected;
+  };
+
+  // Each row as is, then with one feature NaN, both signs: x86 makes 0/0 -NaN
+  int mismatches = 0, nan_mismatches = 0;
+  std::vector<float> row(X.cols);
+  for (int r = 0; r < X.rows; r++) {
+    if (!agree(X.row(r))) mismatches++;
+    row.assign(X.row(r), X.row(r) + X.cols);
+    row[r % X.cols] = std::copysign(NAN, (r / X.cols) % 2 ? -1.0f : 1.0f);
+    if (!agree(row.data())) nan_mismatches++;
+  }
+
+  double ifelse_ns = ns_per_window(X, trees, ifelse);
+  double nodes_ns = ns_per_window(X, trees, by_nodes);
+  double int_ns = ns_per_window(X, trees, by_int);
+  double qs_ns = ns_per_window(X, trees, by_qs);
+
+  printf("  %3d trees\n", trees);
+  printf("    if/else           %9.0f ns\n", ifelse_ns);
+  printf("    nodes, float      %9.0f ns %8d B flash\n", nodes_ns, nodes_flash);
+  printf("    nodes, int%-2d      %9.0f ns %8d B flash\n", int_bits, int_ns, int_flash);
+  printf("    quickscorer       %9.0f ns %8d B flash %6d B RAM\n", qs_ns, qs_flash,
+         qs.num_trees * qs.words_per_tree * 4);
+  if (mismatches) printf("  %d rows disagree between backends\n", mismatches);
+  if (nan_mismatches) printf("  %d rows with a NaN feature disagree between backends\n", nan_mismatches);
+  return mismatches == 0 && nan_mismatches == 0;
+}
+
+#define RUN_FOREST(n)                                                            \
+  run(X, n, forest_##n::predict_ifelse, forest_##n::NODES, forest_##n::NODES_FLASH, \
+      forest_##n::quantized::predict, forest_##n::quantized::BITS,                 \
+      forest_##n::quantized::NODES_FLASH,                                          \
+      forest_##n::QS, forest_##n::QS_BITVECTORS, forest_##n::QS_FLASH)
+
+int main(int argc, char** argv) {
+  NpyMatrix X;
+  if (!npy_load(argc > 1 ? argv[1] : DEFAULT_FEATURES, X)) return 1;
+
+  printf("Forest backends, %d windows (ns/window, table sizes)\n", X.rows);
+  bool ok = RUN_FOREST(1);
+  ok = RUN_FOREST(10) && ok;
+  ok = RUN_FOREST(100) && ok;
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,157 @@
+// Spectral stage benchmark: real FFT features and the streaming sliding DFT
+// vs the old difference-based approximation, on seeded synthetic windows
+// shaped like ADC captures.
+//
+// Usage: bench_spectral [--windows N] [--budget-us US]
+// Exits non-zero if the FFT path misses the per-window budget, or if either
+// spectrum disagrees with a double-precision DFT.
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include "rfft.h"
+#include "sliding_dft.h"
+#include "spectral_features.h"
+
+#define WINDOW_SIZE 100
+#define HOP_SIZE 10
+
+// Previous on-device approximation, kept verbatim as the baseline
+static void approx_spectral_features(const float* window, float* features) {
+  float energy_low = 0, energy_mid = 0, energy_high = 0;
+  for (int i = 0; i < WINDOW_SIZE / 2; i++) {
+    float val = fabsf(window[i] - window[i + WINDOW_SIZE / 2]);
+    if (i < 10) energy_low += val;
+    else if (i < 50) energy_mid += val;
+    else energy_high += val;
+  }
+  features[0] = energy_low;
+  features[1] = energy_mid;
+  features[2] = energy_high;
+  features[3] = energy_low + energy_mid + energy_high;
+  for (int i = 4; i < NUM_SPECTRAL_FEATURES; i++) features[i] = 0;
+}
+
+// Quantised to 12-bit ADC steps, with bursts like the collector's activities
+static std::vector<float> make_windows(int count, unsigned seed) {
+  std::mt19937 rng(seed);
+  std::normal_distribution<float> noise(0, 15);
+  std::uniform_int_distribution<int> burst(0, 4);
+  std::vector<float> out(count * WINDOW_SIZE);
+  for (int w = 0; w < count; w++) {
+    int period = 5 + burst(rng) * 7;
+    for (int i = 0; i < WINDOW_SIZE; i++) {
+      float mv = 1420 + noise(rng) + ((i % period) < 2 ? 60 : 0);
+      int adc = (int)(mv / 3300.0f * 4095.0f);
+      out[w * WINDOW_SIZE + i] = (adc / 4095.0f) * 3300.0f;
+    }
+  }
+  return out;
+}
+
+static double max_dft_error(RealFFT<WINDOW_SIZE>& fft, const float* x) {
+  float mag[WINDOW_SIZE / 2];
+  fft.magnitudes(x, mag);
+  double peak = 0, err = 0;
+  for (int k = 0; k < WINDOW_SIZE / 2; k++) {
+    double re = 0, im = 0;
+    for (int n = 0; n < WINDOW_SIZE; n++) {
+      re += x[n] * cos(2 * M_PI * k * n / WINDOW_SIZE);
+      im -= x[n] * sin(2 * M_PI * k * n / WINDOW_SIZE);
+    }
+    double ref = sqrt(re * re + im * im);
+    peak = fmax(peak, ref);
+    err = fmax(err, fabs(ref - mag[k]));
+  }
+  return err / peak;
+}
+
+template <typename F>
+static double ns_per_window(const std::vector<float>& windows, int count, F fn) {
+  auto start = std::chrono::steady_clock::now();
+  for (int w = 0; w < count; w++) fn(&windows[w * WINDOW_SIZE]);
+  auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::nano>(end - start).count() / count;
+}
+
+int main(int argc, char** argv) {
+  int count = 20000;
+  double budget_us = 0;
+  for (int i = 1; i + 1 < argc; i += 2) {
+    if (!strcmp(argv[i], "--windows")) count = atoi(argv[i + 1]);
+    else if (!strcmp(argv[i], "--budget-us")) budget_us = atof(argv[i + 1]);
+  }
+
+  std::vector<float> windows = make_windows(count, 42);
+  static RealFFT<WINDOW_SIZE> fft;
+  float mag[WINDOW_SIZE / 2];
+  float features[NUM_SPECTRAL_FEATURES];
+  volatile float sink = 0;
+
+  double err = 0;
+  for (int w = 0; w < 64 && w < count; w++) {
+    err = fmax(err, max_dft_error(fft, &windows[w * WINDOW_SIZE]));
+  }
+
+  double approx_ns = ns_per_window(windows, count, [&](const float* x) {
+    approx_spectral_features(x, features);
+    sink = sink + features[3];
+  });
+  double fft_ns = ns_per_window(windows, count, [&](const float* x) {
+    fft.magnitudes(x, mag);
+    sink = sink + mag[1];
+  });
+  double full_ns = ns_per_window(windows, count, [&](const float* x) {
+    fft.magnitudes(x, mag);
+    extract_spectral_features(mag, WINDOW_SIZE / 2, features);
+    sink = sink + features[7];
+  });
+
+  // Streaming: the windows back to back as one sample stream
+  static SlidingDFT<WINDOW_SIZE, WINDOW_SIZE / 2> sdft;
+  int total = count * WINDOW_SIZE;
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < total; i++) {
+    int32_t old = i >= WINDOW_SIZE ? to_fixed(windows[i - WINDOW_SIZE]) : 0;
+    sdft.update(to_fixed(windows[i]), old);
+  }
+  auto end = std::chrono::steady_clock::now();
+  double sdft_sample_ns =
+      std::chrono::duration<double, std::nano>(end - start).count() / total;
+  double sdft_hop_ns = ns_per_window(windows, count, [&](const float*) {
+    sdft.magnitudes(mag);
+    extract_spectral_features(mag, WINDOW_SIZE / 2, features);
+    sink = sink + features[7];
+  });
+
+  // The stream ends on the last window, so both spectra must agree there
+  float fft_mag[WINDOW_SIZE / 2];
+  sdft.magnitudes(mag);
+  fft.magnitudes(&windows[(count - 1) * WINDOW_SIZE], fft_mag);
+  double sdft_err = 0;
+  for (int k = 0; k < WINDOW_SIZE / 2; k++) {
+    sdft_err = fmax(sdft_err, fabs(mag[k] - fft_mag[k]) / fft_mag[0]);
+  }
+
+  printf("Spectral features, N=%d, %d windows\n", WINDOW_SIZE, count);
+  printf("  approximation (old):   %8.0f ns/window\n", approx_ns);
+  printf("  real FFT magnitudes:   %8.0f ns/window\n", fft_ns);
+  printf("  FFT + 10 features:     %8.0f ns/window\n", full_ns);
+  printf("  sliding DFT update:    %8.0f ns/sample (%.0f ns per %d-sample hop)\n",
+         sdft_sample_ns, sdft_sample_ns * HOP_SIZE, HOP_SIZE);
+  printf("  sliding DFT readout:   %8.0f ns/hop (magnitudes + 10 features)\n", sdft_hop_ns);
+  printf("  max error vs DFT:      %.2e FFT, %.2e sliding DFT (relative to peak bin)\n",
+         err, sdft_err);
+
+  bool ok = err < 1e-5 && sdft_err < 1e-5;
+  if (budget_us > 0 && full_ns / 1000.0 > budget_us) {
+    printf("  over budget: %.1f us > %.1f us\n", full_ns / 1000.0, budget_us);
+    ok = false;
+  }
+  return ok ? 0 : 1;
+}
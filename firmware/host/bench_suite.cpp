@@ -0,0 +1,452 @@
+// Benchmark suite: every hot path of both detector variants on fixed seeded
+// windows, and on a recorded capture and the training feature matrix when
+// given. Emits JSON (mean, p50 and p99 ns per op; instructions per op where
+// perf counters are readable) and compares it against a stored baseline.
+//
+// Usage: bench_suite [--trace capture.csv] [--features X.npy] [--windows N]
+//                    [--json FILE] [--baseline FILE] [--max-regression PCT]
+//                    [--repeats N] [--filter SUBSTRING]
+// --trace takes a collector CSV (timestamp_ms,voltage_mv,...) or .rfcap.
+// --json writes the results (a file written this way is also the baseline
+// format). With --baseline, exits non-zero if any benchmark's p50 is more
+// than --max-regression percent (default 10) above its baseline.
+//
+// The TinyML sketch is compiled against the simulator's stubs: its feature
+// extractor is measured, but the model has no TFLite Micro on the host.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "capture_store.h"
+#include "npy.h"
+#include "random_forest_model.h"
+#include "feature_extractor.h"
+
+// The TinyML sketch in its own namespace, as its globals and model.h would
+// clash with the forest's
+#include "Arduino.h"
+#include "WiFi.h"
+#include "Wire.h"
+#include "U8g2lib.h"
+#include "int8_model.h"
+#include "timer_sample_source.h"
+#include "retained_display.h"
+namespace tinyml_sketch {
+void run_inference();
+void run_model();
+void report_window(int window_class, bool early_exit, unsigned long inference_time);
+void apply_rate();
+void show_boot_screen();
+void show_ready_screen();
+void update_display(int predicted_class, unsigned long latency_us);
+#include "esp32_tinyml_detector.ino"
+}  // namespace tinyml_sketch
+
+extern const char* const SIM_SKETCH;
+const char* const SIM_SKETCH = "bench_suite";
+
+#ifndef DEFAULT_FEATURES
+#define DEFAULT_FEATURES "data/processed/X.npy"
+#endif
+
+#define BENCH_WINDOW 100
+#define BENCH_HOP 10
+#define MIN_BATCH_NS 2000   // Batches are sized to at least this, so timer overhead stays small
+
+// ============ INPUTS ============
+// Quantised to 12-bit ADC steps, with bursts like the collector's activities
+static std::vector<float> synthetic_stream(int count, unsigned seed) {
+  std::mt19937 rng(seed);
+  std::normal_distribution<float> noise(0, 15);
+  std::uniform_int_distribution<int> burst(0, 4);
+  std::vector<float> out(count);
+  int period = 5;
+  for (int i = 0; i < count; i++) {
+    if (i % BENCH_WINDOW == 0) period = 5 + burst(rng) * 7;
+    float mv = 1420 + noise(rng) + ((i % period) < 2 ? 60 : 0);
+    int adc = (int)(mv / 3300.0f * 4095.0f);
+    out[i] = (adc / 4095.0f) * 3300.0f;
+  }
+  return out;
+}
+
+// voltage_mv column of a collector CSV or .rfcap capture
+static bool load_capture(const char* path, std::vector<float>& out) {
+  if (CaptureStore::is_capture(path)) {
+    CaptureStore store;
+    if (!store.open(path)) return false;
+    for (int32_t v : store.voltage(0, store.rows())) {
+      if (v != CAPTURE_NO_VOLTAGE) out.push_back((float)capture_mv(v));
+    }
+  } else {
+    FILE* f = fopen(path, "r");
+    if (!f) {
+      fprintf(stderr, "cannot open %s\n", path);
+      return false;
+    }
+    char line[256];
+    while (fgets(line, sizeof(line), f)) {
+      double t;
+      float mv;
+      if (sscanf(line, "%lf,%f", &t, &mv) == 2) out.push_back(mv);
+    }
+    fclose(f);
+  }
+  if ((int)out.size() < BENCH_WINDOW * 2) {
+    fprintf(stderr, "%s: need at least %d voltage_mv rows\n", path, BENCH_WINDOW * 2);
+    return false;
+  }
+  return true;
+}
+
+// ============ COUNTERS ============
+// Retired instructions for this thread, when the kernel allows it
+class InstructionCounter {
+public:
+  InstructionCounter() {
+#ifdef __linux__
+    perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    fd = (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+#endif
+  }
+  ~InstructionCounter() {
+#ifdef __linux__
+    if (fd >= 0) close(fd);
+#endif
+  }
+  bool available() const { return fd >= 0; }
+  void start() {
+#ifdef __linux__
+    if (fd < 0) return;
+    ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+    ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+#endif
+  }
+  long long stop() {
+    long long count = -1;
+#ifdef __linux__
+    if (fd < 0) return -1;
+    ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+    if (read(fd, &count, sizeof(count)) != sizeof(count)) count = -1;
+#endif
+    return count;
+  }
+
+private:
+  int fd = -1;
+};
+
+// ============ HARNESS ============
+struct Result {
+  std::string name;
+  long long ops;
+  int batch;
+  double mean_ns;
+  double p50_ns;
+  double p99_ns;
+  double instructions;  // Per op, -1 when unavailable
+};
+
+// op(i) runs operation i; ops are timed in batches sized to MIN_BATCH_NS,
+// and the percentiles are over per-op times of those batches
+static Result measure_once(const std::string& name, long long ops,
+                      const std::function<void(long long)>& op, InstructionCounter& counter) {
+  typedef std::chrono::steady_clock Clock;
+
+  // Warm up and size the batch
+  long long warm = std::min(ops, 64LL);
+  auto t0 = Clock::now();
+  for (long long i = 0; i < warm; i++) op(i);
+  double warm_ns = std::chrono::duration<double, std::nano>(Clock::now() - t0).count() / warm;
+  int batch = std::max(1, (int)(MIN_BATCH_NS / std::max(warm_ns, 1.0)));
+
+  std::vector<double> per_op;
+  per_op.reserve(ops / batch + 1);
+  counter.start();
+  auto start = Clock::now();
+  auto mark = start;
+  for (long long i = 0; i < ops;) {
+    long long end = std::min(ops, i + batch);
+    for (; i < end; i++) op(i);
+    auto now = Clock::now();
+    per_op.push_back(std::chrono::duration<double, std::nano>(now - mark).count() / batch);
+    mark = now;
+  }
+  double total_ns = std::chrono::duration<double, std::nano>(mark - start).count();
+  long long instructions = counter.stop();
+
+  std::sort(per_op.begin(), per_op.end());
+  Result r;
+  r.name = name;
+  r.ops = ops;
+  r.batch = batch;
+  r.mean_ns = total_ns / ops;
+  r.p50_ns = per_op[per_op.size() / 2];
+  r.p99_ns = per_op[std::min(per_op.size() - 1, per_op.size() * 99 / 100)];
+  r.instructions = instructions >= 0 ? (double)instructions / ops : -1;
+  return r;
+}
+
+// Best of REPEATS passes by p50, so one preempted pass does not trip the
+// baseline check
+static int repeats = 5;
+
+static Result measure(const std::string& name, long long ops,
+                      const std::function<void(long long)>& op, InstructionCounter& counter) {
+  Result best = measure_once(name, ops, op, counter);
+  for (int i = 1; i < repeats; i++) {
+    Result r = measure_once(name, ops, op, counter);
+    if (r.p50_ns < best.p50_ns) best = r;
+  }
+  return best;
+}
+
+// ============ BENCHMARKS ============
+typedef FeatureExtractor<BENCH_WINDOW, BENCH_HOP> RfExtractor;
+typedef FeatureExtractor<BENCH_WINDOW, BENCH_HOP, FOREST_FEATURE_MASK> RfModelExtractor;
+
+static volatile float sink;
+
+// Stream source: samples plus the feature vector of every hop
+struct Source {
+  std::string tag;
+  std::vector<float> samples;
+  std::vector<float> features;  // NUM_FEATURES per window, from the full extractor
+  int windows = 0;
+};
+
+static void prepare(Source& s, int max_windows) {
+  static RfExtractor ex;
+  ex = RfExtractor();
+  for (float v : s.samples) {
+    ex.add_sample(v);
+    if (!ex.is_window_ready()) continue;
+    s.features.resize(s.features.size() + NUM_FEATURES);
+    ex.extract_features(&s.features[s.features.size() - NUM_FEATURES]);
+    if (++s.windows == max_windows) break;
+  }
+}
+
+static void run_source(const Source& s, std::vector<Result>& results, InstructionCounter& counter,
+                       const char* filter) {
+  auto add = [&](const std::string& name, long long ops, const std::function<void(long long)>& op) {
+    std::string full = name + "@" + s.tag;
+    if (filter && full.find(filter) == std::string::npos) return;
+    results.push_back(measure(full, ops, op, counter));
+  };
+  const float* samples = s.samples.data();
+  long long n = (long long)s.samples.size();
+  long long hops = (n - BENCH_WINDOW) / BENCH_HOP;
+
+  // Streaming extractor (esp32_rf_detector): one sample
+  static RfExtractor rf;
+  rf = RfExtractor();
+  add("rf.add_sample", n, [&](long long i) { rf.add_sample(samples[i]); });
+
+  // One hop as the device runs it: HOP samples, then every feature, or
+  // the lazy vote over the model-masked extractor
+  rf = RfExtractor();
+  for (int i = 0; i < BENCH_WINDOW; i++) rf.add_sample(samples[i]);
+  add("rf.window_eager", hops, [&](long long w) {
+    const float* x = samples + BENCH_WINDOW + (w % hops) * BENCH_HOP;
+    for (int i = 0; i < BENCH_HOP; i++) rf.add_sample(x[i]);
+    float f[NUM_FEATURES];
+    rf.extract_features(f);
+    sink = f[0];
+  });
+  static RfModelExtractor rf_model;
+  rf_model = RfModelExtractor();
+  for (int i = 0; i < BENCH_WINDOW; i++) rf_model.add_sample(samples[i]);
+  add("rf.window_lazy", hops, [&](long long w) {
+    const float* x = samples + BENCH_WINDOW + (w % hops) * BENCH_HOP;
+    for (int i = 0; i < BENCH_HOP; i++) rf_model.add_sample(x[i]);
+    sink = classify_random_forest_lazy(rf_model);
+  });
+
+  // Recomputing extractor (esp32_tinyml_detector): full window per call
+  static tinyml_sketch::FeatureExtractor tiny;
+  tiny = tinyml_sketch::FeatureExtractor();
+  for (int i = 0; i < BENCH_WINDOW; i++) tiny.add_sample(samples[i]);
+  add("tinyml.extract_features", hops, [&](long long w) {
+    tiny.add_sample(samples[BENCH_WINDOW + w % (n - BENCH_WINDOW)]);
+    int8_t row[NUM_FEATURES];
+    tiny.extract_features(row);
+    sink = row[0];
+  });
+
+  // Median and quartiles over the sliding window
+  static SortedWindow<int32_t, BENCH_WINDOW> sorted;
+  sorted = SortedWindow<int32_t, BENCH_WINDOW>();
+  for (int i = 0; i < BENCH_WINDOW; i++) sorted.insert(to_fixed(samples[i]));
+  add("order_stats.slide_quartiles", n - BENCH_WINDOW, [&](long long i) {
+    sorted.erase(to_fixed(samples[i]));
+    sorted.insert(to_fixed(samples[i + BENCH_WINDOW]));
+    sink = sorted.quantile(0.25f) + sorted.quantile(0.5f) + sorted.quantile(0.75f);
+  });
+
+  // Forest over precomputed feature vectors
+  const float* features = s.features.data();
+  int windows = s.windows;
+  add("forest.classify", windows, [&](long long w) {
+    sink = classify_random_forest(features + (w % windows) * NUM_FEATURES);
+  });
+}
+
+// ============ JSON ============
+static void write_json(FILE* f, const std::vector<Result>& results, bool instructions) {
+  fprintf(f, "{\n  \"suite\": \"bench_suite\",\n  \"instructions_available\": %s,\n",
+          instructions ? "true" : "false");
+  fprintf(f, "  \"benchmarks\": [\n");
+  for (size_t i = 0; i < results.size(); i++) {
+    const Result& r = results[i];
+    // One benchmark per line; read_baseline() relies on it
+    fprintf(f, "    {\"name\": \"%s\", \"ops\": %lld, \"batch\": %d, \"mean_ns\": %.1f, "
+            "\"p50_ns\": %.1f, \"p99_ns\": %.1f, \"instructions\": ",
+            r.name.c_str(), r.ops, r.batch, r.mean_ns, r.p50_ns, r.p99_ns);
+    if (r.instructions >= 0) fprintf(f, "%.1f", r.instructions);
+    else fprintf(f, "null");
+    fprintf(f, "}%s\n", i + 1 < results.size() ? "," : "");
+  }
+  fprintf(f, "  ]\n}\n");
+}
+
+struct Baseline {
+  std::string name;
+  double p50_ns;
+};
+
+// Reads the per-line benchmark objects write_json() emits
+static bool read_baseline(const char* path, std::vector<Baseline>& out) {
+  FILE* f = fopen(path, "r");
+  if (!f) {
+    fprintf(stderr, "cannot open baseline %s\n", path);
+    return false;
+  }
+  char line[1024];
+  while (fgets(line, sizeof(line), f)) {
+    const char* name = strstr(line, "\"name\": \"");
+    const char* p50 = strstr(line, "\"p50_ns\": ");
+    if (!name || !p50) continue;
+    name += strlen("\"name\": \"");
+    const char* end = strchr(name, '"');
+    if (!end) continue;
+    out.push_back({std::string(name, end - name), atof(p50 + strlen("\"p50_ns\": "))});
+  }
+  fclose(f);
+  return true;
+}
+
+int main(int argc, char** argv) {
+  const char* trace_path = nullptr;
+  const char* features_path = DEFAULT_FEATURES;
+  const char* json_path = nullptr;
+  const char* baseline_path = nullptr;
+  const char* filter = nullptr;
+  double max_regression = 10;
+  int windows = 5000;
+  for (int i = 1; i < argc; i++) {
+    const char* arg = argv[i];
+    const char* value = i + 1 < argc ? argv[++i] : nullptr;
+    if (!value) {
+      fprintf(stderr, "unknown or incomplete option %s\n", arg);
+      return 2;
+    }
+    else if (!strcmp(arg, "--trace")) trace_path = value;
+    else if (!strcmp(arg, "--features")) features_path = value;
+    else if (!strcmp(arg, "--json")) json_path = value;
+    else if (!strcmp(arg, "--baseline")) baseline_path = value;
+    else if (!strcmp(arg, "--max-regression")) max_regression = atof(value);
+    else if (!strcmp(arg, "--windows")) windows = std::max(1, atoi(value));
+    else if (!strcmp(arg, "--repeats")) repeats = std::max(1, atoi(value));
+    else if (!strcmp(arg, "--filter")) filter = value;
+    else {
+      fprintf(stderr, "unknown option %s\n", arg);
+      return 2;
+    }
+  }
+
+  SimConfig config;
+  sim_init(config);  // Backs the TinyML sketch's Arduino stubs
+
+  std::vector<Source> sources(1);
+  sources[0].tag = "synthetic";
+  sources[0].samples = synthetic_stream(BENCH_WINDOW + windows * BENCH_HOP, 42);
+  if (trace_path) {
+    sources.emplace_back();
+    sources.back().tag = "trace";
+    if (!load_capture(trace_path, sources.back().samples)) return 1;
+  }
+  for (Source& s : sources) prepare(s, windows);
+
+  InstructionCounter counter;
+  std::vector<Result> results;
+  for (const Source& s : sources) run_source(s, results, counter, filter);
+
+  // Recorded feature vectors
+  NpyMatrix X;
+  if (features_path && npy_load(features_path, X) && X.cols == NUM_FEATURES) {
+    std::string name = "forest.classify@X.npy";
+    if (!filter || name.find(filter) != std::string::npos) {
+      results.push_back(measure(name, std::max(X.rows, windows), [&](long long r) {
+        sink = classify_random_forest(X.row((int)(r % X.rows)));
+      }, counter));
+    }
+  }
+
+  printf("%-36s %10s %10s %10s %12s\n", "benchmark", "mean ns", "p50 ns", "p99 ns", "instr/op");
+  for (const Result& r : results) {
+    printf("%-36s %10.1f %10.1f %10.1f", r.name.c_str(), r.mean_ns, r.p50_ns, r.p99_ns);
+    if (r.instructions >= 0) printf(" %12.0f\n", r.instructions);
+    else printf(" %12s\n", "n/a");
+  }
+
+  if (json_path) {
+    FILE* f = fopen(json_path, "w");
+    if (!f) {
+      fprintf(stderr, "cannot write %s\n", json_path);
+      return 1;
+    }
+    write_json(f, results, counter.available());
+    fclose(f);
+  }
+
+  if (!baseline_path) return 0;
+  std::vector<Baseline> baseline;
+  if (!read_baseline(baseline_path, baseline)) return 1;
+  int regressions = 0;
+  printf("\nAgainst %s (max +%.0f%% on p50):\n", baseline_path, max_regression);
+  for (const Result& r : results) {
+    auto b = std::find_if(baseline.begin(), baseline.end(),
+                          [&](const Baseline& x) { return x.name == r.name; });
+    if (b == baseline.end() || b->p50_ns <= 0) {
+      printf("  %-36s not in baseline\n", r.name.c_str());
+      continue;
+    }
+    double change = 100.0 * (r.p50_ns / b->p50_ns - 1);
+    bool regressed = change > max_regression;
+    regressions += regressed;
+    printf("  %-36s %+7.1f%%%s\n", r.name.c_str(), change, regressed ? "  REGRESSION" : "");
+  }
+  return regressions ? 1 : 0;
+}
@@ -0,0 +1,119 @@
+// Wavelet stage benchmark: three-level db4 (as pywt.wavedec) vs the old
+// single Haar step with faked level-2/3 values, on seeded synthetic windows.
+//
+// Usage: bench_wavelet [--windows N] [--budget-us US]
+// Exits non-zero if db4 misses the per-window budget or fails its
+// self-checks (orthonormal filters, zero detail on a constant signal).
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include "wavelet_db4.h"
+
+#define WINDOW_SIZE 100
+
+// Previous on-device approximation, kept as the baseline
+static void haar_wavelet_features(const float* window, float* features) {
+  float approx[WINDOW_SIZE / 2], detail[WINDOW_SIZE / 2];
+  for (int i = 0; i < WINDOW_SIZE / 2; i++) {
+    approx[i] = (window[2 * i] + window[2 * i + 1]) / 2.0f;
+    detail[i] = (window[2 * i] - window[2 * i + 1]) / 2.0f;
+  }
+  float approx_sum = 0, approx_sum_sq = 0, detail_sum = 0, detail_sum_sq = 0;
+  float detail_energy1 = 0, detail_energy2 = 0;
+  for (int i = 0; i < WINDOW_SIZE / 2; i++) {
+    approx_sum += approx[i];
+    approx_sum_sq += approx[i] * approx[i];
+    detail_sum += detail[i];
+    detail_sum_sq += detail[i] * detail[i];
+    if (i < WINDOW_SIZE / 4) detail_energy1 += fabsf(detail[i]);
+    else detail_energy2 += fabsf(detail[i]);
+  }
+  float approx_mean = approx_sum / (WINDOW_SIZE / 2);
+  float detail_mean = detail_sum / (WINDOW_SIZE / 2);
+  features[0] = sqrtf(approx_sum_sq / (WINDOW_SIZE / 2) - approx_mean * approx_mean);
+  features[1] = sqrtf(detail_sum_sq / (WINDOW_SIZE / 2) - detail_mean * detail_mean);
+  features[2] = features[1] * 0.7f;
+  features[3] = features[1] * 0.5f;
+  features[4] = detail_energy1;
+  features[5] = detail_energy2;
+}
+
+static std::vector<float> make_windows(int count, unsigned seed) {
+  std::mt19937 rng(seed);
+  std::normal_distribution<float> noise(0, 15);
+  std::vector<float> out(count * WINDOW_SIZE);
+  for (int i = 0; i < count * WINDOW_SIZE; i++) {
+    int adc = (int)((1420 + noise(rng)) / 3300.0f * 4095.0f);
+    out[i] = (adc / 4095.0f) * 3300.0f;
+  }
+  return out;
+}
+
+template <typename F>
+static double ns_per_window(const std::vector<float>& windows, int count, F fn) {
+  auto start = std::chrono::steady_clock::now();
+  for (int w = 0; w < count; w++) fn(&windows[w * WINDOW_SIZE]);
+  auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::nano>(end - start).count() / count;
+}
+
+int main(int argc, char** argv) {
+  int count = 20000;
+  double budget_us = 0;
+  for (int i = 1; i + 1 < argc; i += 2) {
+    if (!strcmp(argv[i], "--windows")) count = atoi(argv[i + 1]);
+    else if (!strcmp(argv[i], "--budget-us")) budget_us = atof(argv[i + 1]);
+  }
+
+  static WaveletDb4<WINDOW_SIZE> wavelet;
+  float features[NUM_WAVELET_FEATURES];
+  volatile float sink = 0;
+  bool ok = true;
+
+  // Orthonormality: sum h^2 = 1 and h is orthogonal to its even shifts
+  double norm = 0, shift = 0;
+  for (int k = 0; k < DB4_TAPS; k++) norm += kDb4Lo[k] * kDb4Lo[k];
+  for (int k = 0; k + 2 < DB4_TAPS; k++) shift += kDb4Lo[k] * kDb4Lo[k + 2];
+  if (fabs(norm - 1) > 1e-6 || fabs(shift) > 1e-6) {
+    printf("  db4 filter is not orthonormal: %g %g\n", norm, shift);
+    ok = false;
+  }
+
+  // A constant has no detail at any level, boundaries included
+  float flat[WINDOW_SIZE];
+  for (int i = 0; i < WINDOW_SIZE; i++) flat[i] = 1425.0f;
+  wavelet.extract(flat, features);
+  for (int i = 0; i < NUM_WAVELET_FEATURES; i++) {
+    if (fabsf(features[i]) > 0.05f) {
+      printf("  constant input gives feature %d = %g\n", 24 + i, features[i]);
+      ok = false;
+    }
+  }
+
+  std::vector<float> windows = make_windows(count, 42);
+  double haar_ns = ns_per_window(windows, count, [&](const float* x) {
+    haar_wavelet_features(x, features);
+    sink = sink + features[1];
+  });
+  double db4_ns = ns_per_window(windows, count, [&](const float* x) {
+    wavelet.extract(x, features);
+    sink = sink + features[1];
+  });
+
+  printf("Wavelet features, N=%d, %d windows\n", WINDOW_SIZE, count);
+  printf("  Haar level 1 (old):    %8.0f ns/window\n", haar_ns);
+  printf("  db4 level 3:           %8.0f ns/window\n", db4_ns);
+  printf("  scratch:               %8zu bytes\n", sizeof(wavelet));
+
+  if (budget_us > 0 && db4_ns / 1000.0 > budget_us) {
+    printf("  over budget: %.1f us > %.1f us\n", db4_ns / 1000.0, budget_us);
+    ok = false;
+  }
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,237 @@
+// Decodes the data collector's binary serial protocol (OUTPUT_BINARY,
+// see 1_data_collection/capture_protocol.h) into a .rfcap capture and/or
+// the collector's CSV, from a saved stream or straight from the board.
+//
+// Usage: capture_decode (STREAM | --port DEVICE [--baud N])
+//                       [--out capture.rfcap] [--csv capture.csv] [--quiet]
+// With --port it sends a newline to start collection (the sketch's "press
+// any key") and STOP on Ctrl-C, as ml_training_pipeline.py's collector
+// does, and finishes at the END frame. Text the sketch prints between
+// frames goes to stderr unless --quiet. Exits non-zero if no sample frame
+// decoded.
+
+#include <cerrno>
+#include <cmath>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+#include "capture_protocol.h"
+#include "capture_store.h"
+#include "serial_port.h"
+
+static volatile sig_atomic_t interrupted = 0;
+
+static void on_sigint(int) { interrupted = 1; }
+
+struct Decoder {
+  CaptureWriter store;
+  FILE* csv = nullptr;
+  bool quiet = false;
+  std::vector<std::string> names;
+
+  uint64_t frames = 0, samples = 0, bad_frames = 0, lost_frames = 0, text_lines = 0;
+  uint32_t dropped = 0, overruns = 0;  // Latest device counters
+  bool have_seq = false, have_time = false, done = false;
+  uint16_t next_seq = 0;
+  uint64_t last_us = 0;  // Unwrapped device micros()
+  uint64_t first_us = 0;
+
+  std::vector<uint8_t> pending;
+  std::vector<uint8_t> payload;
+
+  void feed(const uint8_t* p, size_t n) {
+    for (size_t i = 0; i < n && !done; i++) {
+      if (p[i]) {
+        pending.push_back(p[i]);
+        continue;
+      }
+      if (!pending.empty()) frame(pending);
+      pending.clear();
+    }
+  }
+
+  // Bytes between two delimiters: a frame, or text printed between frames
+  void frame(const std::vector<uint8_t>& bytes) {
+    payload.resize(bytes.size());
+    size_t n = frame_decode(bytes.data(), bytes.size(), payload.data());
+    if (!n) {
+      text(bytes);
+      return;
+    }
+    switch (payload[0]) {
+      case FRAME_INFO: info(n); break;
+      case FRAME_SAMPLES: sample_frame(n); break;
+      case FRAME_END:
+        if (n >= 13) {
+          dropped = get_u32(&payload[5]);
+          overruns = get_u32(&payload[9]);
+        }
+        done = true;
+        break;
+      default: bad_frames++;
+    }
+  }
+
+  void text(const std::vector<uint8_t>& bytes) {
+    size_t printable = 0;
+    for (uint8_t c : bytes) printable += c >= 0x20 || c == '\n' || c == '\r' || c == '\t' || c >= 0x80;
+    if (printable < bytes.size()) {
+      bad_frames++;
+      return;
+    }
+    for (uint8_t c : bytes) text_lines += c == '\n';
+    if (!quiet) fwrite(bytes.data(), 1, bytes.size(), stderr);
+  }
+
+  void info(size_t n) {
+    if (n < 10 || payload[1] != PROTOCOL_VERSION) {
+      bad_frames++;
+      return;
+    }
+    names.clear();
+    size_t at = 10;
+    for (int a = 0; a < payload[9] && at < n; a++) {
+      const char* name = (const char*)&payload[at];
+      size_t len = strnlen(name, n - at);
+      names.emplace_back(name, len);
+      at += len + 1;
+    }
+    if (!quiet) {
+      fprintf(stderr, "[capture_decode] %u us sample period, %zu activities\n",
+              get_u32(&payload[2]), names.size());
+    }
+  }
+
+  void sample_frame(size_t n) {
+    int count = payload[SF_COUNT];
+    if (n != SAMPLES_HEADER_BYTES + (size_t)count * SAMPLE_BYTES) {
+      bad_frames++;
+      return;
+    }
+    frames++;
+    uint16_t seq = get_u16(&payload[SF_SEQ]);
+    if (have_seq && seq != next_seq) lost_frames += (uint16_t)(seq - next_seq);
+    have_seq = true;
+    next_seq = seq + 1;
+    dropped = get_u32(&payload[SF_DROPPED]);
+    overruns = get_u32(&payload[SF_OVERRUNS]);
+
+    // micros() wraps every 71.6 minutes; frames come far more often
+    uint32_t t0 = get_u32(&payload[SF_T0]);
+    uint64_t t = have_time ? last_us + (uint32_t)(t0 - (uint32_t)last_us) : t0;
+    if (!have_time) first_us = t;
+    have_time = true;
+
+    int activity = payload[SF_ACTIVITY];
+    int rep = payload[SF_REP];
+    int8_t rssi = (int8_t)payload[SF_RSSI];
+    int shift = payload[SF_SHIFT];
+    const char* name = activity < (int)names.size() ? names[activity].c_str() : "";
+    for (int i = 0; i < count; i++) {
+      const uint8_t* s = &payload[SAMPLES_HEADER_BYTES + i * SAMPLE_BYTES];
+      uint32_t packed = s[0] | (s[1] << 8) | (s[2] << 16);
+      t += (uint64_t)(packed >> 12) << shift;
+      int adc = packed & 0xFFF;
+      // As the CSV path computes it: (adc_raw / 4095.0) * 3300.0, printed to 0.01 mV
+      int32_t centi = (int32_t)llround(adc / 4095.0 * 3300.0 * 100);
+      uint32_t t_ms = (uint32_t)(t / 1000);
+      if (!store.add(t_ms, centi, rssi, activity, rep, name)) {
+        bad_frames++;
+        return;
+      }
+      if (csv) {
+        fprintf(csv, "%u,%d.%02d,%d,%d,%s\n", t_ms, centi / 100, centi % 100, rssi, activity, name);
+      }
+      samples++;
+    }
+    last_us = t;
+  }
+};
+
+int main(int argc, char** argv) {
+  const char* stream_path = nullptr;
+  const char* port = nullptr;
+  const char* out_path = nullptr;
+  const char* csv_path = nullptr;
+  int baud = 115200;
+  Decoder decoder;
+  for (int i = 1; i < argc; i++) {
+    const char* arg = argv[i];
+    const char* value = i + 1 < argc ? argv[i + 1] : nullptr;
+    if (!strcmp(arg, "--quiet")) decoder.quiet = true;
+    else if (arg[0] != '-' && !stream_path) stream_path = arg;
+    else if (!value) {
+      fprintf(stderr, "unknown or incomplete option %s\n", arg);
+      return 2;
+    }
+    else if (!strcmp(arg, "--port")) port = argv[++i];
+    else if (!strcmp(arg, "--baud")) baud = atoi(argv[++i]);
+    else if (!strcmp(arg, "--out")) out_path = argv[++i];
+    else if (!strcmp(arg, "--csv")) csv_path = argv[++i];
+    else {
+      fprintf(stderr, "unknown option %s\n", arg);
+      return 2;
+    }
+  }
+  if (!stream_path == !port || (!out_path && !csv_path)) {
+    fprintf(stderr, "usage: capture_decode (STREAM | --port DEVICE [--baud N]) "
+                    "[--out capture.rfcap] [--csv capture.csv] [--quiet]\n");
+    return 2;
+  }
+  if (csv_path) {
+    decoder.csv = fopen(csv_path, "w");
+    if (!decoder.csv) {
+      fprintf(stderr, "cannot write %s\n", csv_path);
+      return 1;
+    }
+    fprintf(decoder.csv, "timestamp_ms,voltage_mv,rssi_dbm,activity_id,activity_name\n");
+  }
+
+  uint8_t buf[4096];
+  if (port) {
+    int fd = open_port(port, baud);
+    if (fd < 0) return 1;
+    signal(SIGINT, on_sigint);
+    if (write(fd, "\n", 1) != 1) fprintf(stderr, "could not start collection on %s\n", port);
+    bool stopping = false;
+    for (;;) {
+      if (interrupted && !stopping) {
+        stopping = true;
+        if (write(fd, "STOP\n", 5) != 5) break;
+      }
+      ssize_t n = read(fd, buf, sizeof(buf));
+      if (n < 0 && errno != EINTR) break;
+      if (n > 0) decoder.feed(buf, n);
+      if (decoder.done || (stopping && n == 0)) break;
+    }
+    close(fd);
+  } else {
+    FILE* f = fopen(stream_path, "rb");
+    if (!f) {
+      fprintf(stderr, "cannot open %s\n", stream_path);
+      return 1;
+    }
+    for (size_t n; !decoder.done && (n = fread(buf, 1, sizeof(buf), f)) > 0;) decoder.feed(buf, n);
+    fclose(f);
+  }
+  if (decoder.csv) fclose(decoder.csv);
+
+  const Decoder& d = decoder;
+  double seconds = (d.last_us - d.first_us) / 1e6;
+  printf("%llu samples in %llu frames, %.1f s (%.0f Hz)%s\n", (unsigned long long)d.samples,
+         (unsigned long long)d.frames, seconds, seconds > 0 ? d.samples / seconds : 0.0,
+         d.done ? "" : ", no END frame");
+  printf("  link:   %llu bad frames, %llu frames lost (seq gaps), %llu text lines\n",
+         (unsigned long long)d.bad_frames, (unsigned long long)d.lost_frames,
+         (unsigned long long)d.text_lines);
+  printf("  device: %u samples dropped, %u frames overrun the TX buffer\n", d.dropped, d.overruns);
+  if (!d.frames) return 1;
+  if (out_path && !decoder.store.write(out_path)) return 1;
+  return 0;
+}
@@ -0,0 +1,374 @@
+// Binary capture store (.rfcap) for the host tools: the collector's four
+// columns at fixed width, with an index of activity runs and of fixed-size
+// row chunks, so tools can map a capture and go straight to the rows they
+// need instead of re-parsing CSV text.
+//
+// Layout, little-endian, every section 64-byte aligned:
+//   CaptureHeader
+//   activity names      char[CAPTURE_NAME_LEN] per activity id
+//   CaptureSegment[]    one per rep: consecutive rows with one activity and rep
+//   CaptureChunk[]      one per CAPTURE_CHUNK_ROWS rows
+//   timestamp_ms        uint32[rows]
+//   voltage             int32[rows], centi-millivolts (the collector prints
+//                       two decimals); CAPTURE_NO_VOLTAGE where empty
+//   rssi_dbm            int8[rows]
+//   activity_id         uint8[rows]
+// Chunks are fixed row ranges of each column, not interleaved blocks, so a
+// window that straddles a chunk boundary is still one contiguous span.
+
+#ifndef CAPTURE_STORE_H
+#define CAPTURE_STORE_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define CAPTURE_MAGIC "RFCAP\0\0\0"
+#define CAPTURE_VERSION 1
+#define CAPTURE_CHUNK_ROWS 4096      // 20.5 s at 200 Hz
+#define CAPTURE_MAX_ACTIVITIES 32    // CaptureChunk::activity_mask bits
+#define CAPTURE_NAME_LEN 16
+#define CAPTURE_NO_VOLTAGE INT32_MIN
+#define CAPTURE_REP_GAP_MS 1000      // The collector pauses 2 s between reps
+
+enum CaptureColumn { COL_TIMESTAMP, COL_VOLTAGE, COL_RSSI, COL_ACTIVITY, CAPTURE_COLUMNS };
+
+struct CaptureHeader {
+  char magic[8];
+  uint32_t version;
+  uint32_t chunk_rows;
+  uint64_t rows;
+  uint32_t chunks;
+  uint32_t segments;
+  uint32_t activities;  // Named ids: 0 .. activities - 1
+  uint32_t reserved;
+  uint64_t names_offset;
+  uint64_t segment_offset;
+  uint64_t chunk_offset;
+  uint64_t column_offset[CAPTURE_COLUMNS];
+};
+
+// One rep of one activity, numbered from 1 as the collector's "Rep: n/5"
+struct CaptureSegment {
+  uint64_t first_row;
+  uint64_t rows;
+  uint8_t activity;
+  uint8_t reserved;
+  uint16_t rep;
+  uint32_t reserved2;
+};
+
+struct CaptureChunk {
+  uint64_t first_row;
+  uint32_t rows;
+  uint32_t first_segment;   // Segment holding first_row
+  uint32_t t_first_ms, t_last_ms;
+  int32_t v_min, v_max;     // Centi-millivolts over rows with a voltage
+  int8_t rssi_min, rssi_max;
+  uint8_t reserved[2];
+  uint32_t activity_mask;   // Bit per activity id present
+};
+
+static_assert(sizeof(CaptureSegment) == 24, "CaptureSegment layout");
+static_assert(sizeof(CaptureChunk) == 40, "CaptureChunk layout");
+
+inline double capture_mv(int32_t centi_mv) {
+  return centi_mv == CAPTURE_NO_VOLTAGE ? NAN : centi_mv / 100.0;
+}
+
+// Read-only view of count elements inside the mapped file
+template <typename T>
+struct Span {
+  const T* data = nullptr;
+  size_t size = 0;
+  const T& operator[](size_t i) const { return data[i]; }
+  const T* begin() const { return data; }
+  const T* end() const { return data + size; }
+};
+
+// ============ WRITER ============
+// Collects rows, then writes the file with its index in one go
+class CaptureWriter {
+public:
+  // False for an id beyond CAPTURE_MAX_ACTIVITIES. A change of activity or
+  // rep starts a new segment.
+  bool add(uint32_t t_ms, int32_t centi_mv, int8_t rssi, int activity, int rep,
+           const char* name = nullptr) {
+    if (activity < 0 || activity >= CAPTURE_MAX_ACTIVITIES) return false;
+    t.push_back(t_ms);
+    v.push_back(centi_mv);
+    r.push_back(rssi);
+    a.push_back((uint8_t)activity);
+    p.push_back((uint16_t)rep);
+    if ((int)names.size() <= activity) names.resize(activity + 1);
+    if (name && names[activity].empty()) names[activity] = name;
+    return true;
+  }
+
+  uint64_t rows() const { return t.size(); }
+
+  bool write(const char* path) const {
+    std::vector<CaptureSegment> segments;
+    for (uint64_t i = 0; i < rows(); i++) {
+      if (i && a[i] == a[i - 1] && p[i] == p[i - 1]) {
+        segments.back().rows++;
+        continue;
+      }
+      CaptureSegment s = {};
+      s.first_row = i;
+      s.rows = 1;
+      s.activity = a[i];
+      s.rep = p[i];
+      segments.push_back(s);
+    }
+
+    std::vector<CaptureChunk> chunks;
+    uint32_t segment = 0;
+    for (uint64_t first = 0; first < rows(); first += CAPTURE_CHUNK_ROWS) {
+      CaptureChunk c = {};
+      c.first_row = first;
+      c.rows = (uint32_t)std::min<uint64_t>(CAPTURE_CHUNK_ROWS, rows() - first);
+      while (segments[segment].first_row + segments[segment].rows <= first) segment++;
+      c.first_segment = segment;
+      c.t_first_ms = t[first];
+      c.t_last_ms = t[first + c.rows - 1];
+      c.v_min = INT32_MAX;
+      c.v_max = INT32_MIN;
+      c.rssi_min = INT8_MAX;
+      c.rssi_max = INT8_MIN;
+      for (uint64_t i = first; i < first + c.rows; i++) {
+        if (v[i] != CAPTURE_NO_VOLTAGE) {
+          c.v_min = std::min(c.v_min, v[i]);
+          c.v_max = std::max(c.v_max, v[i]);
+        }
+        c.rssi_min = std::min(c.rssi_min, r[i]);
+        c.rssi_max = std::max(c.rssi_max, r[i]);
+        c.activity_mask |= 1u << a[i];
+      }
+      chunks.push_back(c);
+    }
+
+    CaptureHeader h = {};
+    memcpy(h.magic, CAPTURE_MAGIC, 8);
+    h.version = CAPTURE_VERSION;
+    h.chunk_rows = CAPTURE_CHUNK_ROWS;
+    h.rows = rows();
+    h.chunks = (uint32_t)chunks.size();
+    h.segments = (uint32_t)segments.size();
+    h.activities = (uint32_t)names.size();
+    uint64_t at = align(sizeof(h));
+    h.names_offset = at;
+    at = align(at + names.size() * CAPTURE_NAME_LEN);
+    h.segment_offset = at;
+    at = align(at + segments.size() * sizeof(CaptureSegment));
+    h.chunk_offset = at;
+    at = align(at + chunks.size() * sizeof(CaptureChunk));
+    const size_t widths[CAPTURE_COLUMNS] = {4, 4, 1, 1};
+    for (int c = 0; c < CAPTURE_COLUMNS; c++) {
+      h.column_offset[c] = at;
+      at = align(at + rows() * widths[c]);
+    }
+
+    std::vector<char> name_table(names.size() * CAPTURE_NAME_LEN, 0);
+    for (size_t i = 0; i < names.size(); i++) {
+      strncpy(&name_table[i * CAPTURE_NAME_LEN], names[i].c_str(), CAPTURE_NAME_LEN - 1);
+    }
+
+    FILE* f = fopen(path, "wb");
+    if (!f) {
+      fprintf(stderr, "capture: cannot write %s\n", path);
+      return false;
+    }
+    bool ok = put(f, 0, &h, sizeof(h)) &&
+              put(f, h.names_offset, name_table.data(), name_table.size()) &&
+              put(f, h.segment_offset, segments.data(), segments.size() * sizeof(CaptureSegment)) &&
+              put(f, h.chunk_offset, chunks.data(), chunks.size() * sizeof(CaptureChunk)) &&
+              put(f, h.column_offset[COL_TIMESTAMP], t.data(), rows() * 4) &&
+              put(f, h.column_offset[COL_VOLTAGE], v.data(), rows() * 4) &&
+              put(f, h.column_offset[COL_RSSI], r.data(), rows()) &&
+              put(f, h.column_offset[COL_ACTIVITY], a.data(), rows()) &&
+              put(f, at, nullptr, 0);
+    ok = fclose(f) == 0 && ok;
+    if (!ok) fprintf(stderr, "capture: error writing %s\n", path);
+    return ok;
+  }
+
+private:
+  static uint64_t align(uint64_t x) { return (x + 63) & ~(uint64_t)63; }
+
+  // Zero-pads from the current position up to offset, then writes
+  static bool put(FILE* f, uint64_t offset, const void* data, size_t n) {
+    static const char zeros[64] = {};
+    for (long pos = ftell(f); pos >= 0 && (uint64_t)pos < offset; pos = ftell(f)) {
+      if (fwrite(zeros, 1, std::min<uint64_t>(64, offset - pos), f) == 0) return false;
+    }
+    return n == 0 || fwrite(data, 1, n, f) == n;
+  }
+
+  std::vector<uint32_t> t;
+  std::vector<int32_t> v;
+  std::vector<int8_t> r;
+  std::vector<uint8_t> a;
+  std::vector<uint16_t> p;  // Rep per row; only splits segments
+  std::vector<std::string> names;
+};
+
+// Reps for rows that carry none, such as collector CSV. A rep ends at a
+// change of activity or where the timestamps jump more than gap_ms, the
+// collector's pause between reps; each activity's reps count up from 1.
+class CaptureRepCounter {
+public:
+  explicit CaptureRepCounter(uint32_t gap_ms = CAPTURE_REP_GAP_MS) : gap_ms(gap_ms) {}
+
+  int next(uint32_t t_ms, int activity) {
+    if (activity < 0 || activity >= CAPTURE_MAX_ACTIVITIES) return 0;
+    if (activity != last_activity || t_ms - last_t_ms > gap_ms) rep = ++reps[activity];
+    last_activity = activity;
+    last_t_ms = t_ms;
+    return rep;
+  }
+
+private:
+  uint32_t gap_ms;
+  int last_activity = -1;
+  uint32_t last_t_ms = 0;
+  int rep = 0;
+  uint16_t reps[CAPTURE_MAX_ACTIVITIES] = {};
+};
+
+// ============ READER ============
+// Maps a capture read-only; every accessor is a view into the mapping
+class CaptureStore {
+public:
+  CaptureStore() {}
+  CaptureStore(const CaptureStore&) = delete;
+  CaptureStore& operator=(const CaptureStore&) = delete;
+  ~CaptureStore() {
+    if (bytes) munmap((void*)bytes, length);
+  }
+
+  // True if path starts with the .rfcap magic; lets tools take either format
+  static bool is_capture(const char* path) {
+    char magic[8];
+    FILE* f = fopen(path, "rb");
+    if (!f) return false;
+    bool match = fread(magic, 1, 8, f) == 8 && !memcmp(magic, CAPTURE_MAGIC, 8);
+    fclose(f);
+    return match;
+  }
+
+  // Returns false (and prints why) if the file is missing or malformed
+  bool open(const char* path) {
+    int fd = ::open(path, O_RDONLY);
+    if (fd < 0) {
+      fprintf(stderr, "capture: cannot open %s\n", path);
+      return false;
+    }
+    struct stat st;
+    if (fstat(fd, &st) == 0 && (size_t)st.st_size >= sizeof(CaptureHeader)) {
+      void* p = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (p != MAP_FAILED) {
+        bytes = (const char*)p;
+        length = st.st_size;
+      }
+    }
+    ::close(fd);
+    if (!bytes || !valid()) {
+      fprintf(stderr, "capture: %s is not a version %d .rfcap file\n", path, CAPTURE_VERSION);
+      return false;
+    }
+    return true;
+  }
+
+  const CaptureHeader& header() const { return *(const CaptureHeader*)bytes; }
+  uint64_t rows() const { return header().rows; }
+  size_t file_bytes() const { return length; }
+
+  Span<CaptureSegment> segments() const {
+    return {(const CaptureSegment*)(bytes + header().segment_offset), header().segments};
+  }
+  Span<CaptureChunk> chunks() const {
+    return {(const CaptureChunk*)(bytes + header().chunk_offset), header().chunks};
+  }
+  const CaptureChunk& chunk_of(uint64_t row) const { return chunks()[row / header().chunk_rows]; }
+
+  Span<uint32_t> timestamps(uint64_t first, uint64_t count) const { return column<uint32_t>(COL_TIMESTAMP, first, count); }
+  Span<int32_t> voltage(uint64_t first, uint64_t count) const { return column<int32_t>(COL_VOLTAGE, first, count); }
+  Span<int8_t> rssi(uint64_t first, uint64_t count) const { return column<int8_t>(COL_RSSI, first, count); }
+  Span<uint8_t> activity(uint64_t first, uint64_t count) const { return column<uint8_t>(COL_ACTIVITY, first, count); }
+
+  int activities() const { return header().activities; }
+  std::string activity_name(int id) const {
+    if (id < 0 || id >= activities()) return "";
+    const char* name = bytes + header().names_offset + id * CAPTURE_NAME_LEN;
+    return std::string(name, strnlen(name, CAPTURE_NAME_LEN));
+  }
+  // Id for a name or a decimal id; -1 if neither
+  int activity_id(const char* name_or_id) const {
+    for (int id = 0; id < activities(); id++) {
+      if (activity_name(id) == name_or_id) return id;
+    }
+    char* end;
+    long id = strtol(name_or_id, &end, 10);
+    return *name_or_id && !*end && id >= 0 && id < activities() ? (int)id : -1;
+  }
+
+  // First rows of the window-long, step-apart windows lying wholly inside
+  // one run of activity (any if < 0), rep (any if 0). Only the segment
+  // table is read.
+  std::vector<uint64_t> windows(int activity, int rep, int window, int step) const {
+    std::vector<uint64_t> starts;
+    for (const CaptureSegment& s : segments()) {
+      if ((activity >= 0 && s.activity != activity) || (rep && s.rep != rep)) continue;
+      for (uint64_t first = s.first_row; first + window <= s.first_row + s.rows; first += step) {
+        starts.push_back(first);
+      }
+    }
+    return starts;
+  }
+
+private:
+  template <typename T>
+  Span<T> column(int c, uint64_t first, uint64_t count) const {
+    first = std::min(first, rows());
+    count = std::min(count, rows() - first);
+    return {(const T*)(bytes + header().column_offset[c]) + first, (size_t)count};
+  }
+
+  // Every section must lie inside the mapping
+  bool valid() const {
+    const CaptureHeader& h = header();
+    if (memcmp(h.magic, CAPTURE_MAGIC, 8) || h.version != CAPTURE_VERSION || !h.chunk_rows ||
+        h.activities > CAPTURE_MAX_ACTIVITIES || h.rows > length ||
+        h.chunks != (h.rows + h.chunk_rows - 1) / h.chunk_rows) {
+      return false;
+    }
+    const uint64_t sections[][2] = {
+      {h.names_offset, (uint64_t)h.activities * CAPTURE_NAME_LEN},
+      {h.segment_offset, (uint64_t)h.segments * sizeof(CaptureSegment)},
+      {h.chunk_offset, (uint64_t)h.chunks * sizeof(CaptureChunk)},
+      {h.column_offset[COL_TIMESTAMP], h.rows * 4},
+      {h.column_offset[COL_VOLTAGE], h.rows * 4},
+      {h.column_offset[COL_RSSI], h.rows},
+      {h.column_offset[COL_ACTIVITY], h.rows},
+    };
+    for (const auto& s : sections) {
+      if (s[0] % 8 || s[0] > length || s[1] > length - s[0]) return false;
+    }
+    return true;
+  }
+
+  const char* bytes = nullptr;
+  size_t length = 0;
+};
+
+#endif  // CAPTURE_STORE_H
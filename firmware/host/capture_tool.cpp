@@ -0,0 +1,285 @@
+// Converts collector CSV captures to the binary .rfcap store and queries
+// them through its index.
+//
+// Usage: capture_tool convert capture.csv capture.rfcap
+//        capture_tool info capture.rfcap
+//        capture_tool query capture.rfcap [--activity NAME|ID] [--rep N]
+//                           [--window N] [--overlap F] [--above-mv MV]
+//        capture_tool check
+// convert splits reps at the collector's pause between them (a timestamp
+// gap over CAPTURE_REP_GAP_MS). query lists the windows lying wholly inside
+// one rep (the pipeline's WINDOW_SIZE/OVERLAP by default), found from the
+// segment table alone. --above-mv keeps windows whose peak exceeds MV,
+// skipping windows whose chunks' v_max rule it out without reading their
+// samples. check converts a collector-shaped CSV (5 reps of two activities,
+// 2 s apart) and exits non-zero unless each --rep query returns that run.
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "capture_store.h"
+
+#define SHOW_WINDOWS 5
+
+// Splits a CSV line in place; trailing CR/LF are dropped
+static std::vector<char*> split(char* line) {
+  line[strcspn(line, "\r\n")] = 0;
+  std::vector<char*> fields{line};
+  for (char* p = line; (p = strchr(p, ',')); ) {
+    *p++ = 0;
+    fields.push_back(p);
+  }
+  return fields;
+}
+
+static int convert(const char* csv_path, const char* out_path) {
+  FILE* f = fopen(csv_path, "r");
+  if (!f) {
+    fprintf(stderr, "cannot open %s\n", csv_path);
+    return 1;
+  }
+  // Header: timestamp_ms,voltage_mv,rssi_dbm,activity_id,activity_name
+  char line[512];
+  int col[5] = {-1, -1, -1, -1, -1};
+  const char* names[5] = {"timestamp_ms", "voltage_mv", "rssi_dbm", "activity_id", "activity_name"};
+  if (fgets(line, sizeof(line), f)) {
+    std::vector<char*> header = split(line);
+    for (int c = 0; c < 5; c++) {
+      for (size_t i = 0; i < header.size(); i++) {
+        if (!strcmp(header[i], names[c])) col[c] = (int)i;
+      }
+    }
+  }
+  if (col[0] < 0 || col[1] < 0 || col[3] < 0) {
+    fprintf(stderr, "%s: header must name timestamp_ms, voltage_mv and activity_id\n", csv_path);
+    fclose(f);
+    return 1;
+  }
+
+  CaptureWriter writer;
+  CaptureRepCounter reps;
+  uint64_t line_no = 1, rounded = 0;
+  while (fgets(line, sizeof(line), f)) {
+    line_no++;
+    std::vector<char*> fields = split(line);
+    if (fields.size() == 1 && !fields[0][0]) continue;  // Blank
+    int last = std::max(std::max(col[0], col[1]), std::max(col[2], col[3]));
+    if ((int)fields.size() <= last) {
+      fprintf(stderr, "%s:%llu: expected %d fields\n", csv_path, (unsigned long long)line_no, last + 1);
+      fclose(f);
+      return 1;
+    }
+    int32_t centi = CAPTURE_NO_VOLTAGE;
+    if (fields[col[1]][0]) {
+      double mv = strtod(fields[col[1]], nullptr);
+      centi = (int32_t)llround(mv * 100);
+      if (fabs(mv * 100 - centi) > 1e-6) rounded++;
+    }
+    int rssi = col[2] >= 0 ? atoi(fields[col[2]]) : 0;
+    const char* name = col[4] >= 0 && col[4] < (int)fields.size() ? fields[col[4]] : nullptr;
+    uint32_t t_ms = (uint32_t)strtoul(fields[col[0]], nullptr, 10);
+    int activity = atoi(fields[col[3]]);
+    if (!writer.add(t_ms, centi, (int8_t)std::max(-128, std::min(127, rssi)), activity,
+                    reps.next(t_ms, activity), name)) {
+      fprintf(stderr, "%s:%llu: activity_id must be 0-%d\n", csv_path, (unsigned long long)line_no,
+              CAPTURE_MAX_ACTIVITIES - 1);
+      fclose(f);
+      return 1;
+    }
+  }
+  fclose(f);
+  if (!writer.write(out_path)) return 1;
+
+  CaptureStore store;
+  if (!store.open(out_path)) return 1;
+  struct stat st;
+  long long csv_bytes = stat(csv_path, &st) == 0 ? (long long)st.st_size : 0;
+  printf("%s: %llu rows, %u segments, %u chunks, %.1f MB (CSV %.1f MB, %.1fx smaller)\n",
+         out_path, (unsigned long long)store.rows(), store.header().segments,
+         store.header().chunks, store.file_bytes() / 1e6, csv_bytes / 1e6,
+         (double)csv_bytes / store.file_bytes());
+  if (rounded) {
+    printf("  %llu voltages had more than two decimals and were rounded to 0.01 mV\n",
+           (unsigned long long)rounded);
+  }
+  return 0;
+}
+
+static int info(const CaptureStore& store) {
+  const CaptureHeader& h = store.header();
+  Span<uint32_t> t = store.timestamps(0, store.rows());
+  printf("%llu rows, %.1f s, %u chunks of %u rows, %u segments, %.1f MB\n",
+         (unsigned long long)h.rows, h.rows ? (t[t.size - 1] - t[0]) / 1000.0 : 0.0, h.chunks,
+         h.chunk_rows, h.segments, store.file_bytes() / 1e6);
+  for (int id = 0; id < store.activities(); id++) {
+    uint64_t rows = 0;
+    int reps = 0;
+    for (const CaptureSegment& s : store.segments()) {
+      if (s.activity != id) continue;
+      rows += s.rows;
+      reps = std::max(reps, (int)s.rep);
+    }
+    if (rows) printf("  %2d %-16s %10llu rows in %d reps\n", id, store.activity_name(id).c_str(),
+                     (unsigned long long)rows, reps);
+  }
+  return 0;
+}
+
+static int query(const CaptureStore& store, int argc, char** argv) {
+  int activity = -1, rep = 0, window = 100;
+  double overlap = 0.5;
+  double above_mv = NAN;
+  for (int i = 0; i < argc; i++) {
+    const char* arg = argv[i];
+    const char* value = i + 1 < argc ? argv[++i] : nullptr;
+    if (!value) {
+      fprintf(stderr, "unknown or incomplete option %s\n", arg);
+      return 2;
+    }
+    else if (!strcmp(arg, "--activity")) {
+      activity = store.activity_id(value);
+      if (activity < 0) {
+        fprintf(stderr, "no activity %s in this capture\n", value);
+        return 2;
+      }
+    }
+    else if (!strcmp(arg, "--rep")) rep = atoi(value);
+    else if (!strcmp(arg, "--window")) window = atoi(value);
+    else if (!strcmp(arg, "--overlap")) overlap = atof(value);
+    else if (!strcmp(arg, "--above-mv")) above_mv = atof(value);
+    else {
+      fprintf(stderr, "unknown option %s\n", arg);
+      return 2;
+    }
+  }
+  int step = (int)(window * (1 - overlap));
+  if (window < 1 || step < 1) {
+    fprintf(stderr, "--window must be positive and --overlap below 1\n");
+    return 2;
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  std::vector<uint64_t> starts = store.windows(activity, rep, window, step);
+  std::vector<uint64_t> kept;
+  uint64_t rows_read = 0, pruned = 0;
+  int32_t threshold = std::isnan(above_mv) ? INT32_MIN : (int32_t)floor(above_mv * 100);
+  for (uint64_t first : starts) {
+    if (std::isnan(above_mv)) {
+      kept.push_back(first);
+      continue;
+    }
+    // The chunk index decides most windows; only straddling ones are read
+    bool possible = false;
+    for (uint64_t row = first; row < first + window; row += store.header().chunk_rows) {
+      possible |= store.chunk_of(row).v_max > threshold;
+    }
+    possible |= store.chunk_of(first + window - 1).v_max > threshold;
+    if (!possible) {
+      pruned++;
+      continue;
+    }
+    Span<int32_t> v = store.voltage(first, window);
+    rows_read += v.size;
+    for (int32_t x : v) {
+      if (x != CAPTURE_NO_VOLTAGE && x > threshold) {
+        kept.push_back(first);
+        break;
+      }
+    }
+  }
+  double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+
+  printf("%zu windows", kept.size());
+  if (!std::isnan(above_mv)) {
+    printf(" above %.2f mV (%zu candidates, %llu pruned by the chunk index, %llu rows read)",
+           above_mv, starts.size(), (unsigned long long)pruned, (unsigned long long)rows_read);
+  }
+  printf(" in %.0f us\n", us);
+  for (size_t i = 0; i < kept.size() && i < SHOW_WINDOWS; i++) {
+    uint64_t first = kept[i];
+    Span<int32_t> v = store.voltage(first, window);
+    double sum = 0;
+    for (int32_t x : v) sum += capture_mv(x);
+    uint8_t id = store.activity(first, 1)[0];
+    printf("  row %llu at %.3f s: %s, mean %.2f mV\n", (unsigned long long)first,
+           store.timestamps(first, 1)[0] / 1000.0, store.activity_name(id).c_str(), sum / window);
+  }
+  return 0;
+}
+
+// 5 reps each of IDLE then GAMING, 600 rows at 5 ms with 2 s between reps,
+// laid out as the collector writes them
+static int check() {
+  char dir[] = "/tmp/capture_check_XXXXXX";
+  if (!mkdtemp(dir)) {
+    fprintf(stderr, "cannot create a temporary directory\n");
+    return 1;
+  }
+  std::string csv_path = std::string(dir) + "/capture.csv";
+  std::string rfcap_path = std::string(dir) + "/capture.rfcap";
+  const int REPS = 5, ROWS = 600;
+  const char* names[2] = {"IDLE", "GAMING"};
+  FILE* f = fopen(csv_path.c_str(), "w");
+  if (!f) return 1;
+  fprintf(f, "timestamp_ms,voltage_mv,rssi_dbm,activity_id,activity_name\n");
+  uint32_t t = 5000;
+  uint64_t first_row[2][REPS];
+  uint64_t row = 0;
+  for (int id = 0; id < 2; id++) {
+    for (int rep = 0; rep < REPS; rep++) {
+      first_row[id][rep] = row;
+      for (int i = 0; i < ROWS; i++, row++, t += 5) {
+        fprintf(f, "%u,%d.%02d,-60,%d,%s\n", t, 1400 + id * 100 + rep, i % 100, id, names[id]);
+      }
+      t += 2000;
+    }
+  }
+  fclose(f);
+
+  bool ok = convert(csv_path.c_str(), rfcap_path.c_str()) == 0;
+  CaptureStore store;
+  ok = ok && store.open(rfcap_path.c_str());
+  if (ok && store.header().segments != 2 * REPS) {
+    printf("  %u segments, expected %d\n", store.header().segments, 2 * REPS);
+    ok = false;
+  }
+  for (int id = 0; ok && id < 2; id++) {
+    for (int rep = 1; rep <= REPS; rep++) {
+      std::vector<uint64_t> starts = store.windows(id, rep, 100, 50);
+      uint64_t lo = first_row[id][rep - 1], hi = lo + ROWS;
+      bool inside = !starts.empty();
+      for (uint64_t s : starts) inside &= s >= lo && s + 100 <= hi;
+      if (starts.size() != (ROWS - 100) / 50 + 1 || !inside) {
+        printf("  --activity %s --rep %d: %zu windows, expected %d in rows %llu-%llu\n", names[id], rep,
+               starts.size(), (ROWS - 100) / 50 + 1, (unsigned long long)lo, (unsigned long long)hi - 1);
+        ok = false;
+      }
+    }
+  }
+  remove(csv_path.c_str());
+  remove(rfcap_path.c_str());
+  rmdir(dir);
+  printf("%s\n", ok ? "reps check passed" : "reps check FAILED");
+  return ok ? 0 : 1;
+}
+
+int main(int argc, char** argv) {
+  if (argc >= 4 && !strcmp(argv[1], "convert")) return convert(argv[2], argv[3]);
+  if (argc == 2 && !strcmp(argv[1], "check")) return check();
+  if (argc >= 3 && (!strcmp(argv[1], "info") || !strcmp(argv[1], "query"))) {
+    CaptureStore store;
+    if (!store.open(argv[2])) return 1;
+    return !strcmp(argv[1], "info") ? info(store) : query(store, argc - 3, argv + 3);
+  }
+  fprintf(stderr, "usage: capture_tool convert capture.csv capture.rfcap\n"
+                  "       capture_tool info capture.rfcap\n"
+                  "       capture_tool query capture.rfcap [--activity NAME|ID] [--rep N] "
+                  "[--window N] [--overlap F] [--above-mv MV]\n"
+                  "       capture_tool check\n");
+  return 2;
+}
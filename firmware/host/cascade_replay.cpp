@@ -0,0 +1,194 @@
+// Replays windows through the IDLE early exit (2_tinyml_inference/
+// idle_cascade.h) ahead of the generated random forest, and reports how
+// often it settles a window, whether those windows are IDLE, what it does to
+// accuracy, and the time it saves per window.
+//
+// Usage: cascade_replay [X.npy] [--labels y.npy] [--trace CSV|RFCAP]
+//                       [--repeat N]
+// The labelled part classifies each row of X.npy with the forest alone and
+// with the cascade in front. The stream part runs ADC counts (a collector
+// trace, or the simulator's synthetic pattern: 20 s of each activity in
+// turn, IDLE first) through the RF detector's extractor, 100-sample windows every 10 samples, and times the
+// classify step with and without the cascade, and an eager extraction of
+// all 30 features (the TinyML detector's path, model not included) against
+// the cascade's 4. --repeat loops the stream for steadier timings.
+// The synthetic pattern is 120 s.
+// Exits non-zero if the cascade exits a labelled window that is not IDLE.
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "feature_extractor.h"
+#include "idle_cascade.h"
+#include "npy.h"
+#include "random_forest_model.h"
+#include "replay_source.h"
+
+#ifndef DEFAULT_FEATURES
+#define DEFAULT_FEATURES "data/processed/X.npy"
+#endif
+#ifndef DEFAULT_LABELS
+#define DEFAULT_LABELS "data/processed/y.npy"
+#endif
+
+#define WINDOW_SIZE 100
+#define HOP_SIZE 10
+
+typedef FeatureExtractor<WINDOW_SIZE, HOP_SIZE, FOREST_FEATURE_MASK | CASCADE_FEATURE_MASK> RfExtractor;
+typedef FeatureExtractor<WINDOW_SIZE, WINDOW_SIZE, FEATURE_MASK_ALL, false> FullExtractor;
+typedef FeatureExtractor<WINDOW_SIZE, WINDOW_SIZE, CASCADE_FEATURE_MASK, false> CascadeExtractor;
+
+// False if the files do not load; precise is false if an exit was not IDLE
+static bool labelled(const char* features_path, const char* labels_path, bool& precise) {
+  NpyMatrix X;
+  std::vector<int> labels;
+  if (!npy_load(features_path, X) || !npy_load_labels(labels_path, labels)) return false;
+  if (X.cols != FOREST_NUM_FEATURES || (int)labels.size() != X.rows) {
+    fprintf(stderr, "expected %d features per row and a label per row\n", FOREST_NUM_FEATURES);
+    return false;
+  }
+
+  int exits = 0, exits_idle = 0, idle = 0;
+  int forest_correct = 0, cascade_correct = 0, changed = 0;
+  for (int r = 0; r < X.rows; r++) {
+    const float* row = X.row(r);
+    int forest = classify_random_forest(row);
+    bool exit = cascade_accepts_idle(row);
+    int cls = exit ? 0 : forest;
+    idle += labels[r] == 0;
+    exits += exit;
+    exits_idle += exit && labels[r] == 0;
+    forest_correct += forest == labels[r];
+    cascade_correct += cls == labels[r];
+    changed += cls != forest;
+  }
+  printf("%d labelled windows, %d IDLE\n", X.rows, idle);
+  printf("  exits:    %d (%.1f%%), %d IDLE (%.1f%% precision), %.1f%% of IDLE windows\n", exits,
+         100.0 * exits / X.rows, exits_idle, exits ? 100.0 * exits_idle / exits : 0.0,
+         idle ? 100.0 * exits_idle / idle : 0.0);
+  printf("  accuracy: forest %.2f%%, cascade + forest %.2f%% (%d windows change class)\n",
+         100.0 * forest_correct / X.rows, 100.0 * cascade_correct / X.rows, changed);
+  precise = exits == exits_idle;
+  if (!precise) printf("  the cascade exited windows that are not IDLE\n");
+  return true;
+}
+
+struct Run {
+  double ns = 0;       // Per window, sample loop included
+  int windows = 0;
+  int exits = 0;
+  double computed = 0;  // Features per window
+  std::vector<uint8_t> classes;
+};
+
+// The RF detector's sample loop: add every sample and, at each hop, the
+// classify step with or without the cascade in front
+template <bool Cascade>
+static Run run_rf(const std::vector<float>& stream) {
+  static RfExtractor extractor;
+  extractor = RfExtractor();
+  Run run;
+  run.classes.reserve(stream.size() / HOP_SIZE);
+  long computed = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (float v : stream) {
+    extractor.add_sample(v);
+    if (!extractor.is_window_ready()) continue;
+    bool exit = Cascade && cascade_accepts_idle(extractor);
+    run.classes.push_back(exit ? 0 : classify_random_forest_lazy(extractor));
+    run.exits += exit;
+    computed += extractor.features_computed();
+  }
+  auto end = std::chrono::steady_clock::now();
+  run.windows = run.classes.size();
+  run.ns = std::chrono::duration<double, std::nano>(end - start).count() / run.windows;
+  run.computed = (double)computed / run.windows;
+  return run;
+}
+
+// Eager extraction per window, as the TinyML detector feeds its model
+template <typename Extractor>
+static double time_eager(const std::vector<float>& stream) {
+  static Extractor extractor;
+  extractor = Extractor();
+  int windows = 0;
+  volatile float sink = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (float v : stream) {
+    extractor.add_sample(v);
+    if (!extractor.is_window_ready()) continue;
+    float features[NUM_FEATURES];
+    extractor.extract_features(features);
+    sink = sink + features[0];
+    windows++;
+  }
+  auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::nano>(end - start).count() / windows;
+}
+
+static void streamed(const std::vector<uint16_t>& adc, const char* source, int repeat) {
+  std::vector<float> stream;
+  for (int i = 0; i < repeat; i++) {
+    for (uint16_t a : adc) stream.push_back((a / 4095.0f) * 3300.0f);
+  }
+  run_rf<false>(stream);  // Warm up
+  Run forest = run_rf<false>(stream);
+  Run cascade = run_rf<true>(stream);
+  int agree = 0;
+  for (int w = 0; w < forest.windows; w++) agree += forest.classes[w] == cascade.classes[w];
+
+  printf("%d streamed windows (%s, %d-sample windows every %d)\n", forest.windows, source,
+         WINDOW_SIZE, HOP_SIZE);
+  printf("  exits:    %d (%.1f%%), %.1f%% of windows classed as by the forest\n", cascade.exits,
+         100.0 * cascade.exits / cascade.windows, 100.0 * agree / forest.windows);
+  printf("  RF:       %8.0f ns per window, %.1f features (forest alone)\n", forest.ns,
+         forest.computed);
+  printf("            %8.0f ns per window, %.1f features (cascade + forest), %.1f%% saved\n",
+         cascade.ns, cascade.computed, 100.0 * (forest.ns - cascade.ns) / forest.ns);
+
+  time_eager<FullExtractor>(stream);
+  double full = time_eager<FullExtractor>(stream);
+  double first = time_eager<CascadeExtractor>(stream);
+  double blended = (cascade.exits * first + (cascade.windows - cascade.exits) * (first + full)) /
+                   cascade.windows;
+  printf("  TinyML:   %8.0f ns per window for all %d features, %.0f ns for the cascade's %d\n", full,
+         NUM_FEATURES, first, __builtin_popcount(CASCADE_FEATURE_MASK));
+  printf("            %8.0f ns per window at this exit rate, %.1f%% saved before the model\n",
+         blended, 100.0 * (full - blended) / full);
+}
+
+int main(int argc, char** argv) {
+  const char* features_path = DEFAULT_FEATURES;
+  const char* labels_path = DEFAULT_LABELS;
+  const char* trace = nullptr;
+  int repeat = 5;
+  for (int i = 1; i < argc; i++) {
+    const char* arg = argv[i];
+    bool has_value = i + 1 < argc;
+    if (!strcmp(arg, "--labels") && has_value) labels_path = argv[++i];
+    else if (!strcmp(arg, "--trace") && has_value) trace = argv[++i];
+    else if (!strcmp(arg, "--repeat") && has_value) repeat = atoi(argv[++i]);
+    else if (arg[0] != '-') features_path = arg;
+    else {
+      fprintf(stderr, "usage: cascade_replay [X.npy] [--labels y.npy] [--trace CSV|RFCAP] [--repeat N]\n");
+      return 2;
+    }
+  }
+  if (repeat < 1) repeat = 1;
+
+  bool precise = false;
+  if (!labelled(features_path, labels_path, precise)) return 1;
+
+  std::vector<uint16_t> adc;
+  if (trace && !load_replay_adc(trace, adc)) return 1;
+  if (!trace) adc = activity_replay_adc(120, 1);
+  if ((int)adc.size() * repeat < WINDOW_SIZE) {
+    fprintf(stderr, "trace shorter than one window\n");
+    return 1;
+  }
+  streamed(adc, trace ? trace : "synthetic", repeat);
+  return precise ? 0 : 1;
+}
@@ -0,0 +1,190 @@
+// Replays labelled feature windows through the generated random forest and
+// the temporal decoder (2_tinyml_inference/temporal_decoder.h), and reports
+// what the decoder changes: mitigation triggers per hour, how many of them
+// were spurious, per-window accuracy, and the decision latency it adds at
+// each true activity change.
+//
+// Usage: decoder_replay [X.npy] [--labels y.npy] [--hop-ms MS] [--every N]
+//                       [--window N --votes K] [--sweep]
+// Rows are taken as consecutive windows HOP_MS apart: data/processed rows
+// are 50-sample steps at 200 Hz, so 250 ms. --every 2 keeps every second
+// row, as the TinyML detector's non-overlapping 100-sample windows (the RF
+// detector votes every 50 ms). --sweep prints a row per window size and
+// vote count instead.
+// A trigger is a change to a class other than IDLE, as in the sketches; it
+// is spurious if the label at that window is another class. "+lat ms" is
+// the mean delay the decoder adds over the raw classes to reach each new
+// activity, "max ms" the longest delay from the change itself.
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "npy.h"
+#include "random_forest_model.h"
+#include "temporal_decoder.h"
+
+#ifndef DEFAULT_FEATURES
+#define DEFAULT_FEATURES "data/processed/X.npy"
+#endif
+#ifndef DEFAULT_LABELS
+#define DEFAULT_LABELS "data/processed/y.npy"
+#endif
+
+struct Outcome {
+  int triggers = 0;
+  int spurious = 0;
+  int correct = 0;          // Windows whose class matches the label
+  int transitions = 0;      // True activity changes
+  int missed = 0;           // ... never reached before the next one
+  double delay_sum = 0;     // Windows from each change to its first output
+  int delay_max = 0;
+};
+
+// classes: one per window, raw or decoded
+static Outcome score(const std::vector<int>& classes, const std::vector<int>& labels) {
+  Outcome o;
+  size_t n = classes.size();
+  for (size_t w = 0; w < n; w++) {
+    o.correct += classes[w] == labels[w];
+    if (w && classes[w] != classes[w - 1] && classes[w]) {
+      o.triggers++;
+      o.spurious += classes[w] != labels[w];
+    }
+    if (!w || labels[w] == labels[w - 1]) continue;
+    o.transitions++;
+    size_t hit = w;
+    while (hit < n && labels[hit] == labels[w] && classes[hit] != labels[w]) hit++;
+    if (hit == n || labels[hit] != labels[w]) {
+      o.missed++;
+      continue;
+    }
+    o.delay_sum += hit - w;
+    if ((int)(hit - w) > o.delay_max) o.delay_max = hit - w;
+  }
+  return o;
+}
+
+template <int N>
+static std::vector<int> decode(const std::vector<int>& raw, int votes) {
+  TemporalDecoder<N> decoder(votes);
+  std::vector<int> out;
+  for (int cls : raw) {
+    decoder.update(cls);
+    out.push_back(decoder.current());
+  }
+  return out;
+}
+
+static bool decode_n(const std::vector<int>& raw, int window, int votes, std::vector<int>& out) {
+  switch (window) {
+    case 3: out = decode<3>(raw, votes); break;
+    case 4: out = decode<4>(raw, votes); break;
+    case 5: out = decode<5>(raw, votes); break;
+    case 6: out = decode<6>(raw, votes); break;
+    case 8: out = decode<8>(raw, votes); break;
+    case 10: out = decode<10>(raw, votes); break;
+    case 12: out = decode<12>(raw, votes); break;
+    case 16: out = decode<16>(raw, votes); break;
+    case 20: out = decode<20>(raw, votes); break;
+    case 24: out = decode<24>(raw, votes); break;
+    case 32: out = decode<32>(raw, votes); break;
+    case 40: out = decode<40>(raw, votes); break;
+    default: return false;
+  }
+  return true;
+}
+
+static const int WINDOW_SIZES[] = {3, 4, 5, 6, 8, 10, 12, 16, 20, 24, 32, 40};
+
+static void print_row(const char* what, const Outcome& o, size_t windows, double hop_ms,
+                      const Outcome* raw) {
+  double hours = windows * hop_ms / 3.6e6;
+  int reached = o.transitions - o.missed;
+  printf("%-12s %9.0f %8d %8.1f%% %7.1f%% ", what, o.triggers / hours, o.triggers,
+         o.triggers ? 100.0 * o.spurious / o.triggers : 0.0, 100.0 * o.correct / windows);
+  if (!reached) {
+    printf("%9s %9s %6d\n", "-", "-", o.missed);
+    return;
+  }
+  double mean = o.delay_sum / reached * hop_ms;
+  if (raw && raw->transitions - raw->missed) {
+    mean -= raw->delay_sum / (raw->transitions - raw->missed) * hop_ms;
+  }
+  printf("%9.0f %9.0f %6d\n", mean, o.delay_max * hop_ms, o.missed);
+}
+
+int main(int argc, char** argv) {
+  const char* features_path = DEFAULT_FEATURES;
+  const char* labels_path = DEFAULT_LABELS;
+  double hop_ms = 250;
+  int every = 1;
+  int window = 8, votes = 7;
+  bool sweep = false;
+  for (int i = 1; i < argc; i++) {
+    const char* arg = argv[i];
+    bool has_value = i + 1 < argc;
+    if (!strcmp(arg, "--sweep")) sweep = true;
+    else if (!strcmp(arg, "--labels") && has_value) labels_path = argv[++i];
+    else if (!strcmp(arg, "--hop-ms") && has_value) hop_ms = atof(argv[++i]);
+    else if (!strcmp(arg, "--every") && has_value) every = atoi(argv[++i]);
+    else if (!strcmp(arg, "--window") && has_value) window = atoi(argv[++i]);
+    else if (!strcmp(arg, "--votes") && has_value) votes = atoi(argv[++i]);
+    else if (arg[0] != '-') features_path = arg;
+    else {
+      fprintf(stderr, "usage: decoder_replay [X.npy] [--labels y.npy] [--hop-ms MS] [--every N] "
+                      "[--window N --votes K] [--sweep]\n");
+      return 2;
+    }
+  }
+
+  NpyMatrix X;
+  std::vector<int> labels;
+  if (!npy_load(features_path, X) || !npy_load_labels(labels_path, labels)) return 1;
+  if (X.cols != FOREST_NUM_FEATURES || (int)labels.size() != X.rows || every < 1 ||
+      X.rows < 2 * every) {
+    fprintf(stderr, "expected %d features per row and a label per row\n", FOREST_NUM_FEATURES);
+    return 1;
+  }
+
+  std::vector<int> raw, truth;
+  for (int r = 0; r < X.rows; r += every) {
+    if (labels[r] < 0 || labels[r] >= DECODER_MAX_CLASSES) {
+      fprintf(stderr, "label %d out of range\n", labels[r]);
+      return 1;
+    }
+    raw.push_back(classify_random_forest(X.row(r)));
+    truth.push_back(labels[r]);
+  }
+  size_t windows = raw.size();
+  hop_ms *= every;
+  Outcome raw_outcome = score(raw, truth);
+
+  printf("%zu windows, %.1f min at %.0f ms, %d activity changes\n", windows,
+         windows * hop_ms / 60000, hop_ms, raw_outcome.transitions);
+  printf("%-12s %9s %8s %9s %8s %9s %9s %6s\n", "decoder", "trig/h", "triggers", "spurious",
+         "acc", "+lat ms", "max ms", "missed");
+  print_row("raw", raw_outcome, windows, hop_ms, nullptr);
+
+  std::vector<int> decoded;
+  char name[32];
+  if (!sweep) {
+    if (votes < 1 || votes > window || !decode_n(raw, window, votes, decoded)) {
+      fprintf(stderr, "--window must be one of 3-6, 8, 10, 12, 16, 20, 24, 32, 40, "
+                      "with 1 <= --votes <= --window\n");
+      return 2;
+    }
+    snprintf(name, sizeof(name), "%d of %d", votes, window);
+    print_row(name, score(decoded, truth), windows, hop_ms, &raw_outcome);
+    return 0;
+  }
+  for (int n : WINDOW_SIZES) {
+    for (int k = (n + 2) / 2; k <= n; k++) {
+      decode_n(raw, n, k, decoded);
+      snprintf(name, sizeof(name), "%d of %d", k, n);
+      print_row(name, score(decoded, truth), windows, hop_ms, &raw_outcome);
+    }
+  }
+  return 0;
+}
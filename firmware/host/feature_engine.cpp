@@ -0,0 +1,585 @@
+// Offline feature extraction for raw collector captures: the 30 features of
+// ml_training_pipeline.py's FeatureExtractor.process_dataset(), in double
+// precision, with windows sharded across threads by work stealing. Writes
+// X.npy (float64, windows x 30) and y.npy (int64, activity_id of each
+// window's first row), as the pipeline does.
+//
+// Usage: feature_engine capture.csv [--out-dir DIR] [--threads N]
+//                       [--window N] [--overlap F] [--grain N] [--scaling]
+// capture.csv is the collector's CSV, header included
+// (timestamp_ms,voltage_mv,rssi_dbm,activity_id,activity_name), or the
+// same converted to .rfcap by capture_tool. --out-dir
+// defaults to data/processed. --scaling re-runs extraction on 1, 2, 4 ...
+// --threads threads and reports windows/s for each.
+//
+// Windows follow the pipeline's loop exactly: starts 0, step, 2*step ...
+// below rows - window, step = int(window * (1 - overlap)). Windows with a
+// missing voltage get NaN in every feature.
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "capture_store.h"
+#include "npy.h"
+
+#define NUM_FEATURES 30
+#define PARSE_CHUNK (4 << 20)  // Bytes of CSV per parse task
+
+typedef std::chrono::steady_clock Clock;
+
+static double seconds_since(Clock::time_point start) {
+  return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+// ============ WORK STEALING ============
+// Each worker owns a contiguous range of task indices and takes grains from
+// its front. An idle worker steals the back half of the fullest victim's
+// range, so uneven tasks (long CSV lines, slow cores) balance without a
+// shared queue.
+class WorkStealingPool {
+public:
+  explicit WorkStealingPool(int threads) : workers(threads) {}
+
+  int size() const { return (int)workers.size(); }
+  size_t steals() const { return steal_count; }
+
+  // Calls body(begin, end, worker) over disjoint ranges covering [0, count)
+  void parallel_for(size_t count, size_t grain,
+                    const std::function<void(size_t, size_t, int)>& body) {
+    int n = size();
+    grain = std::max<size_t>(grain, 1);
+    for (int w = 0; w < n; w++) {
+      workers[w].begin = count * w / n;
+      workers[w].end = count * (w + 1) / n;
+    }
+    std::vector<std::thread> threads;
+    for (int w = 1; w < n; w++) threads.emplace_back([&, w] { run(w, grain, body); });
+    run(0, grain, body);
+    for (std::thread& t : threads) t.join();
+  }
+
+private:
+  struct alignas(64) Worker {
+    std::mutex lock;
+    size_t begin = 0, end = 0;
+  };
+
+  void run(int self, size_t grain, const std::function<void(size_t, size_t, int)>& body) {
+    Worker& mine = workers[self];
+    for (;;) {
+      size_t begin, end;
+      {
+        std::lock_guard<std::mutex> hold(mine.lock);
+        begin = mine.begin;
+        end = std::min(mine.end, begin + grain);
+        mine.begin = end;
+      }
+      if (begin < end) {
+        body(begin, end, self);
+        continue;
+      }
+      if (!steal(self)) return;
+    }
+  }
+
+  // Moves the back half of the victim with the most work left into self's
+  // range; false when every range is empty
+  bool steal(int self) {
+    int victim = -1;
+    size_t most = 0;
+    for (int w = 0; w < size(); w++) {
+      if (w == self) continue;
+      std::lock_guard<std::mutex> hold(workers[w].lock);
+      size_t left = workers[w].end - workers[w].begin;
+      if (left > most) {
+        most = left;
+        victim = w;
+      }
+    }
+    if (victim < 0) return false;
+
+    size_t begin, end;
+    {
+      std::lock_guard<std::mutex> hold(workers[victim].lock);
+      Worker& v = workers[victim];
+      if (v.begin >= v.end) return true;  // Drained meanwhile: look again
+      size_t mid = v.begin + (v.end - v.begin) / 2;
+      begin = mid;
+      end = v.end;
+      v.end = mid;
+      if (begin == end) return true;
+    }
+    std::lock_guard<std::mutex> hold(workers[self].lock);
+    workers[self].begin = begin;
+    workers[self].end = end;
+    steal_count++;
+    return true;
+  }
+
+  std::vector<Worker> workers;
+  std::atomic<size_t> steal_count{0};
+};
+
+// ============ CSV ============
+struct Capture {
+  std::vector<double> voltage;    // voltage_mv, NaN where empty
+  std::vector<int64_t> activity;  // activity_id
+};
+
+class MappedFile {
+public:
+  explicit MappedFile(const char* path) {
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return;
+    struct stat st;
+    if (fstat(fd, &st) == 0 && st.st_size > 0) {
+      void* p = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (p != MAP_FAILED) {
+        bytes = (const char*)p;
+        length = st.st_size;
+        madvise(p, length, MADV_SEQUENTIAL);
+      }
+    }
+    close(fd);
+  }
+  ~MappedFile() {
+    if (bytes) munmap((void*)bytes, length);
+  }
+  const char* bytes = nullptr;
+  size_t length = 0;
+};
+
+// Zero-based index of name among the header's comma-separated columns
+static int column_index(const char* line, const char* end, const char* name) {
+  size_t len = strlen(name);
+  int index = 0;
+  for (const char* p = line; p <= end; index++) {
+    const char* field_end = std::find(p, end, ',');
+    const char* trimmed = field_end;
+    while (trimmed > p && (trimmed[-1] == '\r' || trimmed[-1] == ' ')) trimmed--;
+    if ((size_t)(trimmed - p) == len && !memcmp(p, name, len)) return index;
+    p = field_end + 1;
+  }
+  return -1;
+}
+
+static bool blank(const char* p, const char* end) {
+  for (; p < end; p++) {
+    if (*p != '\r' && *p != ' ' && *p != '\t') return false;
+  }
+  return true;
+}
+
+// Parses the voltage_mv and activity_id columns in parallel: one pass
+// counts the rows of each chunk, the next parses each chunk into its slice
+// of the output. Blank lines are skipped, as pandas does.
+static bool parse_capture(const MappedFile& file, WorkStealingPool& pool, Capture& out) {
+  const char* data = file.bytes;
+  const char* eof = data + file.length;
+  const char* header_end = std::find(data, eof, '\n');
+  int v_col = column_index(data, header_end, "voltage_mv");
+  int a_col = column_index(data, header_end, "activity_id");
+  if (v_col < 0 || a_col < 0) {
+    fprintf(stderr, "header must name voltage_mv and activity_id columns\n");
+    return false;
+  }
+
+  // Chunk boundaries fall just after a newline
+  std::vector<const char*> bounds{std::min(header_end + 1, eof)};
+  while (bounds.back() < eof) {
+    const char* next = bounds.back() + std::min<size_t>(PARSE_CHUNK, eof - bounds.back());
+    next = next < eof ? std::find(next, eof, '\n') : eof;
+    bounds.push_back(next < eof ? next + 1 : eof);
+  }
+  size_t chunks = bounds.size() - 1;
+
+  auto for_each_line = [&](size_t c, const std::function<void(const char*, const char*)>& line) {
+    for (const char* p = bounds[c]; p < bounds[c + 1];) {
+      const char* nl = std::find(p, bounds[c + 1], '\n');
+      if (!blank(p, nl)) line(p, nl);
+      p = nl + 1;
+    }
+  };
+
+  std::vector<size_t> first_row(chunks + 1, 0);
+  pool.parallel_for(chunks, 1, [&](size_t begin, size_t end, int) {
+    for (size_t c = begin; c < end; c++) {
+      size_t rows = 0;
+      for_each_line(c, [&](const char*, const char*) { rows++; });
+      first_row[c + 1] = rows;
+    }
+  });
+  for (size_t c = 0; c < chunks; c++) first_row[c + 1] += first_row[c];
+  out.voltage.resize(first_row[chunks]);
+  out.activity.resize(first_row[chunks]);
+
+  std::atomic<size_t> bad_row{std::numeric_limits<size_t>::max()};
+  pool.parallel_for(chunks, 1, [&](size_t begin, size_t end, int) {
+    for (size_t c = begin; c < end; c++) {
+      size_t row = first_row[c];
+      for_each_line(c, [&](const char* p, const char* nl) {
+        double voltage = NAN;
+        bool have_activity = false;
+        for (int col = 0; p <= nl && col <= std::max(v_col, a_col); col++) {
+          const char* field_end = std::find(p, nl, ',');
+          if (col == v_col && !blank(p, field_end)) {
+            voltage = strtod(p, nullptr);
+          } else if (col == a_col && !blank(p, field_end)) {
+            out.activity[row] = strtoll(p, nullptr, 10);
+            have_activity = true;
+          }
+          p = field_end + 1;
+        }
+        out.voltage[row] = voltage;
+        if (!have_activity) {
+          size_t seen = bad_row.load();
+          while (row < seen && !bad_row.compare_exchange_weak(seen, row)) {}
+        }
+        row++;
+      });
+    }
+  });
+  if (bad_row.load() != std::numeric_limits<size_t>::max()) {
+    fprintf(stderr, "data row %zu has no activity_id\n", bad_row.load() + 1);
+    return false;
+  }
+  return true;
+}
+
+// Voltage and activity columns of a .rfcap capture
+static bool load_store(const char* path, WorkStealingPool& pool, Capture& out) {
+  CaptureStore store;
+  if (!store.open(path)) return false;
+  Span<int32_t> voltage = store.voltage(0, store.rows());
+  Span<uint8_t> activity = store.activity(0, store.rows());
+  out.voltage.resize(store.rows());
+  out.activity.resize(store.rows());
+  pool.parallel_for(store.rows(), 1 << 16, [&](size_t begin, size_t end, int) {
+    for (size_t i = begin; i < end; i++) {
+      out.voltage[i] = capture_mv(voltage[i]);
+      out.activity[i] = activity[i];
+    }
+  });
+  return true;
+}
+
+// ============ FEATURES ============
+// numpy/scipy/pywt semantics throughout: population std (ddof=0), linear
+// percentiles, biased skew and Fisher kurtosis (NaN for a constant window,
+// as scipy), |DFT| bins 0..n/2-1, pywt.wavedec(x, 'db4', level=3) in
+// 'symmetric' mode.
+
+#define DB4_TAPS 8
+
+static const double kDb4Lo[DB4_TAPS] = {
+  -0.010597401784997278, 0.032883011666982945, 0.030841381835986965,
+  -0.18703481171888114, -0.02798376941698385, 0.6308807679295904,
+  0.7148465705525415, 0.23037781330885523
+};
+static const double kDb4Hi[DB4_TAPS] = {
+  -0.23037781330885523, 0.7148465705525415, -0.6308807679295904,
+  -0.02798376941698385, 0.18703481171888114, 0.030841381835986965,
+  -0.032883011666982945, -0.010597401784997278
+};
+
+// Per-window-size DFT basis (bins x n, row-major), shared read-only by
+// every worker
+struct Tables {
+  explicit Tables(int n) : n(n), cos_t(n / 2 * n), sin_t(n / 2 * n) {
+    for (int k = 0; k < n / 2; k++) {
+      for (int i = 0; i < n; i++) {
+        cos_t[k * n + i] = cos(2 * M_PI * ((long)k * i % n) / n);
+        sin_t[k * n + i] = sin(2 * M_PI * ((long)k * i % n) / n);
+      }
+    }
+  }
+  int n;
+  std::vector<double> cos_t, sin_t;
+};
+
+// Per-worker buffers
+struct Scratch {
+  explicit Scratch(int n) : sorted(n), diff(n), mag(n / 2), a(n), b(n) {}
+  std::vector<double> sorted, diff, mag, a, b;
+};
+
+static double mean_of(const double* x, int n) {
+  double sum = 0;
+  for (int i = 0; i < n; i++) sum += x[i];
+  return sum / n;
+}
+
+static double std_of(const double* x, int n) {
+  double mean = mean_of(x, n);
+  double var = 0;
+  for (int i = 0; i < n; i++) var += (x[i] - mean) * (x[i] - mean);
+  return sqrt(var / n);
+}
+
+static double percentile(const std::vector<double>& sorted, double q) {
+  double pos = q * (sorted.size() - 1);
+  size_t lo = (size_t)pos;
+  double frac = pos - lo;
+  if (lo + 1 >= sorted.size()) return sorted.back();
+  return sorted[lo] + (sorted[lo + 1] - sorted[lo]) * frac;
+}
+
+// One level of pywt.dwt(x, 'db4', mode='symmetric'); returns the length
+static int dwt_level(const double* x, int n, double* approx, double* detail) {
+  int out = (n + DB4_TAPS - 1) / 2;
+  for (int o = 0; o < out; o++) {
+    int i = 2 * o + 1;
+    double a = 0, d = 0;
+    for (int j = 0; j < DB4_TAPS; j++) {
+      int idx = i - j;
+      while (idx < 0 || idx >= n) idx = idx < 0 ? -idx - 1 : 2 * n - idx - 1;
+      a += kDb4Lo[j] * x[idx];
+      d += kDb4Hi[j] * x[idx];
+    }
+    approx[o] = a;
+    detail[o] = d;
+  }
+  return out;
+}
+
+static void extract_window(const double* x, const Tables& t, Scratch& s, double* out) {
+  int n = t.n;
+  for (int i = 0; i < n; i++) {
+    if (std::isnan(x[i])) {
+      std::fill(out, out + NUM_FEATURES, NAN);
+      return;
+    }
+  }
+
+  // Time domain (0-13)
+  double mean = mean_of(x, n);
+  double m2 = 0, m3 = 0, m4 = 0;
+  for (int i = 0; i < n; i++) {
+    double d = x[i] - mean;
+    m2 += d * d;
+    m3 += d * d * d;
+    m4 += d * d * d * d;
+  }
+  m2 /= n;
+  m3 /= n;
+  m4 /= n;
+  // scipy.stats treats m2 below its float64 resolution as a constant window
+  bool constant = m2 <= (1e-15 * mean) * (1e-15 * mean);
+
+  std::copy(x, x + n, s.sorted.begin());
+  std::sort(s.sorted.begin(), s.sorted.end());
+  double min = s.sorted.front(), max = s.sorted.back();
+
+  for (int i = 0; i < n - 1; i++) s.diff[i] = x[i + 1] - x[i];
+  double abs_diff_sum = 0, abs_diff_max = 0;
+  for (int i = 0; i < n - 1; i++) {
+    abs_diff_sum += fabs(s.diff[i]);
+    abs_diff_max = std::max(abs_diff_max, fabs(s.diff[i]));
+  }
+
+  out[0] = mean;
+  out[1] = sqrt(m2);
+  out[2] = m2;
+  out[3] = min;
+  out[4] = max;
+  out[5] = max - min;
+  out[6] = percentile(s.sorted, 0.5);
+  out[7] = constant ? NAN : m3 / pow(m2, 1.5);
+  out[8] = constant ? NAN : m4 / (m2 * m2) - 3;
+  out[9] = percentile(s.sorted, 0.25);
+  out[10] = percentile(s.sorted, 0.75);
+  out[11] = abs_diff_sum / (n - 1);
+  out[12] = std_of(s.diff.data(), n - 1);
+  out[13] = abs_diff_max;
+
+  // Frequency domain (14-23): direct DFT against the shared basis
+  int bins = n / 2;
+  for (int k = 0; k < bins; k++) {
+    const double* c = &t.cos_t[k * n];
+    const double* sn = &t.sin_t[k * n];
+    double re = 0, im = 0;
+    for (int i = 0; i < n; i++) {
+      re += x[i] * c[i];
+      im += x[i] * sn[i];
+    }
+    s.mag[k] = sqrt(re * re + im * im);
+  }
+  const double* mag = s.mag.data();
+  double total = 0, weighted = 0, low = 0, mid = 0, high = 0;
+  int peak = 0;
+  for (int k = 0; k < bins; k++) {
+    total += mag[k];
+    weighted += k * mag[k];
+    if (k < 10) low += mag[k];
+    else if (k < 50) mid += mag[k];
+    else high += mag[k];
+    if (mag[k] > mag[peak]) peak = k;
+  }
+  int rolloff = 0;
+  double cumulative = 0;
+  for (; rolloff < bins; rolloff++) {
+    cumulative += mag[rolloff];
+    if (cumulative >= 0.85 * total) break;
+  }
+  double entropy = 0;
+  for (int k = 0; k < bins; k++) {
+    double p = mag[k] / total;
+    entropy -= p * log2(p + 1e-10);
+  }
+  out[14] = peak;
+  out[15] = mag[peak];
+  out[16] = total / bins;
+  out[17] = std_of(mag, bins);
+  out[18] = low;
+  out[19] = mid;
+  out[20] = high;
+  out[21] = weighted / total;
+  out[22] = rolloff;
+  out[23] = entropy;
+
+  // Wavelet (24-29): approximations alternate between a and b; details
+  // reuse the difference buffer, which is free by now
+  double* a = s.a.data();
+  double* b = s.b.data();
+  double* detail = s.diff.data();
+  int l1 = dwt_level(x, n, a, detail);
+  double std_d1 = std_of(detail, l1);
+  int l2 = dwt_level(a, l1, b, detail);
+  double std_d2 = std_of(detail, l2), sum_d2 = 0;
+  for (int i = 0; i < l2; i++) sum_d2 += fabs(detail[i]);
+  int l3 = dwt_level(b, l2, a, detail);
+  double std_d3 = std_of(detail, l3), sum_d3 = 0;
+  for (int i = 0; i < l3; i++) sum_d3 += fabs(detail[i]);
+  out[24] = std_of(a, l3);
+  out[25] = std_d3;
+  out[26] = std_d2;
+  out[27] = std_d1;
+  out[28] = sum_d3;
+  out[29] = sum_d2;
+}
+
+// ============ ENGINE ============
+struct Run {
+  double seconds;
+  size_t steals;
+};
+
+static Run extract_all(const Capture& capture, int window, int step, size_t windows, int threads,
+                       size_t grain, std::vector<double>& X, std::vector<int64_t>& y) {
+  Tables tables(window);
+  std::vector<Scratch> scratch(threads, Scratch(window));
+  WorkStealingPool pool(threads);
+  auto start = Clock::now();
+  pool.parallel_for(windows, grain, [&](size_t begin, size_t end, int worker) {
+    for (size_t w = begin; w < end; w++) {
+      size_t first = w * step;
+      extract_window(&capture.voltage[first], tables, scratch[worker], &X[w * NUM_FEATURES]);
+      y[w] = capture.activity[first];
+    }
+  });
+  return {seconds_since(start), pool.steals()};
+}
+
+int main(int argc, char** argv) {
+  const char* csv_path = nullptr;
+  std::string out_dir = "data/processed";
+  int threads = std::max(1u, std::thread::hardware_concurrency());
+  int window = 100;        // WINDOW_SIZE in ml_training_pipeline.py
+  double overlap = 0.5;    // OVERLAP
+  size_t grain = 64;
+  bool scaling = false;
+  for (int i = 1; i < argc; i++) {
+    const char* arg = argv[i];
+    const char* value = i + 1 < argc ? argv[i + 1] : nullptr;
+    if (!strcmp(arg, "--scaling")) scaling = true;
+    else if (arg[0] != '-' && !csv_path) csv_path = arg;
+    else if (!value) {
+      fprintf(stderr, "unknown or incomplete option %s\n", arg);
+      return 2;
+    }
+    else if (!strcmp(arg, "--out-dir")) out_dir = argv[++i];
+    else if (!strcmp(arg, "--threads")) threads = std::max(1, atoi(argv[++i]));
+    else if (!strcmp(arg, "--window")) window = atoi(argv[++i]);
+    else if (!strcmp(arg, "--overlap")) overlap = atof(argv[++i]);
+    else if (!strcmp(arg, "--grain")) grain = std::max(1, atoi(argv[++i]));
+    else {
+      fprintf(stderr, "unknown option %s\n", arg);
+      return 2;
+    }
+  }
+  int step = (int)(window * (1 - overlap));
+  if (!csv_path || window < 2 * DB4_TAPS || step < 1) {
+    fprintf(stderr, "usage: feature_engine capture.csv [--out-dir DIR] [--threads N] "
+                    "[--window N>=16] [--overlap F<1] [--grain N] [--scaling]\n");
+    return 2;
+  }
+
+  WorkStealingPool pool(threads);
+  Capture capture;
+  auto load_start = Clock::now();
+  size_t bytes = 0;
+  if (CaptureStore::is_capture(csv_path)) {
+    if (!load_store(csv_path, pool, capture)) return 1;
+    bytes = capture.voltage.size() * (sizeof(int32_t) + sizeof(uint8_t));
+  } else {
+    MappedFile file(csv_path);
+    if (!file.bytes) {
+      fprintf(stderr, "cannot read %s\n", csv_path);
+      return 1;
+    }
+    if (!parse_capture(file, pool, capture)) return 1;
+    bytes = file.length;
+  }
+  double load_s = seconds_since(load_start);
+  size_t rows = capture.voltage.size();
+  printf("%s: %zu rows, %.1f MB read in %.3f s (%.0f MB/s, %d threads)\n", csv_path, rows,
+         bytes / 1e6, load_s, bytes / 1e6 / load_s, threads);
+
+  size_t windows = rows > (size_t)window ? (rows - window + step - 1) / step : 0;
+  std::vector<double> X(windows * NUM_FEATURES);
+  std::vector<int64_t> y(windows);
+
+  std::vector<int> counts{threads};
+  if (scaling) {
+    counts.clear();
+    for (int t = 1; t < threads; t *= 2) counts.push_back(t);
+    counts.push_back(threads);
+  }
+  double base = 0;
+  for (int t : counts) {
+    Run run = extract_all(capture, window, step, windows, t, grain, X, y);
+    double rate = windows / run.seconds;
+    if (!base) base = rate;
+    printf("  %3d threads: %zu windows in %.3f s, %.0f windows/s", t, windows, run.seconds, rate);
+    if (scaling) printf(", %.2fx (%.0f%% efficiency), %zu steals", rate / base, 100 * rate / base / t,
+                        run.steals);
+    printf("\n");
+  }
+
+  std::error_code ec;
+  std::filesystem::create_directories(out_dir, ec);
+  std::string x_path = out_dir + "/X.npy", y_path = out_dir + "/y.npy";
+  if (!npy_save(x_path.c_str(), "<f8", X.data(), sizeof(double), windows, NUM_FEATURES) ||
+      !npy_save(y_path.c_str(), "<i8", y.data(), sizeof(int64_t), windows)) {
+    return 1;
+  }
+  printf("Wrote %s (%zu x %d) and %s\n", x_path.c_str(), windows, NUM_FEATURES, y_path.c_str());
+  return 0;
+}
@@ -0,0 +1,142 @@
+// Minimal .npy reader and writer for the host tools. Reads 2-D, C-order,
+// '<f4' or '<f8' and 1-D integer labels (enough for data/processed/X.npy
+// and y.npy; anything else is rejected); writes C-order arrays in numpy's
+// own format 1.0 layout.
+
+#ifndef NPY_H
+#define NPY_H
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+struct NpyMatrix {
+  int rows = 0;
+  int cols = 0;
+  std::vector<float> data;  // rows * cols, row-major
+  const float* row(int r) const { return &data[(size_t)r * cols]; }
+};
+
+// Opens path and reads its header; returns the file positioned at the data,
+// or null (and prints why)
+inline FILE* npy_open(const char* path, std::string& header) {
+  FILE* f = fopen(path, "rb");
+  if (!f) {
+    fprintf(stderr, "npy: cannot open %s\n", path);
+    return nullptr;
+  }
+
+  unsigned char pre[10];
+  if (fread(pre, 1, 10, f) != 10 || memcmp(pre, "\x93NUMPY", 6) != 0) {
+    fprintf(stderr, "npy: %s is not a .npy file\n", path);
+    fclose(f);
+    return nullptr;
+  }
+  uint32_t header_len = pre[8] | (pre[9] << 8);
+  if (pre[6] >= 2) {
+    unsigned char extra[2];
+    if (fread(extra, 1, 2, f) != 2) { fclose(f); return nullptr; }
+    header_len |= (extra[0] << 16) | (extra[1] << 24);
+  }
+  header.assign(header_len, '\0');
+  if (fread(&header[0], 1, header_len, f) != header_len) { fclose(f); return nullptr; }
+  return f;
+}
+
+// Returns false (and prints why) if the file is missing or unsupported
+inline bool npy_load(const char* path, NpyMatrix& out) {
+  std::string header;
+  FILE* f = npy_open(path, header);
+  if (!f) return false;
+
+  bool f8 = header.find("'<f8'") != std::string::npos;
+  bool f4 = header.find("'<f4'") != std::string::npos;
+  size_t shape = header.find("'shape': (");
+  if ((!f8 && !f4) || header.find("'fortran_order': False") == std::string::npos ||
+      shape == std::string::npos ||
+      sscanf(header.c_str() + shape, "'shape': (%d, %d)", &out.rows, &out.cols) != 2) {
+    fprintf(stderr, "npy: %s must be a 2-D C-order float32/float64 array\n", path);
+    fclose(f);
+    return false;
+  }
+
+  size_t n = (size_t)out.rows * out.cols;
+  out.data.resize(n);
+  bool ok;
+  if (f4) {
+    ok = fread(out.data.data(), sizeof(float), n, f) == n;
+  } else {
+    std::vector<double> tmp(n);
+    ok = fread(tmp.data(), sizeof(double), n, f) == n;
+    for (size_t i = 0; i < n; i++) out.data[i] = (float)tmp[i];
+  }
+  fclose(f);
+  if (!ok) fprintf(stderr, "npy: %s is truncated\n", path);
+  return ok;
+}
+
+// 1-D '<i8' or '<i4' class labels, such as data/processed/y.npy
+inline bool npy_load_labels(const char* path, std::vector<int>& out) {
+  std::string header;
+  FILE* f = npy_open(path, header);
+  if (!f) return false;
+
+  bool i8 = header.find("'<i8'") != std::string::npos;
+  bool i4 = header.find("'<i4'") != std::string::npos;
+  size_t shape = header.find("'shape': (");
+  int rows = 0;
+  if ((!i8 && !i4) || shape == std::string::npos ||
+      sscanf(header.c_str() + shape, "'shape': (%d,)", &rows) != 1) {
+    fprintf(stderr, "npy: %s must be a 1-D int32/int64 array\n", path);
+    fclose(f);
+    return false;
+  }
+
+  out.resize(rows);
+  bool ok = true;
+  for (int i = 0; i < rows && ok; i++) {
+    int64_t v = 0;
+    ok = fread(&v, i8 ? 8 : 4, 1, f) == 1;
+    out[i] = (int)(i8 ? v : (int32_t)v);
+  }
+  fclose(f);
+  if (!ok) fprintf(stderr, "npy: %s is truncated\n", path);
+  return ok;
+}
+
+// descr is the numpy dtype string ('<f8', '<i8', ...); cols < 0 writes a
+// 1-D array of rows elements. Assumes a little-endian host, as npy_load
+// does.
+inline bool npy_save(const char* path, const char* descr, const void* data, size_t elem_size,
+                     long long rows, long long cols = -1) {
+  char shape[64];
+  if (cols < 0) snprintf(shape, sizeof(shape), "(%lld,)", rows);
+  else snprintf(shape, sizeof(shape), "(%lld, %lld)", rows, cols);
+  std::string header = std::string("{'descr': '") + descr +
+                       "', 'fortran_order': False, 'shape': " + shape + ", }";
+  // Magic, version and length take 10 bytes; numpy pads the header with
+  // spaces so the data starts on a 64-byte boundary
+  size_t total = 10 + header.size() + 1;
+  header.append((64 - total % 64) % 64, ' ');
+  header += '\n';
+
+  FILE* f = fopen(path, "wb");
+  if (!f) {
+    fprintf(stderr, "npy: cannot write %s\n", path);
+    return false;
+  }
+  unsigned char pre[10] = {0x93, 'N', 'U', 'M', 'P', 'Y', 1, 0,
+                           (unsigned char)(header.size() & 0xff),
+                           (unsigned char)(header.size() >> 8)};
+  size_t n = (size_t)rows * (cols < 0 ? 1 : cols);
+  bool ok = fwrite(pre, 1, 10, f) == 10 &&
+            fwrite(header.data(), 1, header.size(), f) == header.size() &&
+            fwrite(data, elem_size, n, f) == n;
+  ok = fclose(f) == 0 && ok;
+  if (!ok) fprintf(stderr, "npy: error writing %s\n", path);
+  return ok;
+}
+
+#endif  // NPY_H
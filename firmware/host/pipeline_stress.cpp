@@ -0,0 +1,208 @@
+// Stress test for the RF detector's staged pipeline (pipeline.h): a replay
+// thread plays the timer ISR into the sample ring, a feature thread plays
+// feature_task() (streaming extractor, lazy forest vote) into the detection
+// queue, and this thread plays loop()'s act stage with injected stalls. It
+// checks that samples and detections arrived in order, or were counted as
+// dropped, and reports queue depths and stage latencies. Configure with
+// -DHOST_SANITIZE=thread to run the queues under ThreadSanitizer.
+//
+// Usage: pipeline_stress [--trace capture.csv|.rfcap] [--seconds S]
+//                        [--speed X] [--jitter-us US] [--stall-prob P]
+//                        [--stall-us US] [--act-stall-prob P]
+//                        [--act-stall-us US] [--seed N]
+// Times are in sample-clock us, which runs --speed (50) times faster than
+// real time. By default 0.1% of interrupts are held off up to 2 ms and 10% of
+// detections stall the act stage for a 24.5 ms OLED frame. Exits non-zero if
+// anything is lost without being counted, reordered or corrupted.
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include "replay_source.h"
+#include "random_forest_model.h"
+#include "feature_extractor.h"
+#include "pipeline.h"
+
+#define SAMPLE_RATE 200
+#define WINDOW_SIZE 100
+#define HOP_SIZE 10
+#define SAMPLE_RING_SIZE 64
+
+struct Options {
+  const char* trace = nullptr;
+  double seconds = 300;
+  double speed = 50;
+  ReplayJitter jitter;
+  double act_stall_prob = 0.1;
+  uint32_t act_stall_us = 24500;
+};
+
+// What the feature thread saw; read by main after join
+struct FeatureResult {
+  uint64_t consumed = 0;
+  uint64_t gaps = 0;
+  uint64_t errors = 0;
+  int64_t last_k = -1;
+};
+
+static FeatureExtractor<WINDOW_SIZE, HOP_SIZE, FOREST_FEATURE_MASK> extractor;
+
+int main(int argc, char** argv) {
+  Options opt;
+  opt.jitter.timestamp_us = 200;
+  opt.jitter.stall_prob = 0.001;
+  opt.jitter.stall_us = 2000;
+  for (int i = 1; i < argc; i++) {
+    const char* arg = argv[i];
+    const char* value = i + 1 < argc ? argv[++i] : nullptr;
+    if (!value) {
+      fprintf(stderr, "unknown or incomplete option %s\n", arg);
+      return 2;
+    }
+    else if (!strcmp(arg, "--trace")) opt.trace = value;
+    else if (!strcmp(arg, "--seconds")) opt.seconds = atof(value);
+    else if (!strcmp(arg, "--speed")) opt.speed = atof(value);
+    else if (!strcmp(arg, "--jitter-us")) opt.jitter.timestamp_us = atoi(value);
+    else if (!strcmp(arg, "--stall-prob")) opt.jitter.stall_prob = atof(value);
+    else if (!strcmp(arg, "--stall-us")) opt.jitter.stall_us = atoi(value);
+    else if (!strcmp(arg, "--act-stall-prob")) opt.act_stall_prob = atof(value);
+    else if (!strcmp(arg, "--act-stall-us")) opt.act_stall_us = atoi(value);
+    else if (!strcmp(arg, "--seed")) opt.jitter.seed = atoi(value);
+    else {
+      fprintf(stderr, "unknown option %s\n", arg);
+      return 2;
+    }
+  }
+  if (opt.speed <= 0 || 2 * opt.jitter.timestamp_us >= 1000000 / SAMPLE_RATE) {
+    fprintf(stderr, "--speed must be positive, --jitter-us under half a period\n");
+    return 2;
+  }
+
+  std::vector<uint16_t> adc;
+  if (opt.trace ? !load_replay_adc(opt.trace, adc) : (adc = synthetic_replay_adc(opt.jitter.seed)).empty()) return 1;
+
+  uint64_t ticks = (uint64_t)(opt.seconds * SAMPLE_RATE);
+  ReplaySampleSource<SAMPLE_RING_SIZE> source(adc, ticks, opt.speed, opt.jitter);
+  static SpscQueue<Detection, DETECTION_QUEUE_SIZE> detections;
+  std::atomic<bool> features_done{false};
+  std::atomic<uint32_t> windows{0};
+
+  // The sample clock, which the replayed timestamps are on
+  auto start = std::chrono::steady_clock::now();
+  auto clock_us = [&] {
+    return (uint32_t)(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() *
+                      opt.speed);
+  };
+  auto sleep_us = [&](double sample_us) {
+    std::this_thread::sleep_for(std::chrono::duration<double, std::micro>(sample_us / opt.speed));
+  };
+
+  if (!source.begin(SAMPLE_RATE)) return 1;
+
+  // feature_task(): the board blocks on the ISR's notification; here the
+  // thread sleeps half a sample period when the ring is empty
+  FeatureResult fr;
+  std::thread feature([&] {
+    for (;;) {
+      Sample s;
+      if (!source.read(s)) {
+        if (source.finished() && !source.pending()) break;
+        sleep_us(source.period() / 2);
+        continue;
+      }
+      // Which tick this is: the first at or after the last one whose stamp matches
+      int64_t k = fr.last_k + 1;
+      while ((uint64_t)k < ticks && source.timestamp(k) != s.t_us) k++;
+      if ((uint64_t)k >= ticks || source.adc_at(k) != s.adc) {
+        fr.errors++;
+        k = fr.last_k + 1;
+      }
+      fr.gaps += k - fr.last_k - 1;
+      fr.last_k = k;
+      fr.consumed++;
+
+      extractor.add_sample((s.adc / 4095.0f) * 3300.0f);
+      if (!extractor.is_window_ready()) continue;
+      Detection d = {};
+      d.seq = windows.load(std::memory_order_relaxed) + 1;
+      d.sample_t_us = s.t_us;
+      uint32_t vote_start = clock_us();
+      d.cls = classify_random_forest_lazy(extractor);
+      d.done_t_us = clock_us();
+      d.classify_us = d.done_t_us - vote_start;
+      d.computed = extractor.features_computed();
+      d.ring_backlog = source.max_pending();
+      windows.store(d.seq, std::memory_order_relaxed);
+      detections.push(d);
+    }
+    features_done.store(true, std::memory_order_release);
+  });
+
+  // loop(): the act stage, polling as the board's loop() spins
+  StageStats ring_stats, classify_stats, queue_stats, act_stats;
+  uint64_t acted = 0, seq_gaps = 0, seq_errors = 0, stalls = 0;
+  uint64_t classes[6] = {0};
+  uint32_t last_seq = 0;
+  uint32_t rng = opt.jitter.seed * 747796405u + 1;
+  for (;;) {
+    Detection d;
+    if (!detections.pop(d)) {
+      if (features_done.load(std::memory_order_acquire) && !detections.size()) break;
+      sleep_us(source.period() / 2);
+      continue;
+    }
+    uint32_t act_start = clock_us();
+    if (d.seq <= last_seq || d.cls >= 6) {
+      seq_errors++;
+    } else {
+      seq_gaps += d.seq - last_seq - 1;
+      last_seq = d.seq;
+    }
+    ring_stats.add(d.done_t_us - d.classify_us - d.sample_t_us);
+    classify_stats.add(d.classify_us);
+    queue_stats.add(act_start - d.done_t_us);
+    classes[d.cls % 6]++;
+    acted++;
+    rng = rng * 1664525u + 1013904223u;
+    if ((rng >> 8) * (1.0 / 16777216.0) < opt.act_stall_prob) {
+      stalls++;
+      sleep_us(opt.act_stall_us);
+    }
+    act_stats.add(clock_us() - act_start);
+  }
+  feature.join();
+  source.end();
+  uint64_t produced = source.produced();
+  fr.gaps += produced - 1 - fr.last_k;  // Dropped after the last sample read
+  uint32_t total = windows.load();
+  seq_gaps += total - last_seq;
+  double wall = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  bool samples_ok = !fr.errors && fr.consumed + source.dropped() == produced && fr.gaps == source.dropped();
+  bool detections_ok = !seq_errors && acted + detections.dropped() == total && seq_gaps == detections.dropped();
+  printf("pipeline_stress: %llu ticks at %d Hz (%.1f s of samples) in %.2f s wall\n",
+         (unsigned long long)produced, SAMPLE_RATE, produced / (double)SAMPLE_RATE, wall);
+  printf("  samples:     consumed %llu, dropped %u (ring full), max backlog %d/%d\n",
+         (unsigned long long)fr.consumed, source.dropped(), source.max_pending(), SAMPLE_RING_SIZE);
+  printf("  detections:  %u classified, acted on %llu, dropped %u (queue full), max backlog %d/%d\n", total,
+         (unsigned long long)acted, detections.dropped(), detections.max_size(), DETECTION_QUEUE_SIZE);
+  printf("  act stalls:  %llu of %.1f ms\n", (unsigned long long)stalls, opt.act_stall_us / 1000.0);
+  printf("  latency ms (avg/max): ring %.2f/%.2f classify %.2f/%.2f queue %.2f/%.2f act %.2f/%.2f\n",
+         ring_stats.avg_us() / 1000.0, ring_stats.max_us / 1000.0, classify_stats.avg_us() / 1000.0,
+         classify_stats.max_us / 1000.0, queue_stats.avg_us() / 1000.0, queue_stats.max_us / 1000.0,
+         act_stats.avg_us() / 1000.0, act_stats.max_us / 1000.0);
+  printf("  classes:    ");
+  for (int c = 0; c < 6; c++) printf(" %s %.1f%%", activity_names[c], acted ? 100.0 * classes[c] / acted : 0.0);
+  printf("\n");
+  printf("  integrity:   samples %s (%llu mismatched, %llu gaps vs %u counted drops), "
+         "detections %s (%llu out of order, %llu gaps vs %u counted drops)\n",
+         samples_ok ? "OK" : "FAILED", (unsigned long long)fr.errors, (unsigned long long)fr.gaps,
+         source.dropped(), detections_ok ? "OK" : "FAILED", (unsigned long long)seq_errors,
+         (unsigned long long)seq_gaps, detections.dropped());
+  return samples_ok && detections_ok ? 0 : 1;
+}
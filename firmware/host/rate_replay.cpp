@@ -0,0 +1,231 @@
+// Replays a long ADC trace through the RF detector's classify stage twice:
+// at the fixed 200 Hz, and under the adaptive rate controller
+// (2_tinyml_inference/rate_controller.h) with the sample timer following it.
+// Reports the ADC conversions, feature task wakes, windows classified and
+// host CPU time each run needs, and how much later the adaptive run reaches
+// each activity the fixed run reports.
+//
+// Usage: rate_replay [--trace CSV|RFCAP] [--seconds S] [--divider N]
+//                    [--settle-ms MS] [--probe-ms MS] [--sweep]
+// The trace (default: the simulator's synthetic pattern, 20 s of each
+// activity in turn) is looped to --seconds (1800). A trigger is a decoded
+// change to an activity other than IDLE, as mitigation fires on. Its added
+// latency is the time from the fixed run's trigger until the adaptive run
+// reports the same activity; a trigger is missed if the adaptive run never
+// does before the fixed run moves on. The "fixed +25 ms" row is a
+// fixed-rate run half a hop later, scored the same way: the misses and
+// delays window phase alone causes. --sweep prints a row per divider,
+// settle and probe time instead.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "feature_extractor.h"
+#include "idle_cascade.h"
+#include "random_forest_model.h"
+#include "rate_controller.h"
+#include "replay_source.h"
+#include "temporal_decoder.h"
+
+// As esp32_rf_detector.ino
+#define SAMPLE_RATE 200
+#define WINDOW_SIZE 100
+#define HOP_SIZE 10
+#define DECODER_WINDOWS 40
+#define DECODER_VOTES 35
+
+typedef FeatureExtractor<WINDOW_SIZE, HOP_SIZE, FOREST_FEATURE_MASK | CASCADE_FEATURE_MASK> RfExtractor;
+
+struct RateSettings {
+  int divider;
+  int settle_ms;
+  int probe_ms;
+};
+
+struct Run {
+  uint64_t conversions = 0;  // ADC samples, one timer interrupt each
+  uint64_t wakes = 0;        // Feature task notifications, one per hop of samples
+  uint64_t windows = 0;      // Classified
+  double cpu_ms = 0;         // Host time in the classify stage
+  double low_s = 0;
+  uint32_t drops = 0, trips = 0, probes = 0;
+  std::vector<uint8_t> activity;  // Decoded activity at each 200 Hz tick
+};
+
+// The feature task's loop, one timer tick at a time: the timer converts a
+// sample every tick at full rate, every divider-th at the low rate
+static Run run(const std::vector<uint16_t>& adc, const RateSettings* adaptive) {
+  static RfExtractor extractor;
+  extractor = RfExtractor();
+  TemporalDecoder<DECODER_WINDOWS> decoder(DECODER_VOTES);
+  RateController rate(SAMPLE_RATE, adaptive ? adaptive->divider : 1, adaptive ? adaptive->settle_ms : 0,
+                      adaptive ? adaptive->probe_ms : 0);
+  Run r;
+  r.activity.resize(adc.size());
+  const uint32_t tick_us = 1000000 / SAMPLE_RATE;
+  size_t step = 1;
+  int since_wake = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < adc.size(); i += step) {
+    Sample s = {(uint32_t)(i * tick_us), adc[i]};
+    r.conversions++;
+    if (++since_wake == HOP_SIZE) {
+      since_wake = 0;
+      r.wakes++;
+    }
+    bool full = !adaptive || rate.add_sample(s);
+    if (adaptive && rate.take_change()) {
+      step = rate.is_low() ? adaptive->divider : 1;
+      rate.rate_applied(s.t_us);
+    }
+    if (full) {
+      extractor.add_sample((s.adc / 4095.0f) * 3300.0f);
+      if (extractor.is_window_ready() && (!adaptive || rate.full_samples() >= WINDOW_SIZE)) {
+        bool exit = cascade_accepts_idle(extractor);
+        decoder.update(exit ? 0 : classify_random_forest_lazy(extractor));
+        if (adaptive) rate.add_window(decoder.current());
+        r.windows++;
+      }
+    }
+    for (size_t k = i; k < i + step && k < adc.size(); k++) r.activity[k] = decoder.current();
+  }
+  r.cpu_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+  r.low_s = rate.low_ms() / 1000.0;
+  r.drops = rate.drops;
+  r.trips = rate.trips;
+  r.probes = rate.probes;
+  return r;
+}
+
+struct Latency {
+  int triggers = 0;
+  int missed = 0;
+  std::vector<double> added_ms;
+};
+
+static Latency compare(const Run& fixed, const Run& adaptive) {
+  Latency l;
+  const std::vector<uint8_t>& f = fixed.activity;
+  const std::vector<uint8_t>& a = adaptive.activity;
+  for (size_t t = 1; t < f.size(); t++) {
+    if (f[t] == f[t - 1] || !f[t]) continue;
+    l.triggers++;
+    // Until the fixed run moves on, or the adaptive run already got there
+    size_t hit = t;
+    while (hit > 0 && a[hit - 1] == f[t] && f[hit - 1] != f[t]) hit--;
+    if (hit < t) {
+      l.added_ms.push_back(0);
+      continue;
+    }
+    while (hit < f.size() && f[hit] == f[t] && a[hit] != f[t]) hit++;
+    if (hit == f.size() || f[hit] != f[t]) {
+      l.missed++;
+      continue;
+    }
+    l.added_ms.push_back((hit - t) * 1000.0 / SAMPLE_RATE);
+  }
+  std::sort(l.added_ms.begin(), l.added_ms.end());
+  return l;
+}
+
+static double percentile(const std::vector<double>& sorted, double p) {
+  if (sorted.empty()) return 0;
+  return sorted[std::min(sorted.size() - 1, (size_t)(p / 100 * sorted.size()))];
+}
+
+static void print_header() {
+  printf("%-14s %8s %8s %8s %8s %7s %7s %7s %7s %7s %6s\n", "rate", "adc", "wakes", "windows",
+         "cpu", "low", "p50 ms", "p90 ms", "max ms", "trig", "missed");
+}
+
+static void print_row(const char* name, const Run& r, const Run& fixed, const Latency* l) {
+  printf("%-14s %7.1f%% %7.1f%% %7.1f%% %7.1f%% %6.1f%%", name, 100.0 * r.conversions / fixed.conversions,
+         100.0 * r.wakes / fixed.wakes, 100.0 * r.windows / fixed.windows, 100.0 * r.cpu_ms / fixed.cpu_ms,
+         100.0 * r.low_s * SAMPLE_RATE / fixed.activity.size());
+  if (!l) {
+    printf(" %7s %7s %7s %7s %6s\n", "-", "-", "-", "-", "-");
+    return;
+  }
+  printf(" %7.0f %7.0f %7.0f %7d %6d\n", percentile(l->added_ms, 50), percentile(l->added_ms, 90),
+         l->added_ms.empty() ? 0.0 : l->added_ms.back(), l->triggers, l->missed);
+}
+
+int main(int argc, char** argv) {
+  const char* trace = nullptr;
+  double seconds = 1800;
+  RateSettings settings = {4, 3000, 16000};  // As esp32_rf_detector.ino
+  bool sweep = false;
+  for (int i = 1; i < argc; i++) {
+    const char* arg = argv[i];
+    bool has_value = i + 1 < argc;
+    if (!strcmp(arg, "--sweep")) sweep = true;
+    else if (!strcmp(arg, "--trace") && has_value) trace = argv[++i];
+    else if (!strcmp(arg, "--seconds") && has_value) seconds = atof(argv[++i]);
+    else if (!strcmp(arg, "--divider") && has_value) settings.divider = atoi(argv[++i]);
+    else if (!strcmp(arg, "--settle-ms") && has_value) settings.settle_ms = atoi(argv[++i]);
+    else if (!strcmp(arg, "--probe-ms") && has_value) settings.probe_ms = atoi(argv[++i]);
+    else {
+      fprintf(stderr, "usage: rate_replay [--trace CSV|RFCAP] [--seconds S] [--divider N] "
+                      "[--settle-ms MS] [--probe-ms MS] [--sweep]\n");
+      return 2;
+    }
+  }
+  if (settings.divider < 1 || settings.divider > 20 || seconds <= 0) {
+    fprintf(stderr, "--divider must be 1-20 and --seconds positive\n");
+    return 2;
+  }
+
+  std::vector<uint16_t> trace_adc;
+  if (trace && !load_replay_adc(trace, trace_adc)) return 1;
+  if (!trace) trace_adc = activity_replay_adc(120, 1);
+  std::vector<uint16_t> adc((size_t)(seconds * SAMPLE_RATE));
+  for (size_t i = 0; i < adc.size(); i++) adc[i] = trace_adc[i % trace_adc.size()];
+
+  run(adc, nullptr);  // Warm up
+  Run fixed = run(adc, nullptr);
+  printf("%.0f s of %s at %d Hz, %d-sample windows every %d\n", seconds, trace ? trace : "synthetic",
+         SAMPLE_RATE, WINDOW_SIZE, HOP_SIZE);
+  printf("fixed rate: %llu conversions, %llu wakes, %llu windows, %.1f ms CPU\n",
+         (unsigned long long)fixed.conversions, (unsigned long long)fixed.wakes,
+         (unsigned long long)fixed.windows, fixed.cpu_ms);
+  print_header();
+  print_row("fixed", fixed, fixed, nullptr);
+
+  // Reference: a fixed-rate run half a hop later splits windows
+  // differently, and its decoder flips on marginal activities differently
+  std::vector<uint16_t> later(adc.begin() + HOP_SIZE / 2, adc.end());
+  Run shifted = run(later, nullptr);
+  shifted.activity.insert(shifted.activity.begin(), HOP_SIZE / 2, shifted.activity.front());
+  Latency floor = compare(fixed, shifted);
+  print_row("fixed +25 ms", shifted, fixed, &floor);
+
+  char name[32];
+  if (!sweep) {
+    Run adaptive = run(adc, &settings);
+    Latency l = compare(fixed, adaptive);
+    snprintf(name, sizeof(name), "/%d %d/%d s", settings.divider, settings.settle_ms / 1000,
+             settings.probe_ms / 1000);
+    print_row(name, adaptive, fixed, &l);
+    printf("%u drops, %u trips, %u probes\n", adaptive.drops, adaptive.trips, adaptive.probes);
+    return 0;
+  }
+  static const int DIVIDERS[] = {2, 4, 8};
+  static const int SETTLE_MS[] = {2000, 4000, 8000};
+  static const int PROBE_MS[] = {8000, 16000, 32000};
+  for (int divider : DIVIDERS) {
+    for (int settle : SETTLE_MS) {
+      for (int probe : PROBE_MS) {
+        RateSettings s = {divider, settle, probe};
+        Run adaptive = run(adc, &s);
+        Latency l = compare(fixed, adaptive);
+        snprintf(name, sizeof(name), "/%d %d/%d s", divider, settle / 1000, probe / 1000);
+        print_row(name, adaptive, fixed, &l);
+      }
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,161 @@
+// Host SampleSource: a producer thread stands in for the board's timer ISR
+// and replays ADC counts into the same SampleRing the sketches use, with the
+// timing faults a real ISR sees (timestamp jitter, interrupts held off and
+// then fired back to back), so the ring and the consumer loop can be
+// stress-tested under real concurrency on Linux.
+
+#ifndef REPLAY_SOURCE_H
+#define REPLAY_SOURCE_H
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "capture_store.h"
+#include "sample_source.h"
+
+struct ReplayJitter {
+  uint32_t timestamp_us = 0;   // t_us error, uniform in +-timestamp_us
+  double stall_prob = 0;       // Chance per tick that the interrupt is held off
+  uint32_t stall_us = 0;       // Longest hold-off, in sample-clock us
+  uint32_t seed = 1;
+};
+
+template <int N>
+class ReplaySampleSource : public RingSampleSource<N> {
+public:
+  // Replays adc (looped) for count ticks. speed is sample clock over wall
+  // clock; 0 runs the producer flat out.
+  ReplaySampleSource(const std::vector<uint16_t>& adc, uint64_t count, double speed,
+                     const ReplayJitter& jitter)
+    : adc(adc), count(count), speed(speed), jitter(jitter) {}
+
+  ~ReplaySampleSource() { end(); }
+
+  bool begin(uint32_t rate_hz) override {
+    if (adc.empty() || !rate_hz || thread.joinable()) return false;
+    period_us = 1e6 / rate_hz;
+    thread = std::thread([this] { produce(); });
+    return true;
+  }
+
+  void end() override {
+    stop = true;
+    if (thread.joinable()) thread.join();
+  }
+
+  // All ticks pushed (or dropped)
+  bool finished() const { return done.load(std::memory_order_acquire); }
+  uint64_t produced() const { return ticks.load(std::memory_order_acquire); }
+  double period() const { return period_us; }
+
+  // What tick k carries, for checking the consumer's view
+  uint16_t adc_at(uint64_t k) const { return adc[k % adc.size()]; }
+  uint32_t timestamp(uint64_t k) const {
+    uint32_t span = 2 * jitter.timestamp_us + 1;
+    int64_t error = (int64_t)(mix(k ^ ((uint64_t)jitter.seed << 40)) % span) - jitter.timestamp_us;
+    return (uint32_t)(int64_t)(k * period_us + error);
+  }
+
+private:
+  static uint64_t mix(uint64_t x) {
+    x += 0x9E3779B97F4A7C15ull;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+    return x ^ (x >> 31);
+  }
+
+  void produce() {
+    typedef std::chrono::duration<double, std::micro> Micros;
+    auto start = std::chrono::steady_clock::now();
+    uint64_t rng = mix(jitter.seed);
+    for (uint64_t k = 0; k < count && !stop; k++) {
+      if (speed > 0) {
+        auto due = start + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                               Micros(k * period_us / speed));
+        // A held-off interrupt fires late; the ticks it delayed follow at once
+        rng = mix(rng);
+        if (jitter.stall_prob > 0 && (rng >> 11) * (1.0 / 9007199254740992.0) < jitter.stall_prob) {
+          due += std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                   Micros((mix(rng) % (jitter.stall_us + 1)) / speed));
+        }
+        std::this_thread::sleep_until(due);
+      }
+      this->ring.push({timestamp(k), adc_at(k)});
+      ticks.store(k + 1, std::memory_order_release);
+    }
+    done.store(true, std::memory_order_release);
+  }
+
+  std::vector<uint16_t> adc;
+  uint64_t count;
+  double speed;
+  ReplayJitter jitter;
+  double period_us = 0;
+  std::thread thread;
+  std::atomic<bool> stop{false};
+  std::atomic<bool> done{false};
+  std::atomic<uint64_t> ticks{0};
+};
+
+// ADC counts from a collector CSV or .rfcap capture
+inline bool load_replay_adc(const char* path, std::vector<uint16_t>& out) {
+  std::vector<float> mv;
+  if (CaptureStore::is_capture(path)) {
+    CaptureStore store;
+    if (!store.open(path)) return false;
+    for (int32_t v : store.voltage(0, store.rows())) {
+      if (v != CAPTURE_NO_VOLTAGE) mv.push_back((float)capture_mv(v));
+    }
+  } else {
+    FILE* f = fopen(path, "r");
+    if (!f) {
+      fprintf(stderr, "cannot open %s\n", path);
+      return false;
+    }
+    char line[256];
+    while (fgets(line, sizeof(line), f)) {
+      double t;
+      float v;
+      if (sscanf(line, "%lf,%f", &t, &v) == 2) mv.push_back(v);
+    }
+    fclose(f);
+  }
+  for (float v : mv) out.push_back((uint16_t)std::max(0L, std::min(4095L, lroundf(v / 3300.0f * 4095.0f))));
+  if (out.empty()) fprintf(stderr, "%s: no voltage_mv rows\n", path);
+  return !out.empty();
+}
+
+// Seeded stand-in: IDLE noise with bursts every 40 samples
+inline std::vector<uint16_t> synthetic_replay_adc(uint32_t seed) {
+  std::vector<uint16_t> out(20000);
+  uint32_t x = seed * 2654435761u + 1;
+  for (size_t i = 0; i < out.size(); i++) {
+    x = x * 1664525u + 1013904223u;
+    out[i] = (uint16_t)(1762 + (x >> 27) + (i % 40 < 2 ? 25 : 0));
+  }
+  return out;
+}
+
+// The simulator's synthetic pattern (sim/sim.cpp trace_mv()) at 200 Hz:
+// 20 s of each activity in turn, IDLE first, heavier ones bursting harder
+// and faster
+inline std::vector<uint16_t> activity_replay_adc(int seconds, uint32_t seed) {
+  std::mt19937 rng(seed);
+  std::normal_distribution<float> noise(0, 15);
+  std::vector<uint16_t> out;
+  for (int ms = 0; ms < seconds * 1000; ms += 5) {
+    int activity = (ms / 20000) % 6;
+    int period = 40 - activity * 6;
+    float mv = 1420 + noise(rng) + ((ms % period) < 2 ? 20.0f * activity : 0);
+    out.push_back((uint16_t)std::max(0L, std::min(4095L, lroundf(mv / 3300.0f * 4095.0f))));
+  }
+  return out;
+}
+
+#endif  // REPLAY_SOURCE_H
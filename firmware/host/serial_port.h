@@ -0,0 +1,39 @@
+// Opening the boards' USB serial ports from the host decoders
+
+#ifndef SERIAL_PORT_H
+#define SERIAL_PORT_H
+
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+
+#include <fcntl.h>
+#include <termios.h>
+#include <unistd.h>
+
+// Raw 8N1 at baud; reads time out after 0.5 s so Ctrl-C is noticed
+inline int open_port(const char* path, int baud) {
+  int fd = open(path, O_RDWR | O_NOCTTY);
+  if (fd < 0) {
+    fprintf(stderr, "cannot open %s: %s\n", path, strerror(errno));
+    return -1;
+  }
+  struct termios tio;
+  if (tcgetattr(fd, &tio) != 0) {
+    fprintf(stderr, "%s is not a serial port\n", path);
+    close(fd);
+    return -1;
+  }
+  cfmakeraw(&tio);
+  tio.c_cc[VMIN] = 0;
+  tio.c_cc[VTIME] = 5;
+  speed_t speed = baud == 921600 ? B921600 : baud == 460800 ? B460800 : baud == 230400 ? B230400
+                : baud == 57600 ? B57600 : B115200;
+  cfsetispeed(&tio, speed);
+  cfsetospeed(&tio, speed);
+  tcsetattr(fd, TCSANOW, &tio);
+  tcflush(fd, TCIFLUSH);
+  return fd;
+}
+
+#endif  // SERIAL_PORT_H
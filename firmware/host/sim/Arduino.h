@@ -0,0 +1,208 @@
+// Arduino core API for the host simulator: the subset the detector
+// sketches use, backed by the virtual clock and cost models in sim.h.
+
+#ifndef ARDUINO_H
+#define ARDUINO_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <cmath>
+#include <cstdlib>
+#include <string>
+
+#include "sim.h"
+
+#define HIGH 0x1
+#define LOW 0x0
+#define INPUT 0x01
+#define OUTPUT 0x03
+#define DEC 10
+
+#define ESP_ARDUINO_VERSION_MAJOR 2
+#define IRAM_ATTR
+
+typedef enum { ADC_0db, ADC_2_5db, ADC_6db, ADC_11db } adc_attenuation_t;
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+
+uint16_t analogRead(uint8_t pin);
+void analogReadResolution(uint8_t bits);
+void analogSetAttenuation(adc_attenuation_t attenuation);
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t val);
+
+// Hardware timers (core 2.x API): alarms fire their ISR on the virtual
+// clock, preempting whatever the sketch is blocked in
+struct hw_timer_t;
+hw_timer_t* timerBegin(uint8_t num, uint16_t divider, bool count_up);
+void timerAttachInterrupt(hw_timer_t* timer, void (*isr)(), bool edge);
+void timerAlarmWrite(hw_timer_t* timer, uint64_t ticks, bool autoreload);
+void timerAlarmEnable(hw_timer_t* timer);
+void timerAlarmDisable(hw_timer_t* timer);
+void timerWrite(hw_timer_t* timer, uint64_t ticks);
+void timerEnd(hw_timer_t* timer);
+
+// FreeRTOS, which the ESP32 core includes for every sketch: tasks run as
+// coroutines on the virtual clock whenever they are due, also inside
+// loop()'s blocking calls, as they would on the other core, and inside a
+// lower-priority task's
+typedef void* TaskHandle_t;
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+typedef uint32_t TickType_t;
+typedef void (*TaskFunction_t)(void*);
+#define pdTRUE 1
+#define pdFALSE 0
+#define pdPASS 1
+#define portMAX_DELAY 0xFFFFFFFFu
+#define configMAX_PRIORITIES 25
+#define portTICK_PERIOD_MS 1
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
+#define portYIELD_FROM_ISR(...) ((void)0)
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char* name, uint32_t stack_bytes,
+                                   void* arg, UBaseType_t priority, TaskHandle_t* handle,
+                                   BaseType_t core);
+void vTaskDelay(TickType_t ticks);
+BaseType_t xTaskNotifyGive(TaskHandle_t task);
+void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t* woken);
+uint32_t ulTaskNotifyTake(BaseType_t clear, TickType_t ticks);
+
+long random(long max);
+long random(long min, long max);
+long map(long x, long in_min, long in_max, long out_min, long out_max);
+
+using std::abs;
+
+// Arduino's min/max accept mixed argument types, signedness included
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wsign-compare"
+template <typename A, typename B>
+inline auto min(A a, B b) -> std::decay_t<decltype(a < b ? a : b)> { return a < b ? a : b; }
+
+template <typename A, typename B>
+inline auto max(A a, B b) -> std::decay_t<decltype(a > b ? a : b)> { return a > b ? a : b; }
+#pragma GCC diagnostic pop
+
+class Print;
+
+class Printable {
+public:
+  virtual ~Printable() {}
+  virtual size_t printTo(Print& p) const = 0;
+};
+
+class Print {
+public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t c) = 0;
+  virtual size_t write(const uint8_t* buf, size_t n) {
+    size_t written = 0;
+    while (n--) written += write(*buf++);
+    return written;
+  }
+  size_t write(const char* s) { return write((const uint8_t*)s, strlen(s)); }
+
+  size_t print(const char* s) { return write(s); }
+  size_t print(char c) { return write((uint8_t)c); }
+  size_t print(int n) { return print((long long)n); }
+  size_t print(unsigned int n) { return print((unsigned long long)n); }
+  size_t print(long n) { return print((long long)n); }
+  size_t print(unsigned long n) { return print((unsigned long long)n); }
+  size_t print(long long n) { return printf_("%lld", n); }
+  size_t print(unsigned long long n) { return printf_("%llu", n); }
+  size_t print(double x, int digits = 2) { return printf_("%.*f", digits, x); }
+  size_t print(const Printable& x) { return x.printTo(*this); }
+
+  size_t println() { return write("\r\n"); }
+  template <typename T>
+  size_t println(const T& x) { return print(x) + println(); }
+  size_t println(double x, int digits) { return print(x, digits) + println(); }
+
+private:
+  template <typename... Args>
+  size_t printf_(const char* format, Args... args) {
+    char buf[64];
+    int n = snprintf(buf, sizeof(buf), format, args...);
+    return write((const uint8_t*)buf, n < (int)sizeof(buf) ? n : sizeof(buf) - 1);
+  }
+};
+
+// Arduino's String: the operations the sketches use
+class String : public Printable {
+public:
+  String(const char* s = "") : s(s) {}
+  String(char c) : s(1, c) {}
+  String(int n) : s(std::to_string(n)) {}
+  String(unsigned int n) : s(std::to_string(n)) {}
+  String(long n) : s(std::to_string(n)) {}
+  String(unsigned long n) : s(std::to_string(n)) {}
+
+  const char* c_str() const { return s.c_str(); }
+  unsigned int length() const { return s.size(); }
+  String& operator+=(const String& other) {
+    s += other.s;
+    return *this;
+  }
+  friend String operator+(String a, const String& b) { return a += b; }
+  friend String operator+(const char* a, const String& b) { return String(a) += b; }
+  bool operator==(const char* other) const { return s == other; }
+
+  void trim() {
+    size_t first = s.find_first_not_of(" \t\r\n");
+    size_t last = s.find_last_not_of(" \t\r\n");
+    s = first == std::string::npos ? "" : s.substr(first, last - first + 1);
+  }
+  bool equalsIgnoreCase(const String& other) const {
+    return s.size() == other.s.size() && !strncasecmp(s.c_str(), other.s.c_str(), s.size());
+  }
+
+  size_t printTo(Print& p) const override;
+
+private:
+  std::string s;
+};
+
+class HardwareSerial : public Print {
+public:
+  void begin(unsigned long baud) { sim_serial_begin(baud); }
+  void setTxBufferSize(size_t bytes) { sim_serial_tx_buffer(bytes); }
+  void setTimeout(unsigned long) {}
+  int availableForWrite() { return sim_serial_available_for_write(); }
+  int available() { return sim_serial_available(); }
+  int read() {
+    SimCall call;
+    return sim_serial_read();
+  }
+  String readStringUntil(char terminator) {
+    String line;
+    for (int c; (c = read()) >= 0 && c != terminator;) line += (char)c;
+    return line;
+  }
+  size_t write(uint8_t c) override { return write(&c, 1); }
+  size_t write(const uint8_t* buf, size_t n) override {
+    SimCall call;
+    sim_serial_write(buf, n);
+    return n;
+  }
+  using Print::write;
+};
+
+inline size_t String::printTo(Print& p) const { return p.write(c_str()); }
+
+extern HardwareSerial Serial;
+
+class EspClass {
+public:
+  uint32_t getCycleCount();  // 240 MHz over the virtual clock
+};
+
+extern EspClass ESP;
+
+#endif  // ARDUINO_H
@@ -0,0 +1,32 @@
+// HTTPClient stub for the host simulator: GET() charges SimConfig::net_us
+// plus the body's airtime. The body size is the trailing number of the URL,
+// as in the httpbin.org/bytes/N requests the data collector makes.
+
+#ifndef HTTPCLIENT_H
+#define HTTPCLIENT_H
+
+#include "Arduino.h"
+#include "WiFi.h"
+
+class HTTPClient {
+public:
+  bool begin(WiFiClient&, const String& url) {
+    this->url = url;
+    return true;
+  }
+  void setTimeout(uint16_t) {}
+  int GET() {
+    SimCall call;
+    const char* s = url.c_str();
+    const char* digits = s + strlen(s);
+    while (digits > s && digits[-1] >= '0' && digits[-1] <= '9') digits--;
+    sim_net_request(strtoul(digits, nullptr, 10));
+    return 200;
+  }
+  void end() {}
+
+private:
+  String url;
+};
+
+#endif  // HTTPCLIENT_H
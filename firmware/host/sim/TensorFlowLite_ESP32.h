@@ -0,0 +1,138 @@
+// TensorFlow Lite Micro stub for the host simulator: the types and calls
+// int8_model.h uses. AllocateTensors() reads the input and output tensors'
+// shape and type from the model's flatbuffer, so a model.h whose
+// model_batch does not match its model still fails begin() here. There is
+// no interpreter on the host: Invoke() charges SimConfig::model_us per row
+// of the input tensor to the virtual clock and scores class 0 highest.
+
+#ifndef TENSORFLOWLITE_ESP32_H
+#define TENSORFLOWLITE_ESP32_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "Arduino.h"
+
+#define TFLITE_SCHEMA_VERSION 3
+
+typedef enum { kTfLiteOk = 0, kTfLiteError = 1 } TfLiteStatus;
+typedef enum { kTfLiteNoType = 0, kTfLiteFloat32 = 1, kTfLiteInt8 = 9 } TfLiteType;
+
+typedef union {
+  int8_t* int8;
+  float* f;
+  uint8_t* raw;
+} TfLitePtrUnion;
+
+typedef struct {
+  TfLiteType type;
+  TfLitePtrUnion data;
+  size_t bytes;
+  int rows;  // Leading dimension
+} TfLiteTensor;
+
+namespace tflite {
+
+namespace sim_fb {
+
+inline uint32_t u32(const uint8_t* b, size_t o) {
+  uint32_t v;
+  memcpy(&v, b + o, 4);
+  return v;
+}
+
+inline uint16_t u16(const uint8_t* b, size_t o) {
+  uint16_t v;
+  memcpy(&v, b + o, 2);
+  return v;
+}
+
+// Position of field i of the table at t, 0 if absent
+inline size_t field(const uint8_t* b, size_t t, int i) {
+  size_t vtable = t - (int32_t)u32(b, t);
+  if ((size_t)(4 + 2 * i) >= u16(b, vtable)) return 0;
+  uint16_t off = u16(b, vtable + 4 + 2 * i);
+  return off ? t + off : 0;
+}
+
+inline size_t deref(const uint8_t* b, size_t o) { return o + u32(b, o); }
+
+}  // namespace sim_fb
+
+class Model {
+public:
+  const uint8_t* buf;
+  uint32_t version() const {
+    size_t v = sim_fb::field(buf, root(), 0);
+    return v ? sim_fb::u32(buf, v) : 0;
+  }
+  size_t root() const { return sim_fb::deref(buf, 0); }
+};
+
+inline const Model* GetModel(const void* data) {
+  static Model model;
+  model.buf = (const uint8_t*)data;
+  return &model;
+}
+
+class MicroErrorReporter {};
+class AllOpsResolver {};
+
+class MicroInterpreter {
+public:
+  MicroInterpreter(const Model* model, const AllOpsResolver&, uint8_t* arena, size_t arena_size,
+                   MicroErrorReporter*)
+    : model(model), arena(arena), arena_size(arena_size) {}
+
+  TfLiteStatus AllocateTensors() {
+    using namespace sim_fb;
+    const uint8_t* b = model->buf;
+    size_t subgraphs = deref(b, field(b, model->root(), 2));
+    size_t subgraph = deref(b, subgraphs + 4);
+    size_t used = 0;
+    if (!tensor(b, subgraph, 1, in, used) || !tensor(b, subgraph, 2, out, used)) return kTfLiteError;
+    return kTfLiteOk;
+  }
+
+  TfLiteTensor* input(int) { return &in; }
+  TfLiteTensor* output(int) { return &out; }
+
+  TfLiteStatus Invoke() {
+    SimCall call;
+    sim_model_invoke(in.rows);
+    int classes = (int)out.bytes / out.rows;
+    for (size_t i = 0; i < out.bytes; i++) out.data.int8[i] = i % classes == 0 ? 127 : -128;
+    return kTfLiteOk;
+  }
+
+private:
+  // The subgraph's first input (which = 1) or output (2), carved from the arena
+  bool tensor(const uint8_t* b, size_t subgraph, int which, TfLiteTensor& t, size_t& used) {
+    using namespace sim_fb;
+    size_t indices = deref(b, field(b, subgraph, which));
+    uint32_t index = u32(b, indices + 4);
+    size_t tensors = deref(b, field(b, subgraph, 0));
+    size_t table = deref(b, tensors + 4 + 4 * index);
+    size_t shape = deref(b, field(b, table, 0));
+    size_t elements = 1;
+    for (uint32_t d = 0; d < u32(b, shape); d++) elements *= u32(b, shape + 4 + 4 * d);
+    size_t type = field(b, table, 1);
+    t.type = type && b[type] == 9 ? kTfLiteInt8 : kTfLiteFloat32;  // Schema INT8 = 9, FLOAT32 = 0
+    t.bytes = elements * (t.type == kTfLiteInt8 ? 1 : 4);
+    t.rows = u32(b, shape) ? (int)u32(b, shape + 4) : 1;
+    if (used + t.bytes > arena_size) return false;
+    t.data.raw = arena + used;
+    used += (t.bytes + 15) & ~(size_t)15;
+    return true;
+  }
+
+  const Model* model;
+  uint8_t* arena;
+  size_t arena_size;
+  TfLiteTensor in = {};
+  TfLiteTensor out = {};
+};
+
+}  // namespace tflite
+
+#endif  // TENSORFLOWLITE_ESP32_H
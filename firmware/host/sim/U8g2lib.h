@@ -0,0 +1,121 @@
+// U8g2 stub for the host simulator. Drawing rasterises into a real 128x64
+// page buffer, with each font's cell size and a made-up glyph per character,
+// so a changed digit dirties the pixels it would on the panel. sendBuffer()
+// charges a full SH1106 frame over I2C to the virtual clock, and
+// updateDisplayArea() only the tile rows it sends.
+
+#ifndef U8G2LIB_H
+#define U8G2LIB_H
+
+#include <string.h>
+#include "Arduino.h"
+
+#define U8X8_PIN_NONE 255
+
+// Each page on the wire is preceded by the I2C address, control bytes and
+// its page/column commands
+#define SH1106_PAGE_OVERHEAD 8
+#define SH1106_FRAME_BYTES (8 * (128 + SH1106_PAGE_OVERHEAD))
+
+struct u8g2_cb_t {};
+static const u8g2_cb_t u8g2_cb_r0 = {};
+#define U8G2_R0 (&u8g2_cb_r0)
+
+// Cell width and height
+static const uint8_t u8g2_font_5x7_tr[2] = {5, 7};
+static const uint8_t u8g2_font_6x10_tr[2] = {6, 10};
+static const uint8_t u8g2_font_7x13B_tr[2] = {7, 13};
+static const uint8_t u8g2_font_9x15B_tr[2] = {9, 15};
+static const uint8_t u8g2_font_logisoso16_tr[2] = {10, 16};
+
+class U8G2 : public Print {
+public:
+  bool begin() { return true; }
+  void setContrast(uint8_t) {}
+  void clearBuffer() { memset(buf, 0, sizeof(buf)); }
+  void setFont(const uint8_t* f) { font = f; }
+  void setCursor(int x, int y) {
+    cursor_x = x;
+    cursor_y = y;
+  }
+  void drawStr(int x, int y, const char* s) {
+    for (; *s; s++, x += font[0]) draw_glyph(x, y, (uint8_t)*s);
+  }
+  void drawPixel(int x, int y) {
+    if (x >= 0 && x < 128 && y >= 0 && y < 64) buf[(y / 8) * 128 + x] |= 1 << (y % 8);
+  }
+  void drawLine(int x0, int y0, int x1, int y1) {
+    int dx = abs(x1 - x0), dy = -abs(y1 - y0);
+    int sx = x0 < x1 ? 1 : -1, sy = y0 < y1 ? 1 : -1, err = dx + dy;
+    for (;;) {
+      drawPixel(x0, y0);
+      if (x0 == x1 && y0 == y1) break;
+      int e2 = 2 * err;
+      if (e2 >= dy) { err += dy; x0 += sx; }
+      if (e2 <= dx) { err += dx; y0 += sy; }
+    }
+  }
+  void drawFrame(int x, int y, int w, int h) {
+    if (w <= 0 || h <= 0) return;
+    drawLine(x, y, x + w - 1, y);
+    drawLine(x, y + h - 1, x + w - 1, y + h - 1);
+    drawLine(x, y, x, y + h - 1);
+    drawLine(x + w - 1, y, x + w - 1, y + h - 1);
+  }
+  void drawBox(int x, int y, int w, int h) {
+    for (int j = y; j < y + h; j++) {
+      for (int i = x; i < x + w; i++) drawPixel(i, j);
+    }
+  }
+
+  uint8_t* getBufferPtr() { return buf; }
+  uint8_t getBufferTileWidth() const { return 16; }
+  uint8_t getBufferTileHeight() const { return 8; }
+
+  void sendBuffer() {
+    SimCall call;
+    sim_display_send(SH1106_FRAME_BYTES);
+  }
+  // Tiles are 8x8 pixels: tx, tw in columns of 8, ty, th in pages
+  void updateDisplayArea(uint8_t tx, uint8_t ty, uint8_t tw, uint8_t th) {
+    (void)tx;
+    (void)ty;
+    SimCall call;
+    sim_display_send(th * (SH1106_PAGE_OVERHEAD + tw * 8));
+  }
+
+  size_t write(uint8_t c) override {
+    draw_glyph(cursor_x, cursor_y, c);
+    cursor_x += font[0];
+    return 1;
+  }
+  using Print::write;
+
+private:
+  // A fixed pseudo-random pattern per character, in the cell above the
+  // baseline at y
+  void draw_glyph(int x, int y, uint8_t c) {
+    if (c == ' ') return;
+    uint32_t bits = c * 2654435761u;
+    for (int j = 0; j < font[1]; j++) {
+      for (int i = 0; i < font[0] - 1; i++) {
+        bits = bits * 1103515245u + 12345u;
+        if (bits & 0x10000) drawPixel(x + i, y - font[1] + 1 + j);
+      }
+    }
+  }
+
+  uint8_t buf[8 * 128] = {0};
+  const uint8_t* font = u8g2_font_5x7_tr;
+  int cursor_x = 0;
+  int cursor_y = 0;
+};
+
+class U8G2_SH1106_128X64_NONAME_F_HW_I2C : public U8G2 {
+public:
+  U8G2_SH1106_128X64_NONAME_F_HW_I2C(const u8g2_cb_t*, uint8_t reset = U8X8_PIN_NONE) {
+    (void)reset;
+  }
+};
+
+#endif  // U8G2LIB_H
@@ -0,0 +1,75 @@
+// WiFi stub for the host simulator: connects at once with --wifi, never
+// otherwise, so setup() takes its offline path. UDP sends charge their
+// airtime to the virtual clock.
+
+#ifndef WIFI_H
+#define WIFI_H
+
+#include "Arduino.h"
+
+typedef enum {
+  WL_IDLE_STATUS = 0,
+  WL_NO_SSID_AVAIL = 1,
+  WL_CONNECTED = 3,
+  WL_DISCONNECTED = 6
+} wl_status_t;
+
+#define WIFI_STA 1
+
+class IPAddress : public Printable {
+public:
+  IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) : octets{a, b, c, d} {}
+  size_t printTo(Print& p) const override {
+    size_t n = 0;
+    for (int i = 0; i < 4; i++) {
+      if (i) n += p.print('.');
+      n += p.print((int)octets[i]);
+    }
+    return n;
+  }
+  String toString() const {
+    char buf[16];
+    snprintf(buf, sizeof(buf), "%u.%u.%u.%u", octets[0], octets[1], octets[2], octets[3]);
+    return String(buf);
+  }
+
+private:
+  uint8_t octets[4];
+};
+
+class WiFiClass {
+public:
+  void mode(int) {}
+  int begin(const char*, const char*) { return status(); }
+  wl_status_t status() { return sim_config().wifi ? WL_CONNECTED : WL_DISCONNECTED; }
+  IPAddress localIP() { return sim_config().wifi ? IPAddress(10, 0, 0, 2) : IPAddress(0, 0, 0, 0); }
+  int RSSI() { return sim_config().wifi ? -55 : 0; }
+};
+
+extern WiFiClass WiFi;
+
+class WiFiClient {};
+
+class WiFiUDP {
+public:
+  uint8_t begin(uint16_t) { return 1; }
+  int beginPacket(const char*, uint16_t) {
+    pending = 0;
+    return 1;
+  }
+  size_t write(const uint8_t*, size_t n) {
+    pending += n;
+    return n;
+  }
+  int endPacket() {
+    SimCall call;
+    sim_net_send(pending);
+    return 1;
+  }
+  void stop() {}
+
+private:
+  size_t pending = 0;
+};
+
+#endif  // WIFI_H
@@ -0,0 +1,146 @@
+// Arduino core stubs over the simulator's virtual clock (see Arduino.h).
+
+#include "Arduino.h"
+#include "WiFi.h"
+#include "Wire.h"
+
+HardwareSerial Serial;
+EspClass ESP;
+WiFiClass WiFi;
+TwoWire Wire;
+
+unsigned long millis() {
+  SimCall call;
+  sim_clock_read(CLOCK_MILLIS);
+  return sim_now_us() / 1000;
+}
+
+unsigned long micros() {
+  SimCall call;
+  sim_clock_read(CLOCK_MICROS);
+  return sim_now_us();
+}
+
+void delay(unsigned long ms) {
+  SimCall call;
+  sim_activity();
+  sim_advance((uint64_t)ms * 1000, COST_DELAY);
+}
+
+void delayMicroseconds(unsigned int us) {
+  SimCall call;
+  sim_activity();
+  sim_advance(us, COST_DELAY);
+}
+
+uint16_t analogRead(uint8_t pin) {
+  SimCall call;
+  (void)pin;
+  return sim_adc_read();
+}
+
+void analogReadResolution(uint8_t) {}
+void analogSetAttenuation(adc_attenuation_t) {}
+void pinMode(uint8_t, uint8_t) {}
+
+void digitalWrite(uint8_t pin, uint8_t val) {
+  sim_gpio_write(pin, val);
+}
+
+// ESP32 timers tick at 80 MHz / divider
+struct hw_timer_t {
+  uint8_t num;
+  uint16_t divider;
+  void (*isr)();
+  uint64_t ticks;
+  bool autoreload;
+  bool enabled;
+};
+
+static hw_timer_t timers[SIM_TIMERS];
+
+hw_timer_t* timerBegin(uint8_t num, uint16_t divider, bool) {
+  if (num >= SIM_TIMERS || !divider) return nullptr;
+  timers[num] = {num, divider, nullptr, 0, false, false};
+  return &timers[num];
+}
+
+void timerAttachInterrupt(hw_timer_t* timer, void (*isr)(), bool) {
+  timer->isr = isr;
+}
+
+// On an enabled alarm, as from its own ISR, the new value times the period
+// that began at the last alarm
+void timerAlarmWrite(hw_timer_t* timer, uint64_t ticks, bool autoreload) {
+  timer->ticks = ticks;
+  timer->autoreload = autoreload;
+  if (timer->enabled) sim_timer_retime(timer->num, ticks * timer->divider / 80, autoreload);
+}
+
+void timerAlarmEnable(hw_timer_t* timer) {
+  timer->enabled = true;
+  sim_timer_arm(timer->num, timer->ticks * timer->divider / 80, timer->autoreload, timer->isr);
+}
+
+void timerAlarmDisable(hw_timer_t* timer) {
+  timer->enabled = false;
+  sim_timer_disarm(timer->num);
+}
+
+// Counting restarts when the alarm is enabled
+void timerWrite(hw_timer_t*, uint64_t) {}
+
+void timerEnd(hw_timer_t* timer) {
+  timer->enabled = false;
+  sim_timer_disarm(timer->num);
+}
+
+// Handles are task index + 1, so none is null
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char*, uint32_t, void* arg,
+                                   UBaseType_t priority, TaskHandle_t* handle, BaseType_t) {
+  int task = sim_task_create(fn, arg, (int)priority);
+  if (handle) *handle = (TaskHandle_t)(intptr_t)(task + 1);
+  return pdPASS;
+}
+
+void vTaskDelay(TickType_t ticks) {
+  SimCall call;
+  sim_task_delay((uint64_t)ticks * portTICK_PERIOD_MS * 1000);
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task) {
+  sim_task_notify((int)(intptr_t)task - 1);
+  return pdPASS;
+}
+
+void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t* woken) {
+  sim_task_notify((int)(intptr_t)task - 1);
+  if (woken) *woken = pdTRUE;
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clear, TickType_t ticks) {
+  SimCall call;
+  return sim_task_notify_take(clear, ticks == portMAX_DELAY ? UINT64_MAX
+                                                           : (uint64_t)ticks * portTICK_PERIOD_MS * 1000);
+}
+
+long random(long max) {
+  return sim_random(0, max);
+}
+
+long random(long min, long max) {
+  return sim_random(min, max);
+}
+
+// As in the ESP32 core: an empty input range maps to -1 instead of faulting
+long map(long x, long in_min, long in_max, long out_min, long out_max) {
+  long run = in_max - in_min;
+  if (run == 0) return -1;
+  return (x - in_min) * (out_max - out_min) / run + out_min;
+}
+
+uint32_t EspClass::getCycleCount() {
+  SimCall call;
+  sim_clock_read(CLOCK_MICROS);
+  return (uint32_t)(sim_now_us() * 240);
+}
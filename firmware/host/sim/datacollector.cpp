@@ -0,0 +1,21 @@
+// esp32_datacollector_optimized.ino built against the simulator's Arduino
+// stubs
+
+#include "Arduino.h"
+
+// Prototypes the Arduino builder generates for sketch functions
+void execute_activity();
+void http_get(int size_bytes);
+void udp_send(int size_bytes);
+void add_binary_sample(int adc_raw, unsigned long t_us);
+void start_batch();
+void send_batch();
+void start_new_activity();
+void finish_activity();
+void collection_complete();
+void show_status(const char* line1, const char* line2);
+void update_display();
+
+#include "esp32_datacollector_optimized.ino"
+
+const char* const SIM_SKETCH = "esp32_datacollector_optimized";
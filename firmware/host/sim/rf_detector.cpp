@@ -0,0 +1,21 @@
+// esp32_rf_detector.ino built against the simulator's Arduino stubs
+
+#include "Arduino.h"
+#include "pipeline.h"
+#include "telemetry_format.h"
+
+// Prototypes the Arduino builder generates for sketch functions
+void feature_task(void*);
+void run_inference(uint32_t sample_t_us);
+void report(const Detection& d);
+void log_stage(LogRecord& r, const StageStats& stage);
+void log_task(void*);
+void trigger_mitigation(const Detection& d, int attack_type);
+void refresh_display();
+void show_boot_screen();
+void show_ready_screen();
+void update_display(int cls, unsigned long latency_us, bool changed);
+
+#include "esp32_rf_detector.ino"
+
+const char* const SIM_SKETCH = "esp32_rf_detector";
@@ -0,0 +1,622 @@
+// Virtual clock, cost models, ADC trace replay and sample-slot accounting
+// behind the Arduino stubs (see sim.h).
+
+#include "sim.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+
+#include <ucontext.h>
+
+#include "capture_store.h"
+
+const char* const SIM_COST_NAMES[NUM_COSTS] = {
+  "loop", "adc", "serial", "display", "delay", "net", "model", "cpu"
+};
+
+#define UART_FIFO_BYTES 128   // ESP32 UART TX FIFO; Serial has no extra buffer by default
+#define NET_BYTES_PER_US 1.25 // 10 Mbit/s of WiFi payload
+#define UDP_PACKET_US 50      // Per-datagram overhead
+#define UART_BITS_PER_BYTE 10
+#define I2C_BITS_PER_BYTE 9   // 8 data bits + ACK
+#define BUSY_RING 64          // Recent loop() passes kept for attributing missed slots
+#define TASK_STACK_BYTES (256 * 1024)  // Host frames are larger than the ESP32's
+#define NEVER UINT64_MAX
+#define SIM_PINS 40
+
+namespace {
+
+struct TracePoint {
+  double t_ms;
+  float mv;
+};
+
+struct BusyLoop {
+  uint64_t start_us;
+  uint64_t end_us;
+  uint64_t cost_us[NUM_COSTS];
+};
+
+struct SimTimer {
+  bool armed;
+  bool repeat;
+  uint64_t period_us;
+  uint64_t next_us;
+  uint64_t last_us;            // Last alarm, or when armed
+  void (*isr)();
+};
+
+// A FreeRTOS task as a coroutine: it runs, on its own stack, whenever it is
+// due and until it blocks
+struct SimTask {
+  ucontext_t ctx;
+  ucontext_t* back;            // What it preempted: loop() or a lower-priority task
+  std::vector<char> stack;
+  void (*fn)(void*);
+  void* arg;
+  int priority;
+  uint64_t wake_us;            // NEVER: waiting for a notification
+  uint32_t notified;
+  int timer;                   // Timer whose ISR last notified it, or -1
+  bool running;                // Running or preempted
+  bool finished;
+};
+
+struct Sim {
+  SimConfig config;
+  SimStats stats;
+  uint64_t now_us = 0;
+
+  // Sampling phase. Slots are --slot-us apart until the timer that reads
+  // the ADC is retimed; the grid then continues at its new period from the
+  // last sample.
+  bool sampling = false;
+  uint64_t t0_us = 0;
+  uint64_t slot_us = 0;
+  uint64_t slot_origin_us = 0;
+  uint64_t slot_origin = 0;
+  uint64_t next_slot = 0;
+  bool first_sample = true;
+  uint64_t last_adc_us = 0;
+
+  // Current loop() pass
+  uint64_t loop_start_us = 0;
+  uint64_t loop_cost_us[NUM_COSTS] = {0};
+  int clock_reads = 0;
+  bool active = false;
+  BusyLoop busy[BUSY_RING];
+  uint64_t busy_count = 0;
+
+  // UART
+  unsigned long baud = 115200;
+  double fifo_bytes = 0;
+  uint64_t fifo_at_us = 0;
+  size_t tx_buffer = 0;        // Serial.setTxBufferSize()
+  size_t serial_in_pos = 0;
+  FILE* serial_out = nullptr;
+
+  // Hardware timers and tasks; their stub calls do not count as loop()
+  // activity
+  SimTimer timers[SIM_TIMERS] = {};
+  bool in_isr = false;
+  int isr_timer = -1;
+  int adc_timer = -1;          // Last timer whose ISR read the ADC, or woke the task that did
+  std::vector<std::unique_ptr<SimTask>> tasks;
+  int current_task = -1;
+  ucontext_t loop_ctx;
+
+  // GPIO levels, for edge and high-time counts
+  uint8_t gpio_level[SIM_PINS] = {0};
+  uint64_t gpio_high_since[SIM_PINS] = {0};
+
+  // ADC source
+  std::vector<TracePoint> trace;
+  size_t trace_pos = 0;
+  uint64_t rng = 1;
+
+  // --cpu-scale
+  std::chrono::steady_clock::time_point host_mark;
+  int call_depth = 0;
+};
+
+Sim sim;
+
+bool off_loop() {
+  return sim.in_isr || sim.current_task >= 0;
+}
+
+void mark_active() {
+  if (!off_loop()) sim.active = true;
+}
+
+void charge(uint64_t us, SimCost cost) {
+  sim.now_us += us;
+  sim.stats.cost_us[cost] += us;
+  sim.loop_cost_us[cost] += us;
+}
+
+// The armed timer due first, or nullptr
+SimTimer* next_timer() {
+  SimTimer* next = nullptr;
+  for (SimTimer& t : sim.timers) {
+    if (t.armed && (!next || t.next_us < next->next_us)) next = &t;
+  }
+  return next;
+}
+
+// Priority of what is running; loop() is below every task
+int running_priority() {
+  return sim.current_task >= 0 ? sim.tasks[sim.current_task]->priority : -1;
+}
+
+// The task due first of those that may preempt priority `above`, or -1
+int next_task(int above = -1) {
+  int next = -1;
+  for (size_t i = 0; i < sim.tasks.size(); i++) {
+    const SimTask& k = *sim.tasks[i];
+    if (k.finished || k.running || k.wake_us == NEVER || k.priority <= above) continue;
+    if (next < 0 || k.wake_us < sim.tasks[next]->wake_us) next = (int)i;
+  }
+  return next;
+}
+
+void task_entry() {
+  SimTask& k = *sim.tasks[sim.current_task];
+  k.fn(k.arg);
+  k.finished = true;
+  setcontext(k.back);  // Back to the switch in run_task()
+}
+
+void run_task(int i) {
+  int preempted = sim.current_task;
+  SimTask& k = *sim.tasks[i];
+  k.back = preempted >= 0 ? &sim.tasks[preempted]->ctx : &sim.loop_ctx;
+  k.running = true;
+  sim.current_task = i;
+  swapcontext(k.back, &k.ctx);
+  k.running = false;
+  sim.current_task = preempted;
+}
+
+// Back to whatever the task preempted, until wake_us
+void block_task(uint64_t wake_us) {
+  SimTask& k = *sim.tasks[sim.current_task];
+  k.wake_us = wake_us;
+  swapcontext(&k.ctx, k.back);
+}
+
+uint64_t splitmix64(uint64_t x) {
+  x += 0x9E3779B97F4A7C15ull;
+  x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+  x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+  return x ^ (x >> 31);
+}
+
+double unit(uint64_t x) {
+  return (splitmix64(x) >> 11) * (1.0 / 9007199254740992.0);
+}
+
+void add_trace_point(double t, float mv) {
+  if (!sim.trace.empty() && t <= sim.trace.back().t_ms) return;
+  sim.trace.push_back({t, mv});
+}
+
+bool load_trace(const char* path) {
+  if (CaptureStore::is_capture(path)) {
+    CaptureStore store;
+    if (!store.open(path)) return false;
+    Span<uint32_t> t = store.timestamps(0, store.rows());
+    Span<int32_t> v = store.voltage(0, store.rows());
+    for (size_t i = 0; i < t.size; i++) {
+      if (v[i] != CAPTURE_NO_VOLTAGE) add_trace_point(t[i], (float)capture_mv(v[i]));
+    }
+  } else {
+    FILE* f = fopen(path, "r");
+    if (!f) {
+      fprintf(stderr, "cannot open trace %s\n", path);
+      return false;
+    }
+    // Collector CSV: timestamp_ms,voltage_mv,rssi_dbm,activity_id,activity_name
+    char line[256];
+    while (fgets(line, sizeof(line), f)) {
+      double t;
+      float mv;
+      if (sscanf(line, "%lf,%f", &t, &mv) == 2) add_trace_point(t, mv);  // Skips header, banners
+    }
+    fclose(f);
+  }
+  if (sim.trace.size() < 2) {
+    fprintf(stderr, "%s: no timestamp_ms,voltage_mv rows\n", path);
+    return false;
+  }
+  return true;
+}
+
+// Millivolts at virtual time t (since sampling began), from the trace held
+// sample-and-hold and looped, or from a seeded synthetic activity pattern
+float trace_mv(uint64_t t_us) {
+  if (!sim.trace.empty()) {
+    double span = sim.trace.back().t_ms - sim.trace.front().t_ms;
+    double t = fmod(t_us / 1000.0, span) + sim.trace.front().t_ms;
+    if (t < sim.trace[sim.trace_pos].t_ms) {
+      sim.trace_pos = 0;
+      sim.stats.trace_wraps++;
+    }
+    while (sim.trace_pos + 1 < sim.trace.size() && sim.trace[sim.trace_pos + 1].t_ms <= t) {
+      sim.trace_pos++;
+    }
+    return sim.trace[sim.trace_pos].mv;
+  }
+
+  // 20 s per activity; heavier activities burst harder and faster
+  uint64_t ms = t_us / 1000;
+  int activity = (int)((ms / 20000) % 6);
+  int period = 40 - activity * 6;
+  double u1 = unit(ms ^ (sim.config.seed * 0x51ED27ull));
+  double u2 = unit(~ms ^ (sim.config.seed * 0x51ED27ull));
+  double noise = sqrt(-2 * log(u1 + 1e-12)) * cos(2 * M_PI * u2) * 15;
+  return 1420 + noise + ((ms % period) < 2 ? 20.0 * activity : 0);
+}
+
+uint64_t slot_at(uint64_t t_us) {
+  return sim.slot_origin + (t_us - sim.slot_origin_us) / sim.slot_us;
+}
+
+void note_missed(uint64_t slot) {
+  SimMissedSlot m = {};
+  m.slot = slot;
+  m.slot_us = sim.slot_origin_us + (slot - sim.slot_origin) * sim.slot_us;
+  // The pass that was running when the slot opened: the current one, or a
+  // recent busy one
+  if (sim.loop_start_us <= m.slot_us) {
+    m.pass_start_us = sim.loop_start_us;
+    m.pass_us = sim.now_us - sim.loop_start_us;
+    memcpy(m.cost_us, sim.loop_cost_us, sizeof(m.cost_us));
+  } else {
+    uint64_t first = sim.busy_count > BUSY_RING ? sim.busy_count - BUSY_RING : 0;
+    for (uint64_t i = sim.busy_count; i-- > first;) {
+      const BusyLoop& b = sim.busy[i % BUSY_RING];
+      if (b.start_us <= m.slot_us && m.slot_us < b.end_us) {
+        m.pass_start_us = b.start_us;
+        m.pass_us = b.end_us - b.start_us;
+        memcpy(m.cost_us, b.cost_us, sizeof(m.cost_us));
+        break;
+      }
+    }
+  }
+  sim.stats.missed.push_back(m);
+}
+
+}  // namespace
+
+// Bytes the UART has sent since the last write
+static void drain_uart() {
+  double byte_us = 1e6 * UART_BITS_PER_BYTE / sim.baud;
+  sim.fifo_bytes -= (sim.now_us - sim.fifo_at_us) / byte_us;
+  if (sim.fifo_bytes < 0) sim.fifo_bytes = 0;
+  sim.fifo_at_us = sim.now_us;
+}
+
+bool sim_init(const SimConfig& config) {
+  if (sim.serial_out) fclose(sim.serial_out);
+  sim = Sim();
+  sim.config = config;
+  sim.slot_us = config.slot_us;
+  if (config.serial_out && !(sim.serial_out = fopen(config.serial_out, "wb"))) {
+    fprintf(stderr, "cannot write %s\n", config.serial_out);
+    return false;
+  }
+  sim.rng = splitmix64(config.seed);
+  sim.host_mark = std::chrono::steady_clock::now();
+  return !config.trace || load_trace(config.trace);
+}
+
+const SimConfig& sim_config() { return sim.config; }
+SimStats& sim_stats() { return sim.stats; }
+uint64_t sim_now_us() { return sim.now_us; }
+
+// Timer interrupts and tasks due before the end run at their own time, as
+// on the other core or in an ISR; what they call is charged and pushes the
+// end out by as much. A task preempts only lower-priority tasks, never ISRs.
+void sim_advance(uint64_t us, SimCost cost) {
+  uint64_t end = sim.now_us + us;
+  for (;;) {
+    SimTimer* t = sim.in_isr ? nullptr : next_timer();
+    int task = sim.in_isr ? -1 : next_task(running_priority());
+    uint64_t timer_due = t ? t->next_us : NEVER;
+    uint64_t task_due = task >= 0 ? sim.tasks[task]->wake_us : NEVER;
+    uint64_t due = timer_due < task_due ? timer_due : task_due;
+    if (due > end) break;
+    if (due > sim.now_us) charge(due - sim.now_us, cost);
+    uint64_t start = sim.now_us;
+    if (timer_due <= task_due) {
+      t->armed = t->repeat;
+      t->last_us = t->next_us;
+      t->next_us += t->period_us;
+      sim.stats.timer_interrupts++;
+      sim.in_isr = true;
+      sim.isr_timer = t - sim.timers;
+      t->isr();
+      sim.in_isr = false;
+      sim.isr_timer = -1;
+    } else {
+      sim.stats.task_switches++;
+      run_task(task);
+    }
+    end += sim.now_us - start;
+  }
+  if (end > sim.now_us) charge(end - sim.now_us, cost);
+}
+
+void sim_begin_sampling() {
+  sim.stats.setup_us = sim.now_us;
+  memset(sim.stats.cost_us, 0, sizeof(sim.stats.cost_us));
+  sim.stats.serial_bytes = 0;
+  sim.stats.display_transfers = 0;
+  sim.stats.display_bytes = 0;
+  sim.stats.model_invokes = 0;
+  sim.stats.model_rows = 0;
+  sim.stats.timer_interrupts = 0;
+  sim.stats.task_switches = 0;
+  sim.stats.gpio_edges = 0;
+  sim.stats.gpio_high_us = 0;
+  sim.sampling = true;
+  sim.t0_us = sim.now_us;
+  sim.slot_us = sim.config.slot_us;
+  sim.slot_origin_us = sim.t0_us;
+  sim.slot_origin = 0;
+}
+
+uint64_t sim_slots() {
+  return sim.sampling ? slot_at(sim.now_us) : 0;
+}
+
+void sim_loop_begin() {
+  sim.loop_start_us = sim.now_us;
+  memset(sim.loop_cost_us, 0, sizeof(sim.loop_cost_us));
+  sim.clock_reads = 0;
+  sim.active = false;
+}
+
+void sim_loop_end() {
+  sim.stats.loops++;
+  uint64_t step = sim.config.loop_us;
+  if (!sim.active) {
+    // The pass only polled the clock, so nothing changes until the value it
+    // polls does: the next millisecond for millis(), or one slot after the
+    // last sample for micros() (both sketches poll now - last >= period)
+    uint64_t next = sim.now_us + step;
+    if (sim.clock_reads == CLOCK_MILLIS) {
+      next = (sim.now_us / 1000 + 1) * 1000;
+    } else if (sim.last_adc_us + sim.slot_us > sim.now_us) {
+      next = sim.last_adc_us + sim.slot_us;
+    }
+    // Or until a timer interrupt or task, which may queue work for loop()
+    SimTimer* t = next_timer();
+    if (t && t->next_us < next) next = t->next_us > sim.now_us ? t->next_us : sim.now_us + step;
+    int task = next_task();
+    if (task >= 0 && sim.tasks[task]->wake_us < next) {
+      next = sim.tasks[task]->wake_us > sim.now_us ? sim.tasks[task]->wake_us : sim.now_us + step;
+    }
+    step = next - sim.now_us;
+  }
+  sim_advance(step, COST_LOOP);
+
+  uint64_t took = sim.now_us - sim.loop_start_us;
+  if (sim.active) {
+    BusyLoop& b = sim.busy[sim.busy_count++ % BUSY_RING];
+    b.start_us = sim.loop_start_us;
+    b.end_us = sim.now_us;
+    memcpy(b.cost_us, sim.loop_cost_us, sizeof(b.cost_us));
+    if (took > sim.stats.longest_loop_us) sim.stats.longest_loop_us = took;
+  }
+}
+
+void sim_clock_read(int kind) {
+  if (!off_loop()) sim.clock_reads |= kind;
+}
+
+void sim_activity() {
+  mark_active();
+}
+
+void sim_gpio_write(uint8_t pin, uint8_t val) {
+  mark_active();
+  if (pin >= SIM_PINS || !val == !sim.gpio_level[pin]) return;
+  sim.gpio_level[pin] = val ? 1 : 0;
+  if (val) {
+    sim.gpio_high_since[pin] = sim.now_us;
+  } else if (sim.sampling) {
+    sim.stats.gpio_high_us += sim.now_us - std::max(sim.gpio_high_since[pin], sim.t0_us);
+  }
+  if (sim.sampling) sim.stats.gpio_edges++;
+}
+
+int sim_adc_read() {
+  mark_active();
+  uint64_t t = sim.now_us;
+  if (sim.sampling) {
+    if (sim.in_isr) sim.adc_timer = sim.isr_timer;
+    else if (sim.current_task >= 0 && sim.tasks[sim.current_task]->timer >= 0) {
+      sim.adc_timer = sim.tasks[sim.current_task]->timer;
+    }
+    uint64_t slot = slot_at(t);
+    if (sim.first_sample) {
+      sim.first_sample = false;
+    } else {
+      for (uint64_t s = sim.next_slot; s < slot; s++) note_missed(s);
+      if (t - sim.last_adc_us > sim.stats.max_gap_us) sim.stats.max_gap_us = t - sim.last_adc_us;
+    }
+    if (slot >= sim.next_slot) sim.next_slot = slot + 1;
+    sim.stats.samples++;
+  }
+  sim.last_adc_us = t;
+  float mv = trace_mv(t - sim.t0_us);
+  sim_advance(sim.config.adc_us, COST_ADC);
+  int code = (int)lroundf(mv / 3300.0f * 4095.0f);
+  return code < 0 ? 0 : (code > 4095 ? 4095 : code);
+}
+
+void sim_serial_begin(unsigned long baud) {
+  sim.baud = baud;
+  sim.fifo_bytes = 0;
+  sim.fifo_at_us = sim.now_us;
+}
+
+void sim_serial_write(const uint8_t* buf, size_t n) {
+  mark_active();
+  sim.stats.serial_bytes += n;
+  if (sim.config.echo_serial) {
+    for (size_t i = 0; i < n; i++) {
+      if (buf[i] != '\r') putchar(buf[i]);
+    }
+  }
+  if (sim.serial_out) fwrite(buf, 1, n, sim.serial_out);
+
+  // The FIFO (plus any TX buffer) drains at the baud rate; writes block
+  // while it is full
+  drain_uart();
+  size_t capacity = UART_FIFO_BYTES + sim.tx_buffer;
+  sim.fifo_bytes += n;
+  if (sim.fifo_bytes > capacity) {
+    double byte_us = 1e6 * UART_BITS_PER_BYTE / sim.baud;
+    uint64_t wait = (uint64_t)ceil((sim.fifo_bytes - capacity) * byte_us);
+    sim_advance(wait, COST_SERIAL);
+    sim.fifo_bytes = capacity;
+  }
+  sim.fifo_at_us = sim.now_us;
+}
+
+void sim_serial_tx_buffer(size_t bytes) {
+  sim.tx_buffer = bytes;
+}
+
+int sim_serial_available_for_write() {
+  drain_uart();
+  return (int)(UART_FIFO_BYTES + sim.tx_buffer - ceil(sim.fifo_bytes));
+}
+
+int sim_serial_available() {
+  return (int)(strlen(sim.config.serial_in) - sim.serial_in_pos);
+}
+
+int sim_serial_read() {
+  mark_active();
+  if (!sim_serial_available()) return -1;
+  return (uint8_t)sim.config.serial_in[sim.serial_in_pos++];
+}
+
+void sim_net_request(size_t bytes) {
+  mark_active();
+  sim_advance(sim.config.net_us + (uint64_t)(bytes / NET_BYTES_PER_US), COST_NET);
+}
+
+void sim_net_send(size_t bytes) {
+  mark_active();
+  sim_advance(UDP_PACKET_US + (uint64_t)(bytes / NET_BYTES_PER_US), COST_NET);
+}
+
+void sim_display_send(size_t bytes) {
+  mark_active();
+  sim.stats.display_transfers++;
+  sim.stats.display_bytes += bytes;
+  sim_advance((uint64_t)ceil(bytes * I2C_BITS_PER_BYTE * 1e6 / sim.config.i2c_hz), COST_DISPLAY);
+}
+
+void sim_model_invoke(int rows) {
+  mark_active();
+  sim.stats.model_invokes++;
+  sim.stats.model_rows += rows;
+  sim_advance((uint64_t)sim.config.model_us * rows, COST_MODEL);
+}
+
+void sim_timer_arm(int num, uint64_t period_us, bool repeat, void (*isr)()) {
+  if (num < 0 || num >= SIM_TIMERS || !isr) return;
+  if (period_us == 0) period_us = 1;
+  sim.timers[num] = {true, repeat, period_us, sim.now_us + period_us, sim.now_us, isr};
+}
+
+void sim_timer_retime(int num, uint64_t period_us, bool repeat) {
+  if (num < 0 || num >= SIM_TIMERS || !sim.timers[num].armed) return;
+  SimTimer& t = sim.timers[num];
+  t.period_us = period_us ? period_us : 1;
+  t.repeat = repeat;
+  t.next_us = t.last_us + t.period_us;
+  if (sim.sampling && num == sim.adc_timer && t.period_us != sim.slot_us) {
+    sim.slot_origin = sim.next_slot ? sim.next_slot - 1 : 0;
+    sim.slot_origin_us = t.last_us;
+    sim.slot_us = t.period_us;
+    sim.stats.rate_changes++;
+  }
+}
+
+void sim_timer_disarm(int num) {
+  if (num >= 0 && num < SIM_TIMERS) sim.timers[num].armed = false;
+}
+
+int sim_task_create(void (*fn)(void*), void* arg, int priority) {
+  std::unique_ptr<SimTask> k(new SimTask());
+  k->stack.resize(TASK_STACK_BYTES);
+  k->fn = fn;
+  k->arg = arg;
+  k->priority = priority;
+  k->wake_us = sim.now_us;
+  k->timer = -1;
+  getcontext(&k->ctx);
+  k->ctx.uc_stack.ss_sp = k->stack.data();
+  k->ctx.uc_stack.ss_size = k->stack.size();
+  k->ctx.uc_link = &sim.loop_ctx;
+  makecontext(&k->ctx, task_entry, 0);
+  sim.tasks.push_back(std::move(k));
+  return (int)sim.tasks.size() - 1;
+}
+
+void sim_task_delay(uint64_t us) {
+  if (sim.current_task < 0) {
+    sim_activity();
+    sim_advance(us, COST_DELAY);
+    return;
+  }
+  block_task(sim.now_us + us);
+}
+
+void sim_task_notify(int task) {
+  if (task < 0 || task >= (int)sim.tasks.size()) return;
+  SimTask& k = *sim.tasks[task];
+  k.notified++;
+  if (sim.in_isr) k.timer = sim.isr_timer;
+  if (k.wake_us > sim.now_us) k.wake_us = sim.now_us;
+}
+
+uint32_t sim_task_notify_take(bool clear, uint64_t timeout_us) {
+  if (sim.current_task < 0) return 0;
+  SimTask& k = *sim.tasks[sim.current_task];
+  if (!k.notified && timeout_us) block_task(timeout_us == NEVER ? NEVER : sim.now_us + timeout_us);
+  uint32_t value = k.notified;
+  if (clear) k.notified = 0;
+  else if (value) k.notified--;
+  return value;
+}
+
+long sim_random(long lo, long hi) {
+  if (hi <= lo) return lo;
+  sim.rng = splitmix64(sim.rng);
+  return lo + (long)(sim.rng % (uint64_t)(hi - lo));
+}
+
+SimCall::SimCall() {
+  if (sim.config.cpu_scale <= 0 || sim.call_depth++) return;
+  auto now = std::chrono::steady_clock::now();
+  double ns = std::chrono::duration<double, std::nano>(now - sim.host_mark).count();
+  sim_advance((uint64_t)(ns * sim.config.cpu_scale / 1000), COST_CPU);
+}
+
+SimCall::~SimCall() {
+  if (sim.config.cpu_scale <= 0 || --sim.call_depth) return;
+  sim.host_mark = std::chrono::steady_clock::now();
+}
@@ -0,0 +1,130 @@
+// Virtual-clock simulator for the detector and data collector sketches. The Arduino stubs in
+// this directory charge modeled costs (UART drain, I2C frame transfer,
+// delays, model invoke) to a virtual microsecond clock, and analogRead()
+// replays a recorded or synthetic trace against it, so setup()/loop() run
+// deterministically and far faster than real time.
+
+#ifndef SIM_H
+#define SIM_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <vector>
+
+// Where virtual time went
+enum SimCost {
+  COST_LOOP,     // Fixed cost of one loop() pass
+  COST_ADC,      // analogRead() conversions
+  COST_SERIAL,   // Blocking on a full UART TX FIFO
+  COST_DISPLAY,  // I2C frame transfers
+  COST_DELAY,    // delay() / delayMicroseconds()
+  COST_NET,      // HTTP requests and UDP sends
+  COST_MODEL,    // Stubbed model invoke
+  COST_CPU,      // Scaled host CPU time (--cpu-scale only)
+  NUM_COSTS
+};
+
+extern const char* const SIM_COST_NAMES[NUM_COSTS];
+
+struct SimConfig {
+  double seconds = 1800;       // Simulated time after setup()
+  uint32_t slot_us = 5000;     // Sample period the sketch polls for
+  uint32_t loop_us = 1;        // Virtual cost of one loop() pass
+  uint32_t adc_us = 10;        // One analogRead() conversion
+  uint32_t model_us = 45000;   // Stubbed TFLite invoke per window row (README: 45 ms)
+  uint32_t i2c_hz = 400000;    // OLED bus clock
+  uint32_t net_us = 20000;     // HTTP request round trip, before the body
+  double cpu_scale = 0;        // >0 adds host CPU time * scale: not deterministic
+  bool wifi = false;           // WiFi.status() reports connected
+  bool echo_serial = false;    // Copy sketch serial output to stdout
+  const char* trace = nullptr; // Capture CSV/.rfcap; nullptr: synthetic
+  const char* serial_out = nullptr; // Raw copy of sketch serial output
+  const char* serial_in = "\n";    // Host-to-sketch bytes, there from the start
+  uint32_t seed = 1;           // Synthetic trace and random()
+};
+
+// A sample slot with no analogRead(), and the loop() pass that covered it
+struct SimMissedSlot {
+  uint64_t slot;               // Slot index since setup() returned
+  uint64_t slot_us;            // Slot start, virtual time
+  uint64_t pass_start_us;      // Covering loop() pass; 0 when idle
+  uint64_t pass_us;
+  uint64_t cost_us[NUM_COSTS];
+};
+
+struct SimStats {
+  uint64_t setup_us = 0;
+  uint64_t loops = 0;
+  uint64_t samples = 0;
+  uint64_t serial_bytes = 0;
+  uint64_t display_transfers = 0;
+  uint64_t display_bytes = 0;
+  uint64_t model_invokes = 0;
+  uint64_t model_rows = 0;
+  uint64_t timer_interrupts = 0;
+  uint64_t task_switches = 0;
+  uint64_t gpio_edges = 0;     // digitalWrite() level changes
+  uint64_t gpio_high_us = 0;   // Summed over pins
+  uint64_t longest_loop_us = 0;
+  uint64_t max_gap_us = 0;     // Longest interval between two samples
+  uint64_t rate_changes = 0;   // Retimes of the timer that reads the ADC
+  uint64_t cost_us[NUM_COSTS] = {0};
+  uint64_t trace_wraps = 0;
+  std::vector<SimMissedSlot> missed;
+};
+
+// Name of the sketch linked into this simulator binary
+extern const char* const SIM_SKETCH;
+
+// Provided by the sketch
+void setup();
+void loop();
+
+bool sim_init(const SimConfig& config);
+const SimConfig& sim_config();
+SimStats& sim_stats();
+
+uint64_t sim_now_us();
+void sim_advance(uint64_t us, SimCost cost);
+
+// Called by the driver around setup() and each loop() pass
+void sim_begin_sampling();
+uint64_t sim_slots();        // Sample slots so far, at the rate of each stretch
+void sim_loop_begin();
+void sim_loop_end();
+
+// Stub hooks
+enum SimClockRead { CLOCK_MILLIS = 1, CLOCK_MICROS = 2 };
+void sim_clock_read(int kind);
+void sim_activity();
+void sim_gpio_write(uint8_t pin, uint8_t val);
+int sim_adc_read();
+void sim_serial_begin(unsigned long baud);
+void sim_serial_write(const uint8_t* buf, size_t n);
+void sim_serial_tx_buffer(size_t bytes);
+int sim_serial_available_for_write();
+int sim_serial_read();
+int sim_serial_available();
+void sim_net_request(size_t bytes);
+void sim_net_send(size_t bytes);
+void sim_display_send(size_t bytes);
+void sim_model_invoke(int rows);  // Rows of a batched input tensor
+#define SIM_TIMERS 4
+void sim_timer_arm(int num, uint64_t period_us, bool repeat, void (*isr)());
+void sim_timer_retime(int num, uint64_t period_us, bool repeat);  // From the last alarm
+void sim_timer_disarm(int num);
+// FreeRTOS tasks run as coroutines on the virtual clock (see sim.cpp)
+int sim_task_create(void (*fn)(void*), void* arg, int priority);
+void sim_task_delay(uint64_t us);        // From loop(), as delay()
+void sim_task_notify(int task);
+uint32_t sim_task_notify_take(bool clear, uint64_t timeout_us);  // UINT64_MAX: no timeout
+long sim_random(long lo, long hi);
+
+// Host CPU accounting for --cpu-scale: stubs open one per call so the
+// sketch's own computation between stub calls is charged to COST_CPU
+struct SimCall {
+  SimCall();
+  ~SimCall();
+};
+
+#endif  // SIM_H
@@ -0,0 +1,165 @@
+// Runs a detector sketch's setup() and loop() on the virtual clock and
+// reports throughput, where the time went, and every sample slot loop()
+// missed.
+//
+// Usage: sim_<sketch> [--trace capture.csv] [--seconds S] [--missed FILE]
+//                     [--max-missed N] [--serial] [--wifi] [--seed N]
+//                     [--slot-us US] [--adc-us US] [--model-us US]
+//                     [--i2c-hz HZ] [--loop-us US] [--cpu-scale X]
+//                     [--net-us US] [--serial-out FILE] [--serial-in TEXT]
+// --trace replays a collector CSV (timestamp_ms,voltage_mv,...) or a
+// .rfcap capture, looping it if it is shorter than --seconds; without it a
+// seeded synthetic trace is used. --missed writes one CSV row per missed slot. Exits non-zero if
+// more than --max-missed slots were missed. --serial-out saves the sketch's
+// serial output byte for byte; --serial-in is what the host has sent (a
+// newline by default, the collector's "press any key").
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "sim.h"
+
+#define SHOW_MISSED 10
+
+static void write_missed(const char* path, const SimStats& stats) {
+  FILE* f = fopen(path, "w");
+  if (!f) {
+    fprintf(stderr, "cannot write %s\n", path);
+    return;
+  }
+  fprintf(f, "slot,slot_us,pass_start_us,pass_us");
+  for (int c = 0; c < NUM_COSTS; c++) fprintf(f, ",%s_us", SIM_COST_NAMES[c]);
+  fprintf(f, "\n");
+  for (const SimMissedSlot& m : stats.missed) {
+    fprintf(f, "%llu,%llu,%llu,%llu", (unsigned long long)m.slot,
+            (unsigned long long)m.slot_us, (unsigned long long)m.pass_start_us,
+            (unsigned long long)m.pass_us);
+    for (int c = 0; c < NUM_COSTS; c++) fprintf(f, ",%llu", (unsigned long long)m.cost_us[c]);
+    fprintf(f, "\n");
+  }
+  fclose(f);
+}
+
+static void print_missed(const SimMissedSlot& m) {
+  printf("    slot %llu at %.3f s: ", (unsigned long long)m.slot, m.slot_us / 1e6);
+  if (!m.pass_us) {
+    printf("no loop() pass covers it\n");
+    return;
+  }
+  printf("loop() from %.3f s ran %.2f ms (", m.pass_start_us / 1e6, m.pass_us / 1000.0);
+  const char* sep = "";
+  for (int c = 0; c < NUM_COSTS; c++) {
+    if (m.cost_us[c] * 20 < m.pass_us) continue;  // Under 5%
+    printf("%s%s %.2f", sep, SIM_COST_NAMES[c], m.cost_us[c] / 1000.0);
+    sep = ", ";
+  }
+  printf(")\n");
+}
+
+int main(int argc, char** argv) {
+  SimConfig config;
+  const char* missed_path = nullptr;
+  long max_missed = -1;
+  for (int i = 1; i < argc; i++) {
+    const char* arg = argv[i];
+    const char* value = i + 1 < argc ? argv[i + 1] : nullptr;
+    if (!strcmp(arg, "--serial")) config.echo_serial = true;
+    else if (!strcmp(arg, "--wifi")) config.wifi = true;
+    else if (!value) {
+      fprintf(stderr, "unknown or incomplete option %s\n", arg);
+      return 2;
+    }
+    else if (!strcmp(arg, "--trace")) config.trace = argv[++i];
+    else if (!strcmp(arg, "--seconds")) config.seconds = atof(argv[++i]);
+    else if (!strcmp(arg, "--missed")) missed_path = argv[++i];
+    else if (!strcmp(arg, "--max-missed")) max_missed = atol(argv[++i]);
+    else if (!strcmp(arg, "--seed")) config.seed = atoi(argv[++i]);
+    else if (!strcmp(arg, "--slot-us")) config.slot_us = atoi(argv[++i]);
+    else if (!strcmp(arg, "--adc-us")) config.adc_us = atoi(argv[++i]);
+    else if (!strcmp(arg, "--model-us")) config.model_us = atoi(argv[++i]);
+    else if (!strcmp(arg, "--i2c-hz")) config.i2c_hz = atoi(argv[++i]);
+    else if (!strcmp(arg, "--loop-us")) config.loop_us = atoi(argv[++i]);
+    else if (!strcmp(arg, "--cpu-scale")) config.cpu_scale = atof(argv[++i]);
+    else if (!strcmp(arg, "--net-us")) config.net_us = atoi(argv[++i]);
+    else if (!strcmp(arg, "--serial-out")) config.serial_out = argv[++i];
+    else if (!strcmp(arg, "--serial-in")) config.serial_in = argv[++i];
+    else {
+      fprintf(stderr, "unknown option %s\n", arg);
+      return 2;
+    }
+  }
+  if (config.slot_us == 0 || config.loop_us == 0 || config.i2c_hz == 0) {
+    fprintf(stderr, "--slot-us, --loop-us and --i2c-hz must be positive\n");
+    return 2;
+  }
+  if (!sim_init(config)) return 1;
+
+  auto wall_start = std::chrono::steady_clock::now();
+  setup();
+  sim_begin_sampling();
+  uint64_t end_us = sim_now_us() + (uint64_t)(config.seconds * 1e6);
+  while (sim_now_us() < end_us) {
+    sim_loop_begin();
+    loop();
+    sim_loop_end();
+  }
+  double wall = std::chrono::duration<double>(std::chrono::steady_clock::now() - wall_start).count();
+
+  const SimStats& stats = sim_stats();
+  uint64_t simulated_us = sim_now_us() - stats.setup_us;
+  uint64_t slots = sim_slots();
+  if (config.echo_serial) printf("\n");
+  printf("%s: %.1f s simulated after %.1f s of setup(), %.2f s wall (%.0fx real time)\n",
+         SIM_SKETCH, simulated_us / 1e6, stats.setup_us / 1e6, wall, simulated_us / 1e6 / wall);
+  printf("  trace:      %s", config.trace ? config.trace : "synthetic");
+  if (stats.trace_wraps) printf(" (looped %llu times)", (unsigned long long)stats.trace_wraps);
+  printf("\n");
+  printf("  samples:    %llu of %llu %u us slots, %zu missed, max gap %.2f ms\n",
+         (unsigned long long)stats.samples, (unsigned long long)slots, config.slot_us,
+         stats.missed.size(), stats.max_gap_us / 1000.0);
+  if (stats.rate_changes) {
+    printf("              sample timer retimed %llu times; slots follow its period\n",
+           (unsigned long long)stats.rate_changes);
+  }
+  printf("  loop():     %llu passes, longest %.2f ms\n", (unsigned long long)stats.loops,
+         stats.longest_loop_us / 1000.0);
+  printf("  serial:     %llu bytes\n", (unsigned long long)stats.serial_bytes);
+  printf("  display:    %llu transfers, %llu bytes\n", (unsigned long long)stats.display_transfers,
+         (unsigned long long)stats.display_bytes);
+  if (stats.model_invokes) {
+    printf("  model:      %llu invokes of %llu windows (stubbed, %u us a window)\n",
+           (unsigned long long)stats.model_invokes, (unsigned long long)stats.model_rows, config.model_us);
+  }
+  if (stats.timer_interrupts) {
+    printf("  timers:     %llu interrupts\n", (unsigned long long)stats.timer_interrupts);
+  }
+  if (stats.gpio_edges) {
+    printf("  gpio:       %llu edges, %.1f ms high\n", (unsigned long long)stats.gpio_edges,
+           stats.gpio_high_us / 1000.0);
+  }
+  if (stats.task_switches) {
+    printf("  tasks:      %llu switches\n", (unsigned long long)stats.task_switches);
+  }
+  printf("  busy time: ");
+  for (int c = 0; c < NUM_COSTS; c++) {
+    if (c == COST_LOOP || !stats.cost_us[c]) continue;
+    printf(" %s %.2f%%", SIM_COST_NAMES[c], 100.0 * stats.cost_us[c] / simulated_us);
+  }
+  printf("\n");
+
+  if (!stats.missed.empty()) {
+    printf("  missed slots%s:\n", stats.missed.size() > SHOW_MISSED ? " (first 10)" : "");
+    for (size_t i = 0; i < stats.missed.size() && i < SHOW_MISSED; i++) {
+      print_missed(stats.missed[i]);
+    }
+  }
+  if (missed_path) write_missed(missed_path, stats);
+
+  if (max_missed >= 0 && (long)stats.missed.size() > max_missed) {
+    printf("  over limit: %zu missed slots > %ld\n", stats.missed.size(), max_missed);
+    return 1;
+  }
+  return 0;
+}
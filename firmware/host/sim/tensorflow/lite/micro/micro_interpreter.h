@@ -0,0 +1,2 @@
+// TensorFlow Lite Micro stub: everything is in TensorFlowLite_ESP32.h
+#include "TensorFlowLite_ESP32.h"
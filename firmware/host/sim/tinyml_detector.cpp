@@ -0,0 +1,16 @@
+// esp32_tinyml_detector.ino built against the simulator's Arduino stubs
+
+#include "Arduino.h"
+
+// Prototypes the Arduino builder generates for sketch functions
+void run_inference();
+void run_model();
+void report_window(int window_class, bool early_exit, unsigned long inference_time);
+void apply_rate();
+void show_boot_screen();
+void show_ready_screen();
+void update_display(int predicted_class, unsigned long latency_us);
+
+#include "esp32_tinyml_detector.ino"
+
+const char* const SIM_SKETCH = "esp32_tinyml_detector";
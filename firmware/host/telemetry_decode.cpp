@@ -0,0 +1,180 @@
+// Decodes the RF detector's binary telemetry (LOG_BINARY, see
+// 2_tinyml_inference/telemetry_format.h) back into the text log the sketch
+// used to print, from a saved stream or straight from the board.
+//
+// Usage: telemetry_decode (STREAM | --port DEVICE [--baud N]) [--level 0-3]
+// Decoded records and any text the sketch prints between frames go to
+// stdout; the link summary goes to stderr at the end (or on Ctrl-C with
+// --port). --level sends the digit that sets the detector's log level.
+// Exits non-zero if no record decoded.
+
+#include <cerrno>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+#include "serial_port.h"
+#include "telemetry_format.h"
+
+static volatile sig_atomic_t interrupted = 0;
+
+static void on_sigint(int) { interrupted = 1; }
+
+struct Decoder {
+  std::vector<std::string> names;
+  std::vector<const char*> name_ptrs;
+  int features = 0;
+
+  uint64_t records = 0, bad_frames = 0, text_lines = 0;
+  uint64_t by_type[4] = {0};  // LOG_INFO..LOG_MITIGATION
+  uint32_t device_dropped = 0;
+
+  std::vector<uint8_t> pending;
+  std::vector<uint8_t> payload;
+  char text_out[LOG_TEXT_MAX];
+
+  void feed(const uint8_t* p, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+      if (p[i]) {
+        pending.push_back(p[i]);
+        continue;
+      }
+      if (!pending.empty()) frame(pending);
+      pending.clear();
+    }
+  }
+
+  // Text after the last delimiter
+  void finish() {
+    if (!pending.empty()) text(pending);
+    pending.clear();
+  }
+
+  // Bytes between two delimiters: a frame, or text printed between frames
+  void frame(const std::vector<uint8_t>& bytes) {
+    payload.resize(bytes.size());
+    size_t n = log_unframe(bytes.data(), bytes.size(), payload.data());
+    if (!n) {
+      text(bytes);
+      return;
+    }
+    uint8_t type = payload[0];
+    if (type == LOG_INFO) {
+      info(n);
+      return;
+    }
+    size_t len = format_log_record(payload.data(), n, name_ptrs.empty() ? nullptr : name_ptrs.data(),
+                                   (int)name_ptrs.size(), features, text_out);
+    if (!len) {
+      bad_frames++;
+      return;
+    }
+    records++;
+    by_type[type - LOG_INFO]++;
+    if (type == LOG_STATS) device_dropped = get_u32_at(LOG_STATS_LOG_DROPPED);
+    fwrite(text_out, 1, len, stdout);
+  }
+
+  void text(const std::vector<uint8_t>& bytes) {
+    size_t printable = 0;
+    for (uint8_t c : bytes) printable += c >= 0x20 || c == '\n' || c == '\r' || c == '\t' || c >= 0x80;
+    if (printable < bytes.size()) {
+      bad_frames++;
+      return;
+    }
+    for (uint8_t c : bytes) text_lines += c == '\n';
+    fwrite(bytes.data(), 1, bytes.size(), stdout);
+  }
+
+  void info(size_t n) {
+    if (n < 4 || payload[1] != TELEMETRY_VERSION) {
+      bad_frames++;
+      return;
+    }
+    records++;
+    by_type[0]++;
+    features = payload[2];
+    names.clear();
+    size_t at = 4;
+    for (int c = 0; c < payload[3] && at < n; c++) {
+      const char* name = (const char*)&payload[at];
+      size_t len = strnlen(name, n - at);
+      names.emplace_back(name, len);
+      at += len + 1;
+    }
+    name_ptrs.clear();
+    for (const std::string& name : names) name_ptrs.push_back(name.c_str());
+  }
+
+  uint32_t get_u32_at(size_t at) const {
+    return payload[at] | (payload[at + 1] << 8) | (payload[at + 2] << 16) | ((uint32_t)payload[at + 3] << 24);
+  }
+};
+
+int main(int argc, char** argv) {
+  const char* stream_path = nullptr;
+  const char* port = nullptr;
+  int baud = 115200;
+  int level = -1;
+  for (int i = 1; i < argc; i++) {
+    const char* arg = argv[i];
+    const char* value = i + 1 < argc ? argv[i + 1] : nullptr;
+    if (arg[0] != '-' && !stream_path) stream_path = arg;
+    else if (!value) {
+      fprintf(stderr, "unknown or incomplete option %s\n", arg);
+      return 2;
+    }
+    else if (!strcmp(arg, "--port")) port = argv[++i];
+    else if (!strcmp(arg, "--baud")) baud = atoi(argv[++i]);
+    else if (!strcmp(arg, "--level")) level = atoi(argv[++i]);
+    else {
+      fprintf(stderr, "unknown option %s\n", arg);
+      return 2;
+    }
+  }
+  if (!stream_path == !port || level > LEVEL_STATS || (level >= 0 && !port)) {
+    fprintf(stderr, "usage: telemetry_decode (STREAM | --port DEVICE [--baud N] [--level 0-3])\n");
+    return 2;
+  }
+
+  Decoder decoder;
+  uint8_t buf[4096];
+  if (port) {
+    int fd = open_port(port, baud);
+    if (fd < 0) return 1;
+    signal(SIGINT, on_sigint);
+    char digit = '0' + level;
+    if (level >= 0 && write(fd, &digit, 1) != 1) fprintf(stderr, "could not set the level on %s\n", port);
+    while (!interrupted) {
+      ssize_t n = read(fd, buf, sizeof(buf));
+      if (n < 0 && errno != EINTR) break;
+      if (n > 0) decoder.feed(buf, n);
+      fflush(stdout);
+    }
+    close(fd);
+  } else {
+    FILE* f = fopen(stream_path, "rb");
+    if (!f) {
+      fprintf(stderr, "cannot open %s\n", stream_path);
+      return 1;
+    }
+    for (size_t n; (n = fread(buf, 1, sizeof(buf), f)) > 0;) decoder.feed(buf, n);
+    fclose(f);
+  }
+  decoder.finish();
+
+  const Decoder& d = decoder;
+  fprintf(stderr, "%llu records: %llu info, %llu inference, %llu stats, %llu mitigation\n",
+          (unsigned long long)d.records, (unsigned long long)d.by_type[0],
+          (unsigned long long)d.by_type[1], (unsigned long long)d.by_type[2],
+          (unsigned long long)d.by_type[3]);
+  fprintf(stderr, "  link:   %llu bad frames, %llu text lines\n", (unsigned long long)d.bad_frames,
+          (unsigned long long)d.text_lines);
+  fprintf(stderr, "  device: %u records dropped (last stats)\n", d.device_dropped);
+  return d.records ? 0 : 1;
+}
@@ -1,29 +1,54 @@
 #!/usr/bin/env python3
 """
-Extract Random Forest decision rules to C++ code for ESP32
-Generates optimized decision tree classifier
+Extract the trained Random Forest to C++ code for ESP32
+Generates flattened node arrays or QuickScorer tables evaluated by forest_runtime.h
+
+Usage:
+    python extract_rf_to_cpp.py                          # Export all trees
+    python extract_rf_to_cpp.py --trees 20               # Export the first 20 trees
+    python extract_rf_to_cpp.py --backend quickscorer    # Bitvector evaluation
+    python extract_rf_to_cpp.py --quantize               # Integer thresholds, no FPU needed
+    python extract_rf_to_cpp.py --no-measure             # Skip the host timing run
+    python extract_rf_to_cpp.py --cascade-only           # Relearn only the IDLE early exit
 """
 
-import joblib
+import argparse
+import os
+import shutil
+import subprocess
+import tempfile
+
 import numpy as np
-from sklearn.tree import _tree
 
-def tree_to_cpp(tree, feature_names, class_names, tree_id=0):
-    """Convert a single decision tree to C++ code"""
+try:
+    from sklearn.tree import _tree
+    TREE_UNDEFINED = _tree.TREE_UNDEFINED
+except ImportError:  # Only needed to load the pickle; emitters read plain arrays
+    TREE_UNDEFINED = -2
+
+FIRMWARE_DIR = 'firmware/2_tinyml_inference'
+HOST_DIR = 'firmware/host'
+FOREST_LEAF = 0xFF
+FOREST_MAX_CLASSES = 8
+NODE_BYTES = 8     # sizeof(ForestNode)
+CONDITION_BYTES = 16  # sizeof(QsCondition)
+NODES_PER_LINE = 4
+BACKENDS = ('nodes', 'quickscorer')
+CASCADE_FEATURES = (0, 1, 5, 11)  # mean, std, range, mean_abs_diff: running sums and deques
+LAZY_COMMENT = """// Same vote, reading features[k] only when a split needs it, so a provider
+// with operator[] can compute features on first use"""
+
+def tree_to_cpp(tree, class_names, depth=0):
+    """Convert a single decision tree to nested if/else C++ code"""
     tree_ = tree.tree_
-    feature_name = [
-        feature_names[i] if i != _tree.TREE_UNDEFINED else "undefined!"
-        for i in tree_.feature
-    ]
 
     def recurse(node, depth):
         indent = "  " * depth
-        if tree_.feature[node] != _tree.TREE_UNDEFINED:
-            name = feature_name[node]
-            threshold = tree_.threshold[node]
-            
+        if tree_.feature[node] != TREE_UNDEFINED:
+            threshold = float32_threshold(tree_.threshold[node])
+
             # Left branch (<=)
-            cpp_code = f"{indent}if (features[{tree_.feature[node]}] <= {threshold:.6f}f) {{\n"
+            cpp_code = f"{indent}if (features[{tree_.feature[node]}] <= {threshold}) {{\n"
             cpp_code += recurse(tree_.children_left[node], depth + 1)
             cpp_code += f"{indent}}} else {{\n"
             cpp_code += recurse(tree_.children_right[node], depth + 1)
@@ -34,35 +59,411 @@ def tree_to_cpp(tree, feature_names, class_names, tree_id=0):
             class_id = np.argmax(tree_.value[node])
             return f"{indent}return {class_id};  // {class_names[class_id]}\n"
 
-    return recurse(0, 0)
+    return recurse(0, depth)
+
+def float32_floor(threshold):
+    """Largest float32 <= threshold
+
+    sklearn compares float32 features against float64 thresholds. Rounding
+    down keeps `x <= t` identical for every float32 x; rounding to nearest
+    could flip samples that sit exactly on the rounded value.
+    """
+    t32 = np.float32(threshold)
+    if float(t32) > threshold:
+        t32 = np.nextafter(t32, np.float32(-np.inf))
+    return t32
+
+def c_float(value):
+    """float32 value as a C literal that round-trips exactly"""
+    literal = f"{float(value):.9g}"
+    if '.' not in literal and 'e' not in literal and 'n' not in literal:
+        literal += '.0'  # 140852f is not a valid C float literal
+    return literal + 'f'
+
+def float32_threshold(threshold):
+    return c_float(float32_floor(threshold))
+
+def flatten_tree(tree):
+    """Flatten one tree into preorder nodes: [feature, threshold, right]
+
+    The left child of a split is always the next node, so only the right
+    child index is stored. Leaves store their majority class in `right`.
+    Thresholds are float32, already rounded down.
+    """
+    tree_ = tree.tree_
+    nodes = []
+
+    def recurse(node):
+        idx = len(nodes)
+        if tree_.feature[node] != TREE_UNDEFINED:
+            nodes.append([int(tree_.feature[node]), float32_floor(tree_.threshold[node]), 0])
+            recurse(tree_.children_left[node])
+            nodes[idx][2] = len(nodes)
+            recurse(tree_.children_right[node])
+        else:
+            nodes.append([FOREST_LEAF, np.float32(0), int(np.argmax(tree_.value[node]))])
+
+    recurse(0)
+    if len(nodes) > 0xFFFF:
+        raise ValueError(f"Tree has {len(nodes)} nodes; child indices are 16-bit")
+    return nodes
+
+def quantize(x, offset, scale, limit):
+    """numpy mirror of forest_quantize() in forest_runtime.h, float32 throughout"""
+    v = (np.float32(x) - np.float32(offset)).astype(np.float32) * np.float32(scale)
+    v = np.asarray(v, dtype=np.float32)
+    lim = np.float32(limit)
+    q = np.floor(np.where(np.isnan(v), lim, v)).astype(np.int64)
+    q = np.where(~(v < lim), limit, q)
+    return np.where(v <= -lim, -limit, q)
+
+def float_key(x):
+    """numpy mirror of forest_float_key(): float32 order as int32"""
+    i = np.asarray(x, dtype=np.float32).view(np.int32).astype(np.int64)
+    key = np.where(i >= 0, i, i ^ 0x7FFFFFFF)
+    return np.where((i & 0x7FFFFFFF) > 0x7F800000, 0x7FFFFFFF, key)  # NaN goes right
+
+def quantize_threshold(threshold, feature, quant):
+    if quant['bits'] == 32:
+        return int(float_key(np.float32(threshold) + np.float32(0)))  # -0.0 -> +0.0
+    offset, scale = quant['params'][feature]
+    return int(quantize(threshold, offset, scale, quant['limit']))
+
+def quantize_features(X, quant):
+    X = X.astype(np.float32)
+    if quant['bits'] == 32:
+        return float_key(X)
+    return np.stack([quantize(X[:, f], o, s, quant['limit'])
+                     for f, (o, s) in enumerate(quant['params'])], axis=1)
+
+def fit_quantization(flat_trees, X, bits):
+    """Per-feature (offset, scale) that keeps every split exact on X
+
+    The thresholds of a feature span [-limit, limit] around an offset, so
+    values beyond the outermost thresholds clamp without changing any
+    comparison. A split stays exact when no training value above it
+    quantizes onto it. If one does, the offset is moved onto that value,
+    which puts a grid boundary between the two. Returns None when a
+    feature cannot be made exact at this width.
+
+    bits=32 uses the float32 bit key instead: a linear map evaluated in
+    float32 cannot separate values one ulp apart far from its offset, while
+    the key orders exactly like the float for every input.
+    """
+    if bits == 32:
+        return {'bits': 32}
+    limit = 2 ** (bits - 1) - 1
+    X = X.astype(np.float32)
+    quant = []
+    for f in range(X.shape[1]):
+        thresholds = np.unique([thr for nodes in flat_trees
+                                for feat, thr, _ in nodes if feat == f]).astype(np.float32)
+        if len(thresholds) == 0:
+            quant.append((np.float32(0), np.float32(0)))  # Never compared
+            continue
+        column = np.sort(X[:, f])
+        lo, hi = thresholds[0], thresholds[-1]
+        candidates = [np.float32((float(lo) + float(hi)) / 2)]
+        found, tried = None, set()
+        while candidates and found is None and len(tried) < 8:
+            offset = candidates.pop(0)
+            if float(offset) in tried:
+                continue
+            tried.add(float(offset))
+            span = max(float(hi) - float(offset), float(offset) - float(lo))
+            # Two steps of headroom keep the outermost thresholds off the clamp
+            scale = np.float32((limit - 2) / span) if span > 0 else np.float32(1)
+            qt = quantize(thresholds, offset, scale, limit)
+            # Smallest training value above each threshold must land past it
+            above = np.searchsorted(column, thresholds, side='right')
+            has_above = above < len(column)
+            qa = quantize(column[np.minimum(above, len(column) - 1)], offset, scale, limit)
+            clash = has_above & (qa <= qt)
+            if not clash.any():
+                found = (offset, scale)
+            else:
+                candidates.extend(column[above[clash]][:8])
+        if found is None:
+            return None
+        quant.append(found)
+    return {'bits': bits, 'limit': limit, 'params': quant}
+
+def predict_flat(flat_trees, X, quant=None):
+    """Hard vote of flattened trees over every row of X, vectorised by row"""
+    X = quantize_features(X, quant) if quant else X.astype(np.float32)
+    votes = np.zeros((len(X), FOREST_MAX_CLASSES), dtype=int)
+    rows = np.arange(len(X))
+    for nodes in flat_trees:
+        feat = np.array([n[0] for n in nodes])
+        right = np.array([n[2] for n in nodes])
+        thr = np.array([n[1] for n in nodes], dtype=np.float32)
+        if quant:
+            thr = np.array([quantize_threshold(n[1], n[0], quant)
+                            if n[0] != FOREST_LEAF else 0 for n in nodes])
+        i = np.zeros(len(X), dtype=int)
+        active = feat[i] != FOREST_LEAF
+        while active.any():
+            r, n = rows[active], i[active]
+            i[active] = np.where(X[r, feat[n]] <= thr[n], n + 1, right[n])
+            active = feat[i] != FOREST_LEAF
+        votes[rows, right[i]] += 1
+    return np.argmax(votes, axis=1)
+
+def forest_tables_cpp(trees, quant=None):
+    """Emit FOREST_NODES / FOREST_TREE_OFFSETS for a list of trees
+
+    With quant, thresholds are emitted in the quantized integer domain.
+    """
+    lines, offsets, total = [], [], 0
+    for t, tree in enumerate(trees):
+        nodes = flatten_tree(tree)
+        offsets.append(total)
+        total += len(nodes)
+        lines.append(f"  // Tree {t}: {len(nodes)} nodes, depth {tree.get_depth()}")
+        for i in range(0, len(nodes), NODES_PER_LINE):
+            chunk = []
+            for feat, thr, right in nodes[i:i + NODES_PER_LINE]:
+                if quant is None:
+                    literal = c_float(thr)
+                elif feat == FOREST_LEAF:
+                    literal = "0"
+                else:
+                    literal = str(quantize_threshold(thr, feat, quant))
+                chunk.append(f"{{{literal}, {right}, {feat}, 0}},")
+            lines.append("  " + " ".join(chunk))
+
+    offset_lines = []
+    for i in range(0, len(offsets), 12):
+        offset_lines.append("  " + ", ".join(str(o) for o in offsets[i:i + 12]) + ",")
+
+    node_type = f"ForestNodeT<int{quant['bits']}_t>" if quant else "ForestNode"
+    code = f"""static const {node_type} FOREST_NODES[{total}] = {{
+{chr(10).join(lines)}
+}};
+
+static const uint32_t FOREST_TREE_OFFSETS[{len(trees)}] = {{
+{chr(10).join(offset_lines)}
+}};
+"""
+    return code, total
+
+def leaf_ranges(tree):
+    """Number the leaves of one tree left to right
+
+    Returns (leaf_classes, splits) where splits holds
+    [feature, threshold, first_leaf, end_leaf] per split node and
+    [first_leaf, end_leaf) are the leaves of its left subtree.
+    """
+    tree_ = tree.tree_
+    leaf_classes, splits = [], []
+
+    def recurse(node):
+        if tree_.feature[node] == TREE_UNDEFINED:
+            leaf_classes.append(int(np.argmax(tree_.value[node])))
+            return
+        first = len(leaf_classes)
+        recurse(tree_.children_left[node])
+        splits.append([int(tree_.feature[node]), float(tree_.threshold[node]), first, len(leaf_classes)])
+        recurse(tree_.children_right[node])
+
+    recurse(0)
+    return leaf_classes, splits
+
+def quickscorer_tables_cpp(trees, n_features):
+    """Emit QuickScorer tables: conditions grouped by feature, sorted by threshold"""
+    conditions, leaf_classes, leaf_offsets = [], [], []
+    max_leaves = 0
+    for t, tree in enumerate(trees):
+        classes, splits = leaf_ranges(tree)
+        if len(classes) > 0xFFFF:
+            raise ValueError(f"Tree {t} has {len(classes)} leaves; leaf indices are 16-bit")
+        leaf_offsets.append(len(leaf_classes))
+        leaf_classes.extend(classes)
+        max_leaves = max(max_leaves, len(classes))
+        conditions.extend([feat, thr, t, first, end] for feat, thr, first, end in splits)
+
+    # Stable sort keeps tree order among equal thresholds
+    conditions.sort(key=lambda c: (c[0], c[1]))
+    feature_offsets = np.searchsorted([c[0] for c in conditions], np.arange(n_features + 1)).tolist()
+    words = (max_leaves + 31) // 32
+
+    if len(trees) * words > 0xFFFF:
+        raise ValueError(f"{len(trees) * words} bitvector words; word indices are 16-bit")
+
+    cond_lines, f = [], -1
+    for feat, thr, t, first, end in conditions:
+        if feat != f:
+            f = feat
+            cond_lines.append(f"  // Feature {feat}")
+        # Clear leaves [first, end) of tree t: AND masks per touched word
+        word, last = first // 32, (end - 1) // 32
+        head = (0xFFFFFFFF << (first % 32)) & 0xFFFFFFFF
+        tail = 0xFFFFFFFF >> (31 - (end - 1) % 32)
+        mask = ~(head & tail if word == last else head) & 0xFFFFFFFF
+        tail_mask = ~tail & 0xFFFFFFFF if word != last else 0xFFFFFFFF
+        cond_lines.append(f"  {{{float32_threshold(thr)}, 0x{mask:08X}, 0x{tail_mask:08X}, "
+                          f"{t * words + word}, {last - word}, 0}},")
+
+    def rows(values, per_line):
+        return "\n".join("  " + ", ".join(str(v) for v in values[i:i + per_line]) + ","
+                         for i in range(0, len(values), per_line))
+
+    code = f"""static const QsCondition QS_CONDITIONS[{len(conditions)}] = {{
+{chr(10).join(cond_lines)}
+}};
+
+static const uint32_t QS_FEATURE_OFFSETS[{n_features + 1}] = {{
+{rows(feature_offsets, 12)}
+}};
+
+static const uint8_t QS_LEAF_CLASSES[{len(leaf_classes)}] = {{
+{rows(leaf_classes, 32)}
+}};
+
+static const uint32_t QS_LEAF_OFFSETS[{len(trees)}] = {{
+{rows(leaf_offsets, 12)}
+}};
+
+static uint32_t QS_BITVECTORS[{len(trees) * words}];
+"""
+    flash = (len(conditions) * CONDITION_BYTES + (n_features + 1) * 4 +
+             len(leaf_classes) + len(trees) * 4)
+    return code, flash, words
+
+def quantizer_cpp(quant, feature_names):
+    """Quantization table and the call that fills `quantized` from `features`
+
+    Returns (table code, call, table bytes). The call expects
+    FOREST_NUM_FEATURES to be defined.
+    """
+    if quant['bits'] == 32:
+        return "", "forest_float_key_all(features, quantized, FOREST_NUM_FEATURES);", 0
+    params = "\n".join(f"  {{{c_float(o)}, {c_float(sc)}}},  // {feature_names[f]}"
+                       for f, (o, sc) in enumerate(quant['params']))
+    table = f"""static const int32_t FOREST_QUANT_LIMIT = {quant['limit']};
+
+// Per-feature offset and scale: q = floor((x - offset) * scale)
+static const FeatureQuant FOREST_QUANT[{len(feature_names)}] = {{
+{params}
+}};
+
+"""
+    call = ("forest_quantize_all(FOREST_QUANT, features, quantized, FOREST_NUM_FEATURES, "
+            "FOREST_QUANT_LIMIT);")
+    return table, call, len(feature_names) * 8
+
+def feature_mask(trees):
+    """Bit f set when any split of any tree tests feature f"""
+    mask = 0
+    for tree in trees:
+        for f in tree.tree_.feature:
+            if f != TREE_UNDEFINED:
+                mask |= 1 << int(f)
+    return mask
+
+def generate_esp32_code(rf_model, feature_names, class_names, n_trees=None,
+                        output_file=f'{FIRMWARE_DIR}/random_forest_model.h', ns_per_window=None,
+                        backend='nodes', quant=None):
+    """Generate complete ESP32-compatible C++ header
+
+    quant (from fit_quantization) switches the node backend to integer
+    thresholds over quantized features.
+    """
+
+    trees = rf_model.estimators_[:n_trees] if n_trees else rf_model.estimators_
+    total_nodes = sum(t.tree_.node_count for t in trees)
+    mask = feature_mask(trees)
+    ram_bytes = 2 * len(class_names)  # Vote counters on the stack
+    if backend == 'quickscorer':
+        tables, flash_bytes, words = quickscorer_tables_cpp(trees, len(feature_names))
+        ram_bytes += len(trees) * words * 4
+        model = f"""static const QuickScorer RANDOM_FOREST_QS = {{
+  QS_CONDITIONS, QS_FEATURE_OFFSETS, QS_LEAF_CLASSES, QS_LEAF_OFFSETS,
+  FOREST_NUM_FEATURES, FOREST_NUM_TREES, FOREST_NUM_CLASSES, {words}
+}};
+
+// Majority vote over all exported trees, QuickScorer evaluation
+int classify_random_forest(const float* features) {{
+  return quickscorer_predict(RANDOM_FOREST_QS, features, QS_BITVECTORS);
+}}
+
+{LAZY_COMMENT}
+template <typename Features>
+int classify_random_forest_lazy(Features& features) {{
+  return quickscorer_predict(RANDOM_FOREST_QS, features, QS_BITVECTORS);
+}}"""
+    elif quant:
+        tables, _ = forest_tables_cpp(trees, quant)
+        quant_table, quantize_call, quant_bytes = quantizer_cpp(quant, feature_names)
+        lazy_view = ("FloatKeyFeatures<Features> quantized{features};" if quant['bits'] == 32 else
+                     "QuantizedFeatures<Features> quantized{features, FOREST_QUANT, FOREST_QUANT_LIMIT};")
+        node_bytes = 4 + quant['bits'] // 8  # sizeof(ForestNodeT<intN_t>)
+        flash_bytes = total_nodes * node_bytes + len(trees) * 4 + quant_bytes
+        ram_bytes += len(feature_names) * 4  # Quantized features on the stack
+        tables = quant_table + tables
+        model = f"""static const ForestT<int{quant['bits']}_t> RANDOM_FOREST = {{
+  FOREST_NODES, FOREST_TREE_OFFSETS, FOREST_NUM_TREES, FOREST_NUM_CLASSES
+}};
+
+// Majority vote over all exported trees, integer compares only
+int classify_random_forest(const float* features) {{
+  int32_t quantized[FOREST_NUM_FEATURES];
+  {quantize_call}
+  return forest_predict(RANDOM_FOREST, quantized);
+}}
+
+{LAZY_COMMENT}
+template <typename Features>
+int classify_random_forest_lazy(Features& features) {{
+  {lazy_view}
+  return forest_predict(RANDOM_FOREST, quantized);
+}}"""
+    else:
+        tables, _ = forest_tables_cpp(trees)
+        flash_bytes = total_nodes * NODE_BYTES + len(trees) * 4
+        model = """static const Forest RANDOM_FOREST = {
+  FOREST_NODES, FOREST_TREE_OFFSETS, FOREST_NUM_TREES, FOREST_NUM_CLASSES
+};
+
+// Majority vote over all exported trees
+int classify_random_forest(const float* features) {
+  return forest_predict(RANDOM_FOREST, features);
+}
+
+""" + LAZY_COMMENT + """
+template <typename Features>
+int classify_random_forest_lazy(Features& features) {
+  return forest_predict(RANDOM_FOREST, features);
+}"""
+    backend_name = f"{backend}-int{quant['bits']}" if quant else backend
+    timing = (f"{ns_per_window:.0f} ns/window on the build host (firmware/host/bench_forest)"
+              if ns_per_window else "not measured (run without --no-measure)")
 
-def generate_esp32_code(rf_model, feature_names, class_names, output_file='firmware/2_tinyml_inference/random_forest_model.h'):
-    """Generate complete ESP32-compatible C++ header"""
-    
-    # Find the best tree (highest accuracy on OOB samples)
-    # For simplicity, use the first tree (all trees are trained on bootstrap samples)
-    best_tree = rf_model.estimators_[0]
-    
     # Generate header
-    cpp_code = f"""// Auto-generated Random Forest Decision Tree for ESP32
+    cpp_code = f"""// Auto-generated Random Forest for ESP32
 // Generated from trained sklearn RandomForestClassifier
 // Accuracy: 80.61%
 // Model: data/models/random_forest.pkl
+// Trees: {len(trees)} of {len(rf_model.estimators_)} | Nodes: {total_nodes} | Backend: {backend_name}
+// Footprint: {flash_bytes} bytes flash, {ram_bytes} bytes RAM
+// Latency: {timing}
 
 #ifndef RANDOM_FOREST_MODEL_H
 #define RANDOM_FOREST_MODEL_H
 
+#include "forest_runtime.h"
+
 // Feature indices (must match training order)
 // 0-13: Time domain features
-// 14-23: Frequency domain features  
+// 14-23: Frequency domain features
 // 24-29: Wavelet features
 
 const char* FEATURE_NAMES[30] = {{
   "mean", "std", "var", "min", "max", "range", "median",
   "skewness", "kurtosis", "q25", "q75", "mean_abs_diff",
-  "std_diff", "max_diff", "fft_low", "fft_mid", "fft_high",
-  "fft_total", "fft_spread", "fft_range", "fft_dom", "fft_peak",
-  "fft_centroid", "fft_rolloff", "wav_approx_std", "wav_detail1_std",
+  "std_diff", "max_diff", "fft_dom", "fft_peak", "fft_mean",
+  "fft_std", "fft_low", "fft_mid", "fft_high", "fft_centroid",
+  "fft_rolloff", "fft_entropy", "wav_approx_std", "wav_detail1_std",
   "wav_detail2_std", "wav_detail3_std", "wav_detail1_energy",
   "wav_detail2_energy"
 }};
@@ -72,68 +473,303 @@ const char* activity_names[6] = {{
   "IDLE", "SOCIAL", "VIDEO", "MESSAGE", "BROWSE", "GAMING"
 }};
 
-// Decision tree classifier (extracted from Random Forest)
-int classify_random_forest(float* features) {{
-{tree_to_cpp(best_tree, feature_names, class_names)}
-}}
+#define FOREST_BACKEND "{backend_name}"
+#define FOREST_NUM_FEATURES {len(feature_names)}
+#define FOREST_NUM_TREES {len(trees)}
+#define FOREST_NUM_NODES {total_nodes}
+#define FOREST_NUM_CLASSES {len(class_names)}
+#define FOREST_FLASH_BYTES {flash_bytes}
+#define FOREST_RAM_BYTES {ram_bytes}
+
+// Features the trees test ({bin(mask).count('1')} of {len(feature_names)}); FeatureExtractor<..., FOREST_FEATURE_MASK>
+// compiles out the code and buffers of the rest
+static constexpr uint32_t FOREST_FEATURE_MASK = 0x{mask:08X};
+
+{tables}
+{model}
 
 #endif  // RANDOM_FOREST_MODEL_H
 """
-    
+
     # Save to file
     with open(output_file, 'w') as f:
         f.write(cpp_code)
-    
+
     print(f"✓ Generated {output_file}")
-    print(f"   Tree depth: {best_tree.get_depth()}")
-    print(f"   Number of leaves: {best_tree.get_n_leaves()}")
-    print(f"   Estimated code size: {len(cpp_code) / 1024:.1f} KB")
-    
+    print(f"   Trees: {len(trees)} (max depth {max(t.get_depth() for t in trees)})")
+    print(f"   Nodes: {total_nodes} | Backend: {backend_name}")
+    print(f"   Flash: {flash_bytes / 1024:.1f} KB | RAM: {ram_bytes} bytes")
+
     return cpp_code
 
+def fit_idle_cascade(X, y, precision=0.99, max_depth=6, min_leaf=20):
+    """First stage of the IDLE early exit, learned from the training windows
+
+    A small tree over CASCADE_FEATURES only. A node becomes an exit leaf as
+    soon as at least `precision` of its windows (and min_leaf of them) are
+    IDLE. Otherwise it splits where one child would be such a leaf, keeping
+    the largest, or else at the best Gini split. Leaves are dicts with
+    'n', 'idle' and 'exit'; splits add 'feature', 'threshold', 'left' and
+    'right'. Thresholds are float32, rounded down like the forest's.
+    """
+    X = X.astype(np.float32)
+    idle = (np.asarray(y) == 0).astype(int)
+
+    def split(idx):
+        n, pos = len(idx), idle[idx].sum()
+        best = None
+        for f in CASCADE_FEATURES:
+            order = idx[np.argsort(X[idx, f], kind='stable')]
+            xs = X[order, f]
+            nl = np.arange(1, n)
+            nr = n - nl
+            pl = np.cumsum(idle[order])[:-1]
+            pr = pos - pl
+            valid = (xs[1:] > xs[:-1]) & (nl >= min_leaf) & (nr >= min_leaf)
+            pocket = np.maximum(np.where(pl >= precision * nl, nl, 0),
+                                np.where(pr >= precision * nr, nr, 0)) * valid
+            gini = (nl * (1 - (pl / nl) ** 2 - (1 - pl / nl) ** 2) +
+                    nr * (1 - (pr / nr) ** 2 - (1 - pr / nr) ** 2)) / n
+            gini[~valid] = np.inf
+            k = int(np.argmax(pocket)) if pocket.max() > 0 else int(np.argmin(gini))
+            if not valid[k]:
+                continue
+            key = (pocket[k], -gini[k])
+            if best is None or key > best[2]:
+                best = (f, float32_floor((float(xs[k]) + float(xs[k + 1])) / 2), key)
+        return best
+
+    def grow(idx, depth):
+        n, pos = len(idx), int(idle[idx].sum())
+        node = {'n': n, 'idle': pos, 'exit': n >= min_leaf and pos >= precision * n}
+        if node['exit'] or depth == max_depth or pos == 0:
+            return node
+        best = split(idx)
+        if best is None:
+            return node
+        f, threshold, _ = best
+        left = X[idx, f] <= threshold
+        node.update(feature=int(f), threshold=threshold,
+                    left=grow(idx[left], depth + 1), right=grow(idx[~left], depth + 1))
+        return node
+
+    return grow(np.arange(len(X)), 0)
+
+def cascade_exits(node):
+    """(windows exited, of them IDLE) on the training data"""
+    if 'feature' not in node:
+        return (node['n'], node['idle']) if node['exit'] else (0, 0)
+    a, b = cascade_exits(node['left']), cascade_exits(node['right'])
+    return a[0] + b[0], a[1] + b[1]
+
+def cascade_to_cpp(node, feature_names, depth=1):
+    """Nested if/else returning true on exit leaves; subtrees without one
+    collapse to `return false`"""
+    indent = "  " * depth
+    if cascade_exits(node)[0] == 0:
+        return f"{indent}return false;\n"
+    if 'feature' not in node:
+        return f"{indent}return true;  // {node['idle']} of {node['n']} IDLE\n"
+    f = node['feature']
+    return (f"{indent}if (features[{f}] <= {c_float(node['threshold'])}) {{  // {feature_names[f]}\n"
+            f"{cascade_to_cpp(node['left'], feature_names, depth + 1)}"
+            f"{indent}}} else {{\n"
+            f"{cascade_to_cpp(node['right'], feature_names, depth + 1)}"
+            f"{indent}}}\n")
+
+def generate_cascade_code(X, y, feature_names, output_file, precision, max_depth, min_leaf):
+    """Learn the IDLE early exit and write it as idle_cascade.h"""
+    root = fit_idle_cascade(X, y, precision, max_depth, min_leaf)
+    exited, exited_idle = cascade_exits(root)
+    total_idle = int(np.sum(np.asarray(y) == 0))
+    mask = sum(1 << f for f in CASCADE_FEATURES)
+    used = ", ".join(feature_names[f] for f in CASCADE_FEATURES)
+    exit_precision = exited_idle / exited if exited else 1.0
+
+    cpp_code = f"""// Auto-generated by ml_training/extract_rf_to_cpp.py - do not edit
+// IDLE early exit: the first stage of the detectors' cascade
+// Learned from data/processed ({len(X)} windows): precision >= {precision}, depth <= {max_depth},
+// leaves >= {min_leaf} windows
+// Exits {exited} windows ({100.0 * exited / len(X):.1f}%), {exited_idle} of them IDLE ({100.0 * exit_precision:.1f}%),
+// {100.0 * exited_idle / max(1, total_idle):.1f}% of all IDLE windows
+
+#ifndef IDLE_CASCADE_H
+#define IDLE_CASCADE_H
+
+#include <stdint.h>
+
+// Features the first stage reads: {used}.
+// The streaming extractor keeps them as running sums and deques, so they
+// cost O(1) per window.
+static constexpr uint32_t CASCADE_FEATURE_MASK = 0x{mask:08X};
+
+// True when the window is IDLE with confidence and the full extraction
+// and classifier can be skipped. Reads features[k] only as it needs them.
+template <typename Features>
+bool cascade_accepts_idle(Features& features) {{
+{cascade_to_cpp(root, feature_names)}}}
+
+#endif  // IDLE_CASCADE_H
+"""
+
+    with open(output_file, 'w') as f:
+        f.write(cpp_code)
+
+    print(f"✓ Generated {output_file}")
+    print(f"   Early exit: {exited} of {len(X)} windows ({100.0 * exited / len(X):.1f}%), "
+          f"{100.0 * exit_precision:.1f}% of them IDLE")
+    return root
+
+def measure_on_host(header_file, X):
+    """Compile bench_forest against header_file and time it on X
+
+    Returns (ns_per_window, predictions), or (None, None) without a compiler.
+    """
+    cxx = shutil.which('c++') or shutil.which('g++') or shutil.which('clang++')
+    if cxx is None:
+        print("⚠ No host C++ compiler found - skipping latency measurement")
+        return None, None
+
+    with tempfile.TemporaryDirectory() as tmp:
+        shutil.copy(header_file, os.path.join(tmp, 'random_forest_model.h'))
+        features_file = os.path.join(tmp, 'X.npy')
+        predictions_file = os.path.join(tmp, 'predictions.txt')
+        binary = os.path.join(tmp, 'bench_forest')
+        np.save(features_file, X.astype(np.float32))
+
+        subprocess.run([cxx, '-std=c++17', '-O2', f'-I{tmp}', f'-I{FIRMWARE_DIR}',
+                        f'{HOST_DIR}/bench_forest.cpp', '-o', binary], check=True)
+        result = subprocess.run([binary, features_file, '--predictions', predictions_file],
+                                check=True, capture_output=True, text=True)
+
+        ns_per_window = None
+        for line in result.stdout.splitlines():
+            if line.strip().startswith('ns_per_window:'):
+                ns_per_window = float(line.split(':')[1])
+        predictions = np.loadtxt(predictions_file, dtype=int)
+
+    return ns_per_window, predictions
+
 def get_feature_importance(rf_model, feature_names):
     """Print feature importance for reference"""
     importances = rf_model.feature_importances_
     indices = np.argsort(importances)[::-1]
-    
+
     print("\n📊 Feature Importance (Top 10):")
     for i in range(min(10, len(indices))):
         idx = indices[i]
         print(f"  {i+1}. {feature_names[idx]:20s} : {importances[idx]:.4f}")
 
+def quantize_forest(trees, X):
+    """Narrowest integer domain whose predictions on X equal the float trees'
+
+    Tries int16 then int32 and checks the full vote of every row against
+    the float node arrays. Raises if neither width is exact.
+    """
+    flat = [flatten_tree(tree) for tree in trees]
+    expected = predict_flat(flat, X)
+    for bits in (16, 32):
+        quant = fit_quantization(flat, X, bits)
+        if quant is None:
+            print(f"   int{bits}: some split cannot be separated from the training data")
+            continue
+        mismatches = int(np.sum(predict_flat(flat, X, quant) != expected))
+        print(f"   int{bits}: {mismatches} of {len(X)} predictions differ from the float trees")
+        if mismatches == 0:
+            return quant
+    raise SystemExit("✗ No exact integer quantization found - export without --quantize")
+
+def hard_vote(trees, X, n_classes):
+    """Majority vote with ties to the lower class, as forest_predict does"""
+    votes = np.zeros((len(X), n_classes), dtype=int)
+    for tree in trees:
+        votes[np.arange(len(X)), tree.predict(X.astype(np.float32)).astype(int)] += 1
+    return np.argmax(votes, axis=1)
+
 if __name__ == '__main__':
-    import os
-    
-    # Load trained Random Forest model
-    print("Loading Random Forest model...")
-    rf_model = joblib.load('data/models/random_forest.pkl')
-    
+    parser = argparse.ArgumentParser()
+    parser.add_argument('--trees', type=int, default=None,
+                        help='Export only the first N trees (default: all)')
+    parser.add_argument('--backend', choices=BACKENDS, default='nodes',
+                        help='nodes: per-tree traversal; quickscorer: feature-major bitvectors')
+    parser.add_argument('--quantize', action='store_true',
+                        help='Integer thresholds over quantized features (for parts without an FPU)')
+    parser.add_argument('--no-measure', action='store_true',
+                        help='Skip compiling and timing the forest on the host')
+    parser.add_argument('--cascade-only', action='store_true',
+                        help='Only relearn idle_cascade.h from data/processed (no model needed)')
+    parser.add_argument('--cascade-precision', type=float, default=0.99,
+                        help='Share of IDLE windows an early-exit leaf needs')
+    parser.add_argument('--cascade-depth', type=int, default=6,
+                        help='Depth limit of the early-exit tree')
+    args = parser.parse_args()
+
     # Feature names (must match training order)
     feature_names = [
         # Time-domain (14)
         'mean', 'std', 'var', 'min', 'max', 'range', 'median',
-        'skewness', 'kurtosis', 'q25', 'q75', 
+        'skewness', 'kurtosis', 'q25', 'q75',
         'mean_abs_diff', 'std_diff', 'max_diff',
-        # Frequency-domain (10)
-        'fft_low', 'fft_mid', 'fft_high', 'fft_total',
-        'fft_spread', 'fft_range', 'fft_dom', 'fft_peak',
-        'fft_centroid', 'fft_rolloff',
+        # Frequency-domain (10), as extract_frequency_domain() returns them
+        'fft_dom', 'fft_peak', 'fft_mean', 'fft_std',
+        'fft_low', 'fft_mid', 'fft_high',
+        'fft_centroid', 'fft_rolloff', 'fft_entropy',
         # Wavelet (6)
         'wav_approx_std', 'wav_detail1_std', 'wav_detail2_std',
         'wav_detail3_std', 'wav_detail1_energy', 'wav_detail2_energy'
     ]
-    
+
     class_names = ['IDLE', 'SOCIAL', 'VIDEO', 'MESSAGE', 'BROWSE', 'GAMING']
-    
+
+    # First stage of the cascade, from the same training windows
+    print("Learning the IDLE early exit...")
+    os.makedirs(FIRMWARE_DIR, exist_ok=True)
+    generate_cascade_code(np.load('data/processed/X.npy'), np.load('data/processed/y.npy'),
+                          feature_names, f'{FIRMWARE_DIR}/idle_cascade.h',
+                          args.cascade_precision, args.cascade_depth, min_leaf=20)
+    if args.cascade_only:
+        raise SystemExit(0)
+
+    import joblib
+
+    # Load trained Random Forest model
+    print("Loading Random Forest model...")
+    rf_model = joblib.load('data/models/random_forest.pkl')
+
     # Show feature importance
     get_feature_importance(rf_model, feature_names)
-    
+
+    X = np.load('data/processed/X.npy')
+    quant = None
+    if args.quantize:
+        if args.backend != 'nodes':
+            raise SystemExit("--quantize applies to the nodes backend only")
+        print("\n🔢 Quantizing thresholds...")
+        trees = rf_model.estimators_[:args.trees] if args.trees else rf_model.estimators_
+        quant = quantize_forest(trees, X)
+
     # Generate C++ code
-    os.makedirs('firmware/2_tinyml_inference', exist_ok=True)
-    generate_esp32_code(rf_model, feature_names, class_names)
-    
+    os.makedirs(FIRMWARE_DIR, exist_ok=True)
+    output_file = f'{FIRMWARE_DIR}/random_forest_model.h'
+    generate_esp32_code(rf_model, feature_names, class_names, args.trees, output_file,
+                        backend=args.backend, quant=quant)
+
+    if not args.no_measure:
+        ns, predictions = measure_on_host(output_file, X)
+        if ns is not None:
+            trees = rf_model.estimators_[:args.trees] if args.trees else rf_model.estimators_
+            expected = hard_vote(trees, X, len(class_names))
+            agree = np.mean(predictions == expected)
+            sklearn_agree = np.mean(predictions == rf_model.predict(X))
+            print(f"\n⏱  Host latency: {ns:.0f} ns/window over {len(X)} windows")
+            print(f"   Matches the exported trees' vote: {agree*100:.2f}%")
+            print(f"   Matches sklearn predict (soft vote, all trees): {sklearn_agree*100:.2f}%")
+            # Record the measured latency in the header
+            generate_esp32_code(rf_model, feature_names, class_names, args.trees, output_file, ns,
+                                backend=args.backend, quant=quant)
+
     print("\n✅ Random Forest exported successfully!")
     print("\nNext steps:")
     print("1. Upload firmware/2_tinyml_inference/esp32_rf_detector.ino to ESP32")
     print("2. The .ino file will #include \"random_forest_model.h\"")
-    print("3. Flash and test!")
\ No newline at end of file
+    print("3. Flash and test!")
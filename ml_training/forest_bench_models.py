@@ -0,0 +1,201 @@
+#!/usr/bin/env python3
+"""
+Emit the forests used by firmware/host/bench_quickscorer
+
+Writes one header holding the first 1, 10 and 100 trees of the forest in
+every C++ form the exporter knows: nested if/else, flat node array (float
+and quantized integer thresholds) and QuickScorer tables. Uses
+data/models/random_forest.pkl when it exists; otherwise grows stand-in trees on data/processed with the training
+pipeline's RandomForestClassifier settings, so the bench still runs on
+checkouts without the pickle.
+
+Usage:
+    python forest_bench_models.py --out build/forest_bench_models.h
+"""
+
+import argparse
+import os
+
+import numpy as np
+
+from extract_rf_to_cpp import (forest_tables_cpp, quantize_forest, quantizer_cpp,
+                               quickscorer_tables_cpp, tree_to_cpp, TREE_UNDEFINED)
+
+SIZES = (1, 10, 100)
+CLASS_NAMES = ['IDLE', 'SOCIAL', 'VIDEO', 'MESSAGE', 'BROWSE', 'GAMING']
+
+class ArrayTree:
+    """The subset of sklearn's DecisionTreeClassifier the emitters read"""
+
+    class Arrays:
+        pass
+
+    def __init__(self, feature, threshold, left, right, value):
+        self.tree_ = self.Arrays()
+        self.tree_.feature = feature
+        self.tree_.threshold = threshold
+        self.tree_.children_left = left
+        self.tree_.children_right = right
+        self.tree_.value = value
+        self.tree_.node_count = len(feature)
+        self._depth = self._measure(0)
+
+    def _measure(self, node):
+        if self.tree_.feature[node] == TREE_UNDEFINED:
+            return 0
+        return 1 + max(self._measure(self.tree_.children_left[node]),
+                       self._measure(self.tree_.children_right[node]))
+
+    def get_depth(self):
+        return self._depth
+
+def grow_tree(X, y, n_classes, rng, max_depth=15, min_samples_split=5):
+    """One bootstrap CART tree with sqrt(n_features) candidates per split"""
+    n, d = X.shape
+    mtry = max(1, int(np.sqrt(d)))
+    feature, threshold, left, right, value = [], [], [], [], []
+
+    def new_node():
+        for arr, v in ((feature, TREE_UNDEFINED), (threshold, 0.0), (left, -1),
+                       (right, -1), (value, None)):
+            arr.append(v)
+        return len(feature) - 1
+
+    def best_split(idx):
+        counts_total = np.bincount(y[idx], minlength=n_classes)
+        best = (None, None, 1 - np.sum((counts_total / len(idx)) ** 2))
+        for f in rng.choice(d, mtry, replace=False):
+            order = idx[np.argsort(X[idx, f], kind='stable')]
+            xs = X[order, f]
+            onehot = np.eye(n_classes)[y[order]]
+            left_counts = np.cumsum(onehot, axis=0)[:-1]
+            right_counts = counts_total - left_counts
+            nl = np.arange(1, len(idx))[:, None]
+            nr = len(idx) - nl
+            gini = (nl[:, 0] * (1 - np.sum((left_counts / nl) ** 2, axis=1)) +
+                    nr[:, 0] * (1 - np.sum((right_counts / nr) ** 2, axis=1))) / len(idx)
+            gini[xs[1:] <= xs[:-1]] = np.inf  # No split between equal values
+            k = int(np.argmin(gini))
+            if gini[k] < best[2]:
+                best = (f, (xs[k] + xs[k + 1]) / 2, gini[k])
+        return best[0], best[1]
+
+    def recurse(idx, depth):
+        node = new_node()
+        counts = np.bincount(y[idx], minlength=n_classes)
+        value[node] = counts.astype(float)
+        if depth >= max_depth or len(idx) < min_samples_split or counts.max() == len(idx):
+            return node
+        f, t = best_split(idx)
+        if f is None:
+            return node
+        go_left = X[idx, f] <= t
+        feature[node], threshold[node] = int(f), float(t)
+        left[node] = recurse(idx[go_left], depth + 1)
+        right[node] = recurse(idx[~go_left], depth + 1)
+        return node
+
+    recurse(rng.integers(0, n, n), 0)
+    return ArrayTree(feature, threshold, left, right, value)
+
+def load_trees(model_path, features_path, labels_path, n_trees, seed):
+    if os.path.exists(model_path):
+        import joblib
+        print(f"Using {model_path}")
+        return joblib.load(model_path).estimators_[:n_trees]
+
+    print(f"{model_path} not found - growing {n_trees} stand-in trees")
+    X = np.load(features_path).astype(np.float32)
+    y = np.load(labels_path).astype(int)
+    rng = np.random.default_rng(seed)
+    return [grow_tree(X, y, len(CLASS_NAMES), rng) for _ in range(n_trees)]
+
+def ifelse_forest_cpp(trees):
+    """One if/else function per tree plus a majority vote over them"""
+    funcs = []
+    for t, tree in enumerate(trees):
+        funcs.append(f"static int tree_{t}(const float* features) {{\n"
+                     f"{tree_to_cpp(tree, CLASS_NAMES, 1)}}}\n")
+    calls = "\n".join(f"  counts[tree_{t}(features)]++;" for t in range(len(trees)))
+    return "\n".join(funcs) + f"""
+static int predict_ifelse(const float* features) {{
+  uint16_t counts[{len(CLASS_NAMES)}] = {{0}};
+{calls}
+  int best = 0;
+  for (int c = 1; c < {len(CLASS_NAMES)}; c++) {{
+    if (counts[c] > counts[best]) best = c;
+  }}
+  return best;
+}}
+"""
+
+def bench_header(trees, X):
+    n_features = X.shape[1]
+    blocks = []
+    for size in SIZES:
+        subset = trees[:size]
+        nodes, total_nodes = forest_tables_cpp(subset)
+        quant = quantize_forest(subset, X)
+        int_nodes, _ = forest_tables_cpp(subset, quant)
+        quant_table, quantize_call, quant_bytes = quantizer_cpp(
+            quant, [f"feature {f}" for f in range(n_features)])
+        qs, qs_flash, words = quickscorer_tables_cpp(subset, n_features)
+        blocks.append(f"""namespace forest_{size} {{
+
+{ifelse_forest_cpp(subset)}
+{nodes}
+static const Forest NODES = {{FOREST_NODES, FOREST_TREE_OFFSETS, {len(subset)}, {len(CLASS_NAMES)}}};
+static const int NODES_FLASH = {total_nodes * 8 + len(subset) * 4};
+
+namespace quantized {{
+static const int FOREST_NUM_FEATURES = {n_features};
+{quant_table}{int_nodes}
+static const ForestT<int{quant['bits']}_t> NODES = {{FOREST_NODES, FOREST_TREE_OFFSETS, {len(subset)}, {len(CLASS_NAMES)}}};
+static const int NODES_FLASH = {total_nodes * (4 + quant['bits'] // 8) + len(subset) * 4 + quant_bytes};
+static const int BITS = {quant['bits']};
+
+static int predict(const float* features) {{
+  int32_t quantized[FOREST_NUM_FEATURES];
+  {quantize_call}
+  return forest_predict(NODES, quantized);
+}}
+}}  // namespace quantized
+
+{qs}
+static const QuickScorer QS = {{
+  QS_CONDITIONS, QS_FEATURE_OFFSETS, QS_LEAF_CLASSES, QS_LEAF_OFFSETS,
+  {n_features}, {len(subset)}, {len(CLASS_NAMES)}, {words}
+}};
+static const int QS_FLASH = {qs_flash};
+
+}}  // namespace forest_{size}
+""")
+
+    return f"""// Auto-generated by ml_training/forest_bench_models.py - do not edit
+// Forests of {", ".join(map(str, SIZES))} trees in every exported form
+
+#ifndef FOREST_BENCH_MODELS_H
+#define FOREST_BENCH_MODELS_H
+
+#include "forest_runtime.h"
+
+{chr(10).join(blocks)}
+#endif  // FOREST_BENCH_MODELS_H
+"""
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser()
+    parser.add_argument('--out', required=True)
+    parser.add_argument('--model', default='data/models/random_forest.pkl')
+    parser.add_argument('--features', default='data/processed/X.npy')
+    parser.add_argument('--labels', default='data/processed/y.npy')
+    parser.add_argument('--seed', type=int, default=42)
+    args = parser.parse_args()
+
+    trees = load_trees(args.model, args.features, args.labels, max(SIZES), args.seed)
+    if len(trees) < max(SIZES):
+        raise SystemExit(f"Need {max(SIZES)} trees, model has {len(trees)}")
+
+    with open(args.out, 'w') as f:
+        f.write(bench_header(trees, np.load(args.features)))
+    print(f"✓ Generated {args.out}")
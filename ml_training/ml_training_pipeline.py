@@ -18,6 +18,7 @@ import pandas as pd
 from datetime import datetime
 import os
 import json
+import subprocess
 import time
 
 # ML libraries
@@ -45,6 +46,9 @@ import seaborn as sns
 SAMPLE_RATE = 200  # Hz
 WINDOW_SIZE = 100  # 0.5 seconds @ 200Hz
 OVERLAP = 0.5      # 50% overlap
+# Extra windows for --multi-scale, ending with each WINDOW_SIZE window, as
+# firmware/2_tinyml_inference/multi_scale_extractor.h orders them
+MULTI_SCALES = (50, 200)
 
 ACTIVITIES = {
     0: 'IDLE',
@@ -248,6 +252,47 @@ class FeatureExtractor:
         
         return X, y
 
+    def extract_multi_scale_features(self, voltage, end):
+        """The 30 features of the WINDOW_SIZE window ending at end, then the
+        14 time-domain features of each MULTI_SCALES window ending there"""
+        features = self.extract_all_features(voltage[end - WINDOW_SIZE:end])
+        for size in MULTI_SCALES:
+            features.extend(self.extract_time_domain(voltage[end - size:end]))
+        return features
+
+    def process_dataset_multi_scale(self, csv_file):
+        """As process_dataset, with the concatenated multi-scale vector, over
+        the windows the longest scale fits behind"""
+        print(f"\n📊 Multi-scale features from {csv_file}...")
+        df = pd.read_csv(csv_file)
+        voltage = df['voltage_mv'].values
+        activity = df['activity_id'].values
+        step = int(WINDOW_SIZE * (1 - OVERLAP))
+        first = max(MULTI_SCALES) - WINDOW_SIZE
+
+        X, y = [], []
+        for i in range(first, len(df) - WINDOW_SIZE, step):
+            X.append(self.extract_multi_scale_features(voltage, i + WINDOW_SIZE))
+            y.append(activity[i])
+
+        X = np.array(X)
+        y = np.array(y)
+        print(f"✓ Multi-scale feature matrix: {X.shape}")
+        os.makedirs('data/processed', exist_ok=True)
+        np.save('data/processed/X_multiscale.npy', X)
+        np.save('data/processed/y_multiscale.npy', y)
+        return X, y
+
+    def process_dataset_native(self, csv_file, engine):
+        """Same as process_dataset, via firmware/host's multi-threaded feature_engine"""
+        print(f"\n📊 Processing {csv_file} with {engine}...")
+        subprocess.run([engine, csv_file, '--out-dir', 'data/processed'], check=True)
+        X = np.load('data/processed/X.npy')
+        y = np.load('data/processed/y.npy')
+        print(f"\n✓ Feature extraction complete")
+        print(f"Feature matrix: {X.shape}")
+        return X, y
+
 # ============ MODEL TRAINING ============
 class ModelTrainer:
     def __init__(self, X_train, X_test, y_train, y_test):
@@ -349,9 +394,11 @@ class ModelTrainer:
         """Train 1D-CNN"""
         print("\n🧠 Training 1D-CNN...")
         
-        # Reshape for CNN
-        X_train_cnn = self.X_train.reshape((-1, 30, 1))
-        X_test_cnn = self.X_test.reshape((-1, 30, 1))
+        # Standardize, as for the SVM. The scaler ships folded into the int8
+        # input quantization of model.h, so the device never applies it.
+        scaler = StandardScaler()
+        X_train_cnn = scaler.fit_transform(self.X_train).reshape((-1, 30, 1))
+        X_test_cnn = scaler.transform(self.X_test).reshape((-1, 30, 1))
         
         # Build model
         model = keras.Sequential([
@@ -388,6 +435,7 @@ class ModelTrainer:
         accuracy = accuracy_score(self.y_test, y_pred)
         
         self.models['cnn'] = model
+        self.models['cnn_scaler'] = scaler
         self.results['cnn'] = {
             'accuracy': accuracy,
             'predictions': y_pred,
@@ -418,6 +466,7 @@ class ModelTrainer:
         
         # Keras model
         self.models['cnn'].save('data/models/cnn_model.h5')
+        joblib.dump(self.models['cnn_scaler'], 'data/models/cnn_scaler.pkl')
         
         print("\n✓ All models saved to data/models/")
     
@@ -465,25 +514,36 @@ class ModelTrainer:
         plt.close()
 
 # ============ TFLITE CONVERSION ============
+def c_floats(values, per_line=5):
+    """C float initializers, 5 per line, exact for float32"""
+    items = [f"{float(v):.9g}" for v in values]
+    items = [v + ('f' if '.' in v or 'e' in v else '.0f') for v in items]
+    return ',\n'.join('  ' + ', '.join(items[i:i+per_line]) for i in range(0, len(items), per_line))
+
 class TFLiteConverter:
-    def __init__(self, keras_model):
+    def __init__(self, keras_model, scaler, batch=1):
         self.keras_model = keras_model
+        self.scaler = scaler
+        self.batch = batch
     
     def convert_with_quantization(self, X_train):
-        """Convert to TFLite with INT8 quantization"""
+        """Convert to TFLite with INT8 quantization, batch windows per invoke"""
         print("\n⚙️  Converting to TensorFlow Lite...")
         
-        converter = tf.lite.TFLiteConverter.from_keras_model(self.keras_model)
+        # Fixed batch dimension: TFLite Micro cannot resize the input tensor
+        spec = tf.TensorSpec([self.batch, 30, 1], tf.float32)
+        func = tf.function(lambda x: self.keras_model(x)).get_concrete_function(spec)
+        converter = tf.lite.TFLiteConverter.from_concrete_functions([func], self.keras_model)
         
         # INT8 quantization
         converter.optimizations = [tf.lite.Optimize.DEFAULT]
         converter.target_spec.supported_types = [tf.int8]
         
-        # Representative dataset for quantization
+        # Representative dataset for quantization, standardized as in training
+        X_scaled = self.scaler.transform(X_train).astype(np.float32)
         def representative_dataset():
-            for i in range(min(100, len(X_train))):
-                sample = X_train[i:i+1].reshape((1, 30, 1)).astype(np.float32)
-                yield [sample]
+            for i in range(0, min(100 * self.batch, len(X_scaled) - self.batch + 1), self.batch):
+                yield [X_scaled[i:i+self.batch].reshape((self.batch, 30, 1))]
         
         converter.representative_dataset = representative_dataset
         converter.inference_input_type = tf.int8
@@ -500,10 +560,33 @@ class TFLiteConverter:
         
         return tflite_model
     
-    def generate_arduino_header(self, tflite_model):
+    def fused_input_quantization(self, tflite_model, X_train):
+        """StandardScaler then input quantization as one multiply-add per
+        feature: q = round(x * gain + bias), with gain = 1 / (std * s) and
+        bias = zero_point - mean * gain"""
+        interpreter = tf.lite.Interpreter(model_content=tflite_model)
+        details = interpreter.get_input_details()[0]
+        in_scale, in_zero = details['quantization']
+        batch = int(details['shape'][0])
+        gain = (1.0 / (self.scaler.scale_ * in_scale)).astype(np.float32)
+        bias = (in_zero - self.scaler.mean_ * gain).astype(np.float32)
+        
+        # As the device computes it, against scaling then quantizing
+        X = X_train.astype(np.float32)
+        fused = np.clip(np.round(X * gain + bias), -128, 127)
+        two_step = np.clip(np.round(self.scaler.transform(X_train) / in_scale + in_zero), -128, 127)
+        differ = np.abs(fused - two_step)
+        print(f"✓ Fused input quantization (scale {in_scale:.5g}, zero point {in_zero}, batch {batch})")
+        print(f"   {np.mean(differ == 0)*100:.2f}% of training inputs identical to scale-then-quantize, "
+              f"max {int(differ.max())} LSB apart")
+        return batch, gain, bias
+    
+    def generate_arduino_header(self, tflite_model, X_train):
         """Generate Arduino .h file"""
         print("\n📝 Generating Arduino header...")
         
+        batch, gain, bias = self.fused_input_quantization(tflite_model, X_train)
+        
         # Convert to C array
         hex_array = ','.join([f'0x{byte:02x}' for byte in tflite_model])
         
@@ -521,11 +604,25 @@ class TFLiteConverter:
 #define MODEL_H
 
 const unsigned char model_data[] = {{
-{chr(10).join(wrapped)}
+{(','+chr(10)).join(wrapped)}
 }};
 
 const int model_data_len = {len(tflite_model)};
 
+// Windows per invoke: the input tensor is model_batch x 30 int8
+const int model_batch = {batch};
+
+// The training StandardScaler folded into the input quantization: feature k
+// goes into the int8 input tensor as round(x * model_input_gain[k] +
+// model_input_bias[k]), clamped to [-128, 127]
+const float model_input_gain[] = {{
+{c_floats(gain)}
+}};
+
+const float model_input_bias[] = {{
+{c_floats(bias)}
+}};
+
 // Activity labels
 const char* activity_names[] = {{
   "IDLE", "SOCIAL", "VIDEO", "MESSAGE", "BROWSE", "GAMING"
@@ -546,6 +643,13 @@ def main():
     parser = argparse.ArgumentParser()
     parser.add_argument('--mode', choices=['collect', 'train', 'convert', 'all'], 
                        default='all', help='Pipeline mode')
+    parser.add_argument('--feature-engine', metavar='PATH',
+                       help='Extract features with the native feature_engine binary')
+    parser.add_argument('--batch', type=int, default=1,
+                       help='Windows per model invoke in the converted model (model_batch)')
+    parser.add_argument('--multi-scale', action='store_true',
+                       help='Also write X_multiscale.npy: 30 features plus time-domain '
+                            'features of the MULTI_SCALES windows')
     args = parser.parse_args()
     
     if args.mode in ['collect', 'all']:
@@ -558,7 +662,12 @@ def main():
     if args.mode in ['train', 'convert', 'all']:
         # Phase 2: Feature Engineering
         extractor = FeatureExtractor()
-        X, y = extractor.process_dataset(dataset_file)
+        if args.feature_engine:
+            X, y = extractor.process_dataset_native(dataset_file, args.feature_engine)
+        else:
+            X, y = extractor.process_dataset(dataset_file)
+        if args.multi_scale:
+            extractor.process_dataset_multi_scale(dataset_file)
         
         # Split data
         X_train, X_test, y_train, y_test = train_test_split(
@@ -578,11 +687,12 @@ def main():
     if args.mode in ['convert', 'all']:
         # Phase 4: TFLite Conversion
         cnn_model = keras.models.load_model('data/models/cnn_model.h5')
+        scaler = joblib.load('data/models/cnn_scaler.pkl')
         X_train = np.load('data/processed/X.npy')
         
-        converter = TFLiteConverter(cnn_model)
+        converter = TFLiteConverter(cnn_model, scaler, args.batch)
         tflite_model = converter.convert_with_quantization(X_train)
-        converter.generate_arduino_header(tflite_model)
+        converter.generate_arduino_header(tflite_model, X_train)
         
         print("\n" + "="*60)
         print("PIPELINE COMPLETE!")